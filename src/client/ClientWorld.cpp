@@ -1,9 +1,20 @@
 #include "ClientWorld.h"
 #include "world/Components.h"
 #include "world/HeroSystem.h"
+#include <cmath>
 
 namespace WorldEditor {
 
+namespace {
+
+// Render time further than this from a snapshot's server time jumps straight to it
+// (first snapshot, hitch, server restarted its clock); smaller errors are corrected by
+// this fraction per snapshot so interpolation does not stutter
+constexpr f32 kMaxRenderTimeDrift = 0.25f;
+constexpr f32 kRenderTimeCorrection = 0.1f;
+
+} // namespace
+
 ClientWorld::ClientWorld() {
     entityManager_.setWorld(nullptr);
 }
@@ -17,7 +28,7 @@ void ClientWorld::update(f32 deltaTime) {
         return;
     }
     
-    // Update render time for interpolation
+    // Advance render time between snapshots
     renderTime_ += deltaTime;
     
     // Interpolate remote entities
@@ -52,6 +63,7 @@ void ClientWorld::clear() {
     nextSequenceNumber_ = 1;
     lastAcknowledgedInput_ = 0;
     renderTime_ = 0.0f;
+    renderTimeSynced_ = false;
     gameTime_ = 0.0f;
     gameActive_ = false;
 }
@@ -97,7 +109,7 @@ PlayerInput ClientWorld::generateInput() {
     // This will be implemented when integrating with input system
     PlayerInput input;
     input.sequenceNumber = getNextSequenceNumber();
-    input.timestamp = renderTime_;
+    input.timestamp = getViewTime();
     return input;
 }
 
@@ -105,6 +117,15 @@ void ClientWorld::applySnapshot(const WorldSnapshot& snapshot) {
     // Store snapshot for interpolation
     snapshotBuffer_.addSnapshot(snapshot);
     
+    // Keep render time on the server clock
+    const f32 drift = snapshot.serverTime - renderTime_;
+    if (!renderTimeSynced_ || std::abs(drift) > kMaxRenderTimeDrift) {
+        renderTime_ = snapshot.serverTime;
+        renderTimeSynced_ = true;
+    } else {
+        renderTime_ += drift * kRenderTimeCorrection;
+    }
+    
     // Update game state
     gameTime_ = snapshot.gameTime;
     gameActive_ = true;
@@ -115,8 +136,22 @@ void ClientWorld::applySnapshot(const WorldSnapshot& snapshot) {
     lastAcknowledgedInput_ = snapshot.lastProcessedInput;
     
     // Create or update entities from snapshot
+    Map<NetworkId, bool> present;
+    present.reserve(snapshot.entities.size());
     for (const auto& entitySnap : snapshot.entities) {
         createOrUpdateEntity(entitySnap);
+        present[entitySnap.networkId] = true;
+    }
+    
+    // Entities the server stopped sending died or are no longer relevant to us
+    Vector<Entity> stale;
+    for (const auto& [entity, networkId] : entityToNetworkId_) {
+        if (!present.count(networkId)) {
+            stale.push_back(entity);
+        }
+    }
+    for (Entity entity : stale) {
+        destroyEntity(entity);
     }
     
     // Reconcile local player if needed
@@ -195,7 +230,7 @@ void ClientWorld::reconcile(const WorldSnapshot& snapshot) {
 
 void ClientWorld::interpolateRemoteEntities(f32 deltaTime) {
     // Calculate interpolation time (render time - interpolation delay)
-    const f32 interpTime = renderTime_ - NetworkConfig::INTERPOLATION_DELAY;
+    const f32 interpTime = getViewTime();
     
     // Get two snapshots for interpolation
     WorldSnapshot from, to;
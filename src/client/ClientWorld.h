@@ -72,8 +72,12 @@ public:
     // Snapshot buffer
     const SnapshotBuffer& getSnapshotBuffer() const { return snapshotBuffer_; }
     
-    // Render time (for interpolation)
+    // Render time (for interpolation): the newest snapshot's server time, advanced locally
+    // between snapshots and nudged toward each new one, so it follows the server clock
+    // whatever the client's own clock says
     f32 getRenderTime() const { return renderTime_; }
+    // Server time remote entities are interpolated at (sent with inputs for lag compensation)
+    f32 getViewTime() const { return renderTime_ - NetworkConfig::INTERPOLATION_DELAY; }
     
     // Network ID assignment (for external entity creation)
     NetworkId assignNetworkId(Entity entity, NetworkId networkId);
@@ -98,6 +102,7 @@ private:
     
     // Timing
     f32 renderTime_ = 0.0f;
+    bool renderTimeSynced_ = false;
     f32 gameTime_ = 0.0f;
     
     // Game state (from server)
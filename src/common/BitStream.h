@@ -0,0 +1,177 @@
+#pragma once
+
+#include "core/Types.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace WorldEditor {
+
+// Bit-level writer over a caller-owned buffer. Bits fill each byte from the least
+// significant end and values are split with shifts, so the wire format does not depend
+// on the host's byte order. Writing past the end sets the overflow flag and drops the
+// data; callers check it (or rewind to a mark) instead of pre-computing sizes.
+class BitWriter {
+public:
+    BitWriter(u8* buffer, size_t capacity) : buffer_(buffer), capacityBits_(capacity * 8) {}
+
+    void writeBits(u32 value, u32 bits) {
+        if (bits == 0) {
+            return;
+        }
+        if (overflow_ || bitPos_ + bits > capacityBits_) {
+            overflow_ = true;
+            return;
+        }
+        if (bits < 32) {
+            value &= (1u << bits) - 1u;
+        }
+        while (bits > 0) {
+            const u32 byteIndex = static_cast<u32>(bitPos_ >> 3);
+            const u32 bitOffset = static_cast<u32>(bitPos_ & 7);
+            const u32 take = std::min(bits, 8u - bitOffset);
+            const u8 chunk = static_cast<u8>(value & ((1u << take) - 1u));
+            // Bits above the write position may be left over from a rewind
+            const u8 kept = static_cast<u8>(buffer_[byteIndex] & ((1u << bitOffset) - 1u));
+            buffer_[byteIndex] = static_cast<u8>(kept | (chunk << bitOffset));
+            value >>= take;
+            bits -= take;
+            bitPos_ += take;
+        }
+    }
+
+    void writeBool(bool value) { writeBits(value ? 1u : 0u, 1); }
+
+    // 7 bits per byte-sized group, small values in 8 bits
+    void writeVarint(u32 value) {
+        while (value >= 0x80u) {
+            writeBits((value & 0x7Fu) | 0x80u, 8);
+            value >>= 7;
+        }
+        writeBits(value, 8);
+    }
+
+    // Raw IEEE bits
+    void writeFloat(f32 value) {
+        u32 bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        writeBits(bits, 32);
+    }
+
+    // Fixed point over [min, max] in the given number of bits; out of range values clamp
+    void writeQuantized(f32 value, f32 min, f32 max, u32 bits) {
+        writeBits(quantize(value, min, max, bits), bits);
+    }
+
+    // Rewrites bits already written (e.g. a count reserved before its records)
+    void patchBits(size_t bitPosition, u32 value, u32 bits) {
+        if (bitPosition + bits > bitPos_) {
+            return;
+        }
+        // Bit by bit: the neighbours in the same bytes stay as they are
+        for (u32 i = 0; i < bits; ++i) {
+            const size_t pos = bitPosition + i;
+            const u8 mask = static_cast<u8>(1u << (pos & 7));
+            if ((value >> i) & 1u) {
+                buffer_[pos >> 3] = static_cast<u8>(buffer_[pos >> 3] | mask);
+            } else {
+                buffer_[pos >> 3] = static_cast<u8>(buffer_[pos >> 3] & ~mask);
+            }
+        }
+    }
+
+    // Drops everything written after the mark and clears the overflow flag
+    void rewind(size_t bitPosition) {
+        if (bitPosition < bitPos_) {
+            bitPos_ = bitPosition;
+        }
+        overflow_ = false;
+    }
+
+    size_t getBitPosition() const { return bitPos_; }
+    size_t getBytesWritten() const { return (bitPos_ + 7) >> 3; }
+    bool overflowed() const { return overflow_; }
+
+    static u32 quantize(f32 value, f32 min, f32 max, u32 bits) {
+        const u32 maxValue = bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+        const f32 t = (std::clamp(value, min, max) - min) / (max - min);
+        return static_cast<u32>(std::lround(static_cast<double>(t) * static_cast<double>(maxValue)));
+    }
+
+    static f32 dequantize(u32 value, f32 min, f32 max, u32 bits) {
+        const u32 maxValue = bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+        return min + (max - min) * static_cast<f32>(static_cast<double>(value) / static_cast<double>(maxValue));
+    }
+
+private:
+    u8* buffer_;
+    size_t capacityBits_;
+    size_t bitPos_ = 0;
+    bool overflow_ = false;
+};
+
+// Reads what BitWriter wrote. Reading past the end sets the error flag and yields zeros,
+// so a decoder can read a whole record and check once.
+class BitReader {
+public:
+    BitReader(const u8* data, size_t size) : data_(data), sizeBits_(size * 8) {}
+
+    u32 readBits(u32 bits) {
+        if (bits == 0) {
+            return 0;
+        }
+        if (error_ || bitPos_ + bits > sizeBits_) {
+            error_ = true;
+            return 0;
+        }
+        u32 value = 0;
+        u32 shift = 0;
+        while (shift < bits) {
+            const u32 byteIndex = static_cast<u32>(bitPos_ >> 3);
+            const u32 bitOffset = static_cast<u32>(bitPos_ & 7);
+            const u32 take = std::min(bits - shift, 8u - bitOffset);
+            const u32 chunk = (static_cast<u32>(data_[byteIndex]) >> bitOffset) & ((1u << take) - 1u);
+            value |= chunk << shift;
+            shift += take;
+            bitPos_ += take;
+        }
+        return value;
+    }
+
+    bool readBool() { return readBits(1) != 0; }
+
+    u32 readVarint() {
+        u32 value = 0;
+        for (u32 shift = 0; shift < 35; shift += 7) {
+            const u32 byte = readBits(8);
+            value |= (byte & 0x7Fu) << shift;
+            if ((byte & 0x80u) == 0) {
+                return value;
+            }
+        }
+        error_ = true;  // Longer than any u32
+        return 0;
+    }
+
+    f32 readFloat() {
+        const u32 bits = readBits(32);
+        f32 value = 0.0f;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    f32 readQuantized(f32 min, f32 max, u32 bits) {
+        return BitWriter::dequantize(readBits(bits), min, max, bits);
+    }
+
+    size_t getBitPosition() const { return bitPos_; }
+    bool hasError() const { return error_; }
+
+private:
+    const u8* data_;
+    size_t sizeBits_;
+    size_t bitPos_ = 0;
+    bool error_ = false;
+};
+
+} // namespace WorldEditor
@@ -52,9 +52,13 @@ struct PlayerInput {
     bool isShiftQueued = false;     // Queue command
     bool isAttackMove = false;      // Attack-move modifier
     
-    // Timestamp for lag compensation
+    // Lag compensation: the server time the client was showing (its interpolation time)
     f32 timestamp = 0.0f;
     
+    // Interest management: ground point at the centre of the client's view
+    Vec3 cameraFocus = Vec3(0.0f);
+    bool hasCameraFocus = false;
+    
     PlayerInput() = default;
     
     // Helper constructors
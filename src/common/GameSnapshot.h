@@ -2,6 +2,8 @@
 
 #include "core/Types.h"
 #include "NetworkTypes.h"
+#include "BitStream.h"
+#include <cmath>
 
 namespace WorldEditor {
 
@@ -36,19 +38,194 @@ struct EntitySnapshot {
     EntitySnapshot() = default;
 };
 
-// Serialized snapshot header (fixed size, sent over network)
-struct SnapshotHeader {
-    TickNumber tick = 0;
-    f32 serverTime = 0.0f;
-    f32 gameTime = 0.0f;
-    i32 currentWave = 0;
-    f32 timeToNextWave = 0.0f;
-    SequenceNumber lastProcessedInput = 0;
-    u16 entityCount = 0;  // Number of EntitySnapshot following this header
-};
+// Wire ranges for snapshot fields. Positions are fixed point over the map (16000x16000
+// plus a margin), rotation is the yaw angle only (units turn about the up axis), health and
+// mana travel as a ratio of their maximum, which is sent as a whole number.
+namespace SnapshotQuantization {
+    constexpr f32 POSITION_MIN_XZ = -2048.0f;
+    constexpr f32 POSITION_MAX_XZ = 18432.0f;
+    constexpr u32 POSITION_BITS_XZ = 18;    // ~0.08 units
+    constexpr f32 POSITION_MIN_Y = -1024.0f;
+    constexpr f32 POSITION_MAX_Y = 3072.0f;
+    constexpr u32 POSITION_BITS_Y = 15;     // ~0.13 units
+    constexpr f32 VELOCITY_MAX = 2048.0f;   // Per axis, either sign
+    constexpr u32 VELOCITY_BITS = 16;
+    constexpr u32 YAW_BITS = 12;            // ~0.09 degrees
+    constexpr u32 RATIO_BITS = 16;
+    constexpr u32 TEAM_BITS = 4;
+    constexpr u32 ENTITY_TYPE_BITS = 8;
+}
+
+// Bit-packed EntitySnapshot fields. Each field can be written on its own so deltas only
+// carry what changed; MaxHealth/MaxMana come before Health/Mana because the ratios are
+// relative to them.
+class EntitySnapshotCodec {
+public:
+    enum Field : u16 {
+        Position      = 1 << 0,
+        Velocity      = 1 << 1,
+        Rotation      = 1 << 2,
+        Health        = 1 << 3,
+        MaxHealth     = 1 << 4,
+        Mana          = 1 << 5,
+        MaxMana       = 1 << 6,
+        StateFlags    = 1 << 7,
+        Team          = 1 << 8,
+        EntityType    = 1 << 9,
+        Owner         = 1 << 10,
+        AllFields     = (1 << 11) - 1
+    };
+    static constexpr u32 FIELD_MASK_BITS = 11;
+
+    // Fields that differ; a new maximum also resends the ratio that depends on it
+    static u16 changedFields(const EntitySnapshot& from, const EntitySnapshot& to) {
+        u16 mask = 0;
+        if (from.position != to.position) mask |= Position;
+        if (from.velocity != to.velocity) mask |= Velocity;
+        if (from.rotation != to.rotation) mask |= Rotation;
+        if (from.health != to.health) mask |= Health;
+        if (from.maxHealth != to.maxHealth) mask |= MaxHealth | Health;
+        if (from.mana != to.mana) mask |= Mana;
+        if (from.maxMana != to.maxMana) mask |= MaxMana | Mana;
+        if (from.stateFlags != to.stateFlags) mask |= StateFlags;
+        if (from.teamId != to.teamId) mask |= Team;
+        if (from.entityType != to.entityType) mask |= EntityType;
+        if (from.ownerClientId != to.ownerClientId) mask |= Owner;
+        return mask;
+    }
+
+    // Rounds every field to exactly what the receiver decodes, so the sender can compare
+    // against what the receiver holds
+    static void quantize(EntitySnapshot& entity) {
+        using namespace SnapshotQuantization;
+        entity.position = Vec3(
+            roundTrip(entity.position.x, POSITION_MIN_XZ, POSITION_MAX_XZ, POSITION_BITS_XZ),
+            roundTrip(entity.position.y, POSITION_MIN_Y, POSITION_MAX_Y, POSITION_BITS_Y),
+            roundTrip(entity.position.z, POSITION_MIN_XZ, POSITION_MAX_XZ, POSITION_BITS_XZ));
+        entity.velocity = Vec3(
+            roundTrip(entity.velocity.x, -VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS),
+            roundTrip(entity.velocity.y, -VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS),
+            roundTrip(entity.velocity.z, -VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS));
+        entity.rotation = yawRotation(roundTrip(yawOf(entity.rotation), -kPi, kPi, YAW_BITS));
+        entity.maxHealth = static_cast<f32>(wholeNumber(entity.maxHealth));
+        entity.health = ratioValue(BitWriter::quantize(ratioOf(entity.health, entity.maxHealth), 0.0f, 1.0f, RATIO_BITS),
+                                   entity.maxHealth);
+        entity.maxMana = static_cast<f32>(wholeNumber(entity.maxMana));
+        entity.mana = ratioValue(BitWriter::quantize(ratioOf(entity.mana, entity.maxMana), 0.0f, 1.0f, RATIO_BITS),
+                                 entity.maxMana);
+        entity.teamId = static_cast<TeamId>(static_cast<u32>(entity.teamId) & ((1u << TEAM_BITS) - 1u));
+    }
+
+    static void write(BitWriter& writer, const EntitySnapshot& entity, u16 mask) {
+        using namespace SnapshotQuantization;
+        if (mask & Position) {
+            writer.writeQuantized(entity.position.x, POSITION_MIN_XZ, POSITION_MAX_XZ, POSITION_BITS_XZ);
+            writer.writeQuantized(entity.position.y, POSITION_MIN_Y, POSITION_MAX_Y, POSITION_BITS_Y);
+            writer.writeQuantized(entity.position.z, POSITION_MIN_XZ, POSITION_MAX_XZ, POSITION_BITS_XZ);
+        }
+        if (mask & Velocity) {
+            writer.writeQuantized(entity.velocity.x, -VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS);
+            writer.writeQuantized(entity.velocity.y, -VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS);
+            writer.writeQuantized(entity.velocity.z, -VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS);
+        }
+        if (mask & Rotation) {
+            writer.writeQuantized(yawOf(entity.rotation), -kPi, kPi, YAW_BITS);
+        }
+        if (mask & MaxHealth) {
+            writer.writeVarint(wholeNumber(entity.maxHealth));
+        }
+        if (mask & Health) {
+            writer.writeQuantized(ratioOf(entity.health, entity.maxHealth), 0.0f, 1.0f, RATIO_BITS);
+        }
+        if (mask & MaxMana) {
+            writer.writeVarint(wholeNumber(entity.maxMana));
+        }
+        if (mask & Mana) {
+            writer.writeQuantized(ratioOf(entity.mana, entity.maxMana), 0.0f, 1.0f, RATIO_BITS);
+        }
+        if (mask & StateFlags) {
+            writer.writeVarint(entity.stateFlags);
+        }
+        if (mask & Team) {
+            writer.writeBits(static_cast<u32>(entity.teamId), TEAM_BITS);
+        }
+        if (mask & EntityType) {
+            writer.writeBits(entity.entityType, ENTITY_TYPE_BITS);
+        }
+        if (mask & Owner) {
+            writer.writeVarint(entity.ownerClientId);
+        }
+    }
+
+    // Fields outside the mask keep their current value
+    static void read(BitReader& reader, EntitySnapshot& entity, u16 mask) {
+        using namespace SnapshotQuantization;
+        if (mask & Position) {
+            entity.position.x = reader.readQuantized(POSITION_MIN_XZ, POSITION_MAX_XZ, POSITION_BITS_XZ);
+            entity.position.y = reader.readQuantized(POSITION_MIN_Y, POSITION_MAX_Y, POSITION_BITS_Y);
+            entity.position.z = reader.readQuantized(POSITION_MIN_XZ, POSITION_MAX_XZ, POSITION_BITS_XZ);
+        }
+        if (mask & Velocity) {
+            entity.velocity.x = reader.readQuantized(-VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS);
+            entity.velocity.y = reader.readQuantized(-VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS);
+            entity.velocity.z = reader.readQuantized(-VELOCITY_MAX, VELOCITY_MAX, VELOCITY_BITS);
+        }
+        if (mask & Rotation) {
+            entity.rotation = yawRotation(reader.readQuantized(-kPi, kPi, YAW_BITS));
+        }
+        if (mask & MaxHealth) {
+            entity.maxHealth = static_cast<f32>(reader.readVarint());
+        }
+        if (mask & Health) {
+            entity.health = ratioValue(reader.readBits(RATIO_BITS), entity.maxHealth);
+        }
+        if (mask & MaxMana) {
+            entity.maxMana = static_cast<f32>(reader.readVarint());
+        }
+        if (mask & Mana) {
+            entity.mana = ratioValue(reader.readBits(RATIO_BITS), entity.maxMana);
+        }
+        if (mask & StateFlags) {
+            entity.stateFlags = reader.readVarint();
+        }
+        if (mask & Team) {
+            entity.teamId = static_cast<TeamId>(reader.readBits(TEAM_BITS));
+        }
+        if (mask & EntityType) {
+            entity.entityType = static_cast<u8>(reader.readBits(ENTITY_TYPE_BITS));
+        }
+        if (mask & Owner) {
+            entity.ownerClientId = reader.readVarint();
+        }
+    }
 
-// Maximum entities per snapshot packet (to fit in UDP packet)
-constexpr u32 MAX_ENTITIES_PER_SNAPSHOT = 16;
+private:
+    static constexpr f32 kPi = 3.14159265358979f;
+
+    static f32 roundTrip(f32 value, f32 min, f32 max, u32 bits) {
+        return BitWriter::dequantize(BitWriter::quantize(value, min, max, bits), min, max, bits);
+    }
+
+    static f32 yawOf(const Quat& q) {
+        return std::atan2(2.0f * (q.w * q.y + q.x * q.z), 1.0f - 2.0f * (q.x * q.x + q.y * q.y));
+    }
+
+    static Quat yawRotation(f32 yaw) {
+        return Quat(std::cos(yaw * 0.5f), 0.0f, std::sin(yaw * 0.5f), 0.0f);
+    }
+
+    static u32 wholeNumber(f32 value) {
+        return value > 0.0f ? static_cast<u32>(std::lround(static_cast<double>(value))) : 0u;
+    }
+
+    static f32 ratioOf(f32 value, f32 max) {
+        return max > 0.0f ? value / max : 0.0f;
+    }
+
+    static f32 ratioValue(u32 quantizedRatio, f32 max) {
+        return BitWriter::dequantize(quantizedRatio, 0.0f, 1.0f, SnapshotQuantization::RATIO_BITS) * max;
+    }
+};
 
 // World snapshot (sent from server to client each tick)
 struct WorldSnapshot {
@@ -81,71 +258,63 @@ struct WorldSnapshot {
         return nullptr;
     }
     
-    // Serialize to buffer for network transmission
-    // Returns number of bytes written, or 0 on failure
+    // Serialize to buffer for network transmission (bit-packed, every field of every entity)
+    // Returns number of bytes written, or 0 if the buffer is too small
     size_t serialize(u8* buffer, size_t bufferSize) const {
-        size_t entityCount = std::min(entities.size(), (size_t)MAX_ENTITIES_PER_SNAPSHOT);
-        size_t requiredSize = sizeof(SnapshotHeader) + entityCount * sizeof(EntitySnapshot);
-        
-        if (bufferSize < requiredSize) {
+        if (entities.size() > 0xFFFF) {
             return 0;
         }
+        const size_t entityCount = entities.size();
         
-        // Write header
-        SnapshotHeader header;
-        header.tick = tick;
-        header.serverTime = serverTime;
-        header.gameTime = gameTime;
-        header.currentWave = currentWave;
-        header.timeToNextWave = timeToNextWave;
-        header.lastProcessedInput = lastProcessedInput;
-        header.entityCount = static_cast<u16>(entityCount);
-        
-        memcpy(buffer, &header, sizeof(SnapshotHeader));
+        BitWriter writer(buffer, bufferSize);
+        writer.writeBits(tick, 32);
+        writer.writeFloat(serverTime);
+        writer.writeFloat(gameTime);
+        writer.writeVarint(static_cast<u32>(currentWave));
+        writer.writeFloat(timeToNextWave);
+        writer.writeVarint(lastProcessedInput);
+        writer.writeBits(static_cast<u32>(entityCount), 16);
         
-        // Write entities
-        u8* entityPtr = buffer + sizeof(SnapshotHeader);
         for (size_t i = 0; i < entityCount; ++i) {
-            memcpy(entityPtr, &entities[i], sizeof(EntitySnapshot));
-            entityPtr += sizeof(EntitySnapshot);
+            writer.writeVarint(entities[i].networkId);
+            EntitySnapshotCodec::write(writer, entities[i], EntitySnapshotCodec::AllFields);
         }
         
-        return requiredSize;
+        return writer.overflowed() ? 0 : writer.getBytesWritten();
     }
     
     // Deserialize from buffer
     // Returns true on success
     bool deserialize(const u8* buffer, size_t bufferSize) {
-        if (bufferSize < sizeof(SnapshotHeader)) {
+        BitReader reader(buffer, bufferSize);
+        const TickNumber newTick = reader.readBits(32);
+        const f32 newServerTime = reader.readFloat();
+        const f32 newGameTime = reader.readFloat();
+        const i32 newWave = static_cast<i32>(reader.readVarint());
+        const f32 newTimeToNextWave = reader.readFloat();
+        const SequenceNumber newLastProcessedInput = reader.readVarint();
+        const u32 entityCount = reader.readBits(16);
+        if (reader.hasError()) {
             return false;
         }
         
-        // Read header
-        SnapshotHeader header;
-        memcpy(&header, buffer, sizeof(SnapshotHeader));
-        
-        size_t requiredSize = sizeof(SnapshotHeader) + header.entityCount * sizeof(EntitySnapshot);
-        if (bufferSize < requiredSize) {
-            return false;
+        Vector<EntitySnapshot> newEntities(entityCount);
+        for (auto& entity : newEntities) {
+            entity.networkId = reader.readVarint();
+            entity.tick = newTick;
+            EntitySnapshotCodec::read(reader, entity, EntitySnapshotCodec::AllFields);
         }
-        
-        tick = header.tick;
-        serverTime = header.serverTime;
-        gameTime = header.gameTime;
-        currentWave = header.currentWave;
-        timeToNextWave = header.timeToNextWave;
-        lastProcessedInput = header.lastProcessedInput;
-        
-        // Read entities
-        entities.clear();
-        entities.resize(header.entityCount);
-        
-        const u8* entityPtr = buffer + sizeof(SnapshotHeader);
-        for (u16 i = 0; i < header.entityCount; ++i) {
-            memcpy(&entities[i], entityPtr, sizeof(EntitySnapshot));
-            entityPtr += sizeof(EntitySnapshot);
+        if (reader.hasError()) {
+            return false;
         }
         
+        tick = newTick;
+        serverTime = newServerTime;
+        gameTime = newGameTime;
+        currentWave = newWave;
+        timeToNextWave = newTimeToNextWave;
+        lastProcessedInput = newLastProcessedInput;
+        entities = std::move(newEntities);
         return true;
     }
 };
@@ -33,8 +33,14 @@ namespace NetworkConfig {
     constexpr f32 CLIENT_TICK_INTERVAL = 1.0f / CLIENT_TICK_RATE;
     
     constexpr f32 INTERPOLATION_DELAY = 0.1f;   // 100ms interpolation buffer
+    constexpr f32 LAG_COMPENSATION_WINDOW = 0.5f; // Furthest the server rewinds to judge a command
     constexpr u32 INPUT_BUFFER_SIZE = 128;      // Max buffered inputs
     constexpr u32 SNAPSHOT_BUFFER_SIZE = 64;    // Max buffered snapshots
+    constexpr u32 SNAPSHOT_HISTORY_SIZE = 32;   // Snapshots kept as delta baselines (~1s)
+    constexpr u32 SNAPSHOT_FRAGMENT_SIZE = 1200; // Snapshot bytes per datagram, under the MTU with headers
+    constexpr u32 MAX_SNAPSHOT_FRAGMENTS = 32;  // Datagrams per snapshot (~37KB)
+    constexpr u32 SNAPSHOT_BANDWIDTH = 128 * 1024; // Snapshot bytes per second per client
+    constexpr f32 SNAPSHOT_BURST_TIME = 0.1f;   // Unused budget kept, in seconds of bandwidth
 }
 
 } // namespace WorldEditor
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "core/Types.h"
+#include "NetworkTypes.h"
+#include "GameSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace WorldEditor {
+
+// How fast each kind of entity's claim on a client's bandwidth grows, per snapshot
+struct ReplicationPriorities {
+    f32 ownHero = 16.0f;
+    f32 hero = 4.0f;
+    f32 creep = 1.0f;
+    f32 tower = 0.25f;
+    f32 other = 0.5f;
+    f32 fightScale = 2.0f;      // Health changed since the previous snapshot
+    f32 nearRadius = 1500.0f;   // Full priority within this ground distance of the client's hero
+    f32 farRadius = 5000.0f;    // farScale beyond this distance, linear in between
+    f32 farScale = 0.25f;
+};
+
+// Per-client priority accumulator for snapshot records. Every snapshot each entity's
+// accumulator grows by its priority (type, distance to the client's hero, whether it is
+// fighting); the encoder then writes records in descending accumulator order until the
+// client's byte budget is spent. Entities that were written, or had nothing new to send,
+// start over from zero; the ones left out keep their total and climb the order, so under
+// a tight budget low-priority entities update less often instead of never.
+class ReplicationScheduler {
+public:
+    void setPriorities(const ReplicationPriorities& priorities) { priorities_ = priorities; }
+    const ReplicationPriorities& getPriorities() const { return priorities_; }
+
+    // Accumulates this snapshot's priorities and returns entity indices into snapshot,
+    // highest accumulated first. Valid until the next call.
+    const Vector<u32>& schedule(const WorldSnapshot& snapshot, ClientId clientId) {
+        ++stamp_;
+
+        const EntitySnapshot* ownHero = nullptr;
+        for (const auto& entity : snapshot.entities) {
+            if (entity.entityType == 1 && entity.ownerClientId == clientId) {
+                ownHero = &entity;
+                break;
+            }
+        }
+
+        order_.clear();
+        order_.reserve(snapshot.entities.size());
+        accumulated_.resize(snapshot.entities.size());
+        for (u32 i = 0; i < snapshot.entities.size(); ++i) {
+            const EntitySnapshot& entity = snapshot.entities[i];
+            Entry& entry = entries_[entity.networkId];
+            const bool fighting = entry.seenStamp != 0 && entry.lastHealth != entity.health;
+            entry.accumulated += getPriority(entity, ownHero, clientId, fighting);
+            entry.lastHealth = entity.health;
+            entry.seenStamp = stamp_;
+            accumulated_[i] = entry.accumulated;
+            order_.push_back(i);
+        }
+
+        // Entities that left the snapshot are forgotten
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            it = it->second.seenStamp == stamp_ ? std::next(it) : entries_.erase(it);
+        }
+
+        // Stable so equal priorities keep the snapshot's order
+        std::stable_sort(order_.begin(), order_.end(), [this](u32 a, u32 b) {
+            return accumulated_[a] > accumulated_[b];
+        });
+        return order_;
+    }
+
+    // After encoding: everything scheduled starts over except what did not fit
+    void finish(const Vector<NetworkId>& deferred) {
+        for (NetworkId id : deferred) {
+            auto it = entries_.find(id);
+            if (it != entries_.end()) {
+                it->second.deferredStamp = stamp_;
+            }
+        }
+        for (auto& [id, entry] : entries_) {
+            if (entry.deferredStamp != stamp_) {
+                entry.accumulated = 0.0f;
+            }
+        }
+    }
+
+    f32 getAccumulated(NetworkId id) const {
+        auto it = entries_.find(id);
+        return it != entries_.end() ? it->second.accumulated : 0.0f;
+    }
+
+    void clear() {
+        entries_.clear();
+        order_.clear();
+        accumulated_.clear();
+    }
+
+private:
+    struct Entry {
+        f32 accumulated = 0.0f;
+        f32 lastHealth = 0.0f;
+        u32 seenStamp = 0;
+        u32 deferredStamp = 0;
+    };
+
+    f32 getPriority(const EntitySnapshot& entity, const EntitySnapshot* ownHero, ClientId clientId, bool fighting) const {
+        f32 priority = priorities_.other;
+        switch (entity.entityType) {
+            case 1: priority = entity.ownerClientId == clientId ? priorities_.ownHero : priorities_.hero; break;
+            case 2: priority = priorities_.creep; break;
+            case 3: priority = priorities_.tower; break;
+            default: break;
+        }
+        if (fighting) {
+            priority *= priorities_.fightScale;
+        }
+        if (ownHero && &entity != ownHero) {
+            const f32 dx = entity.position.x - ownHero->position.x;
+            const f32 dz = entity.position.z - ownHero->position.z;
+            const f32 distance = std::sqrt(dx * dx + dz * dz);
+            const f32 span = std::max(priorities_.farRadius - priorities_.nearRadius, 1.0f);
+            const f32 t = std::clamp((distance - priorities_.nearRadius) / span, 0.0f, 1.0f);
+            priority *= 1.0f + (priorities_.farScale - 1.0f) * t;
+        }
+        return priority;
+    }
+
+    ReplicationPriorities priorities_;
+    Map<NetworkId, Entry> entries_;
+    Vector<u32> order_;
+    Vector<f32> accumulated_;   // By snapshot index, for sorting
+    u32 stamp_ = 0;
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,272 @@
+#pragma once
+
+#include "core/Types.h"
+#include "NetworkTypes.h"
+#include "GameSnapshot.h"
+#include "BitStream.h"
+#include <algorithm>
+#include <utility>
+
+namespace WorldEditor {
+
+// Recent snapshots by tick: what the server sent to one client, or what a client
+// reconstructed. Either end looks up delta baselines here.
+class SnapshotHistory {
+public:
+    explicit SnapshotHistory(size_t capacity = NetworkConfig::SNAPSHOT_HISTORY_SIZE)
+        : slots_(capacity > 0 ? capacity : 1) {}
+
+    void add(const WorldSnapshot& snapshot) {
+        Slot& slot = slots_[snapshot.tick % slots_.size()];
+        slot.used = true;
+        slot.snapshot = snapshot;
+    }
+
+    // Stores without copying: the snapshot is swapped into its slot and comes back holding
+    // whatever the slot held before, so a caller decoding into it reuses that storage.
+    // The stored snapshot stays where it is until a tick mapping to the same slot arrives.
+    const WorldSnapshot& store(WorldSnapshot& snapshot) {
+        Slot& slot = slots_[snapshot.tick % slots_.size()];
+        slot.used = true;
+        std::swap(slot.snapshot, snapshot);
+        return slot.snapshot;
+    }
+
+    const WorldSnapshot* find(TickNumber tick) const {
+        const Slot& slot = slots_[tick % slots_.size()];
+        return slot.used && slot.snapshot.tick == tick ? &slot.snapshot : nullptr;
+    }
+
+    void clear() {
+        for (auto& slot : slots_) {
+            slot.used = false;
+            slot.snapshot = WorldSnapshot();
+        }
+    }
+
+private:
+    struct Slot {
+        bool used = false;
+        WorldSnapshot snapshot;
+    };
+    Vector<Slot> slots_;
+};
+
+// Encodes a snapshot as the fields that changed since a baseline the client already has
+// (the newest one it acknowledged). Each entity record is its network ID, a mask of the
+// fields that follow and those fields, bit-packed by EntitySnapshotCodec; unchanged
+// entities are not written at all and the client carries them over from the baseline.
+// Entities are quantized before the comparison, so movement below the wire precision
+// sends nothing.
+//
+// Layout: tick, has-baseline bit, ticks back to the baseline, times and counters, the
+// removed and changed record counts, removed network IDs, then the records.
+//
+// Records that do not fit the buffer are left out. The encoder reports the snapshot the
+// client will reconstruct (skipped entities keep their baseline state, new ones are
+// missing), which is what the server must store as the next baseline. With a byte budget
+// smaller than the buffer, order (indices into current.entities, e.g. from a
+// ReplicationScheduler) decides which records get the room first.
+class SnapshotDeltaCodec {
+public:
+    // Returns bytes written (0 if not even the header fits). baseline, order and
+    // outDeferred may be null; outDeferred receives the changed entities left out.
+    static size_t encode(const WorldSnapshot& current, const WorldSnapshot* baseline,
+                         u8* buffer, size_t bufferSize, WorldSnapshot& outSent,
+                         const Vector<u32>* order = nullptr, Vector<NetworkId>* outDeferred = nullptr) {
+        BitWriter writer(buffer, bufferSize);
+        writer.writeBits(current.tick, 32);
+        writer.writeBool(baseline != nullptr);
+        if (baseline) {
+            writer.writeVarint(current.tick - baseline->tick);
+        }
+        writer.writeFloat(current.serverTime);
+        writer.writeFloat(current.gameTime);
+        writer.writeVarint(static_cast<u32>(current.currentWave));
+        writer.writeFloat(current.timeToNextWave);
+        writer.writeVarint(current.lastProcessedInput);
+        const size_t countsPosition = writer.getBitPosition();
+        writer.writeBits(0, 16);    // Removed
+        writer.writeBits(0, 16);    // Records
+        if (writer.overflowed()) {
+            return 0;
+        }
+
+        outSent.tick = current.tick;
+        outSent.serverTime = current.serverTime;
+        outSent.gameTime = current.gameTime;
+        outSent.currentWave = current.currentWave;
+        outSent.timeToNextWave = current.timeToNextWave;
+        outSent.lastProcessedInput = current.lastProcessedInput;
+        outSent.entities.clear();
+        outSent.entities.reserve(current.entities.size());
+
+        Map<NetworkId, const EntitySnapshot*> baseEntities;
+        if (baseline) {
+            baseEntities.reserve(baseline->entities.size());
+            for (const auto& entity : baseline->entities) {
+                baseEntities[entity.networkId] = &entity;
+            }
+        }
+
+        // Removals first: they are small and a missed one would linger on the client
+        u32 removedCount = 0;
+        if (baseline) {
+            Map<NetworkId, bool> present;
+            present.reserve(current.entities.size());
+            for (const auto& entity : current.entities) {
+                present[entity.networkId] = true;
+            }
+            for (const auto& entity : baseline->entities) {
+                if (present.count(entity.networkId)) {
+                    continue;
+                }
+                const size_t mark = writer.getBitPosition();
+                if (removedCount < 0xFFFF) {
+                    writer.writeVarint(entity.networkId);
+                }
+                if (removedCount == 0xFFFF || writer.overflowed()) {
+                    writer.rewind(mark);
+                    outSent.entities.push_back(entity);   // Still there as far as the client knows
+                    continue;
+                }
+                ++removedCount;
+            }
+        }
+
+        if (outDeferred) {
+            outDeferred->clear();
+        }
+        u32 recordCount = 0;
+        const size_t entityCount = order ? order->size() : current.entities.size();
+        for (size_t i = 0; i < entityCount; ++i) {
+            const EntitySnapshot& entity = current.entities[order ? (*order)[i] : i];
+            auto it = baseEntities.find(entity.networkId);
+            const EntitySnapshot* base = it != baseEntities.end() ? it->second : nullptr;
+
+            EntitySnapshot quantized = entity;
+            EntitySnapshotCodec::quantize(quantized);
+            const u16 mask = base ? EntitySnapshotCodec::changedFields(*base, quantized)
+                                  : static_cast<u16>(EntitySnapshotCodec::AllFields);
+            if (mask == 0) {
+                outSent.entities.push_back(*base);
+                continue;
+            }
+
+            const size_t mark = writer.getBitPosition();
+            if (recordCount < 0xFFFF) {
+                writer.writeVarint(entity.networkId);
+                writer.writeBits(mask, EntitySnapshotCodec::FIELD_MASK_BITS);
+                EntitySnapshotCodec::write(writer, quantized, mask);
+            }
+            if (recordCount == 0xFFFF || writer.overflowed()) {
+                writer.rewind(mark);
+                if (base) {
+                    outSent.entities.push_back(*base);
+                }
+                if (outDeferred) {
+                    outDeferred->push_back(entity.networkId);
+                }
+                continue;
+            }
+            ++recordCount;
+            outSent.entities.push_back(quantized);
+        }
+
+        writer.patchBits(countsPosition, removedCount, 16);
+        writer.patchBits(countsPosition + 16, recordCount, 16);
+        return writer.getBytesWritten();
+    }
+
+    // A received delta's tick and the baseline it needs; false if the data is too short
+    static bool peekHeader(const u8* data, size_t size, TickNumber& outTick,
+                           bool& outHasBaseline, TickNumber& outBaselineTick) {
+        BitReader reader(data, size);
+        outTick = reader.readBits(32);
+        outHasBaseline = reader.readBool();
+        outBaselineTick = outHasBaseline ? outTick - reader.readVarint() : 0;
+        return !reader.hasError();
+    }
+
+    // Rebuilds the full snapshot in place, reusing out's entity storage; false on malformed
+    // data or a missing/mismatched baseline (out is then left half-written). out must not
+    // alias baseline.
+    static bool decode(const u8* data, size_t size, const WorldSnapshot* baseline, WorldSnapshot& out) {
+        BitReader reader(data, size);
+        const TickNumber tick = reader.readBits(32);
+        const bool hasBaseline = reader.readBool();
+        const TickNumber baselineTick = hasBaseline ? tick - reader.readVarint() : 0;
+        const f32 serverTime = reader.readFloat();
+        const f32 gameTime = reader.readFloat();
+        const i32 currentWave = static_cast<i32>(reader.readVarint());
+        const f32 timeToNextWave = reader.readFloat();
+        const SequenceNumber lastProcessedInput = reader.readVarint();
+        const u32 removedCount = reader.readBits(16);
+        const u32 recordCount = reader.readBits(16);
+        if (reader.hasError()) {
+            return false;
+        }
+        if (hasBaseline && (!baseline || baseline->tick != baselineTick)) {
+            return false;
+        }
+
+        Vector<EntitySnapshot>& entities = out.entities;
+        if (hasBaseline) {
+            entities = baseline->entities;
+        } else {
+            entities.clear();
+        }
+
+        if (removedCount > 0) {
+            Map<NetworkId, bool> removed;
+            removed.reserve(removedCount);
+            for (u32 i = 0; i < removedCount; ++i) {
+                removed[reader.readVarint()] = true;
+            }
+            if (reader.hasError()) {
+                return false;
+            }
+            entities.erase(std::remove_if(entities.begin(), entities.end(),
+                               [&removed](const EntitySnapshot& e) { return removed.count(e.networkId) > 0; }),
+                           entities.end());
+        }
+
+        Map<NetworkId, size_t> index;
+        index.reserve(entities.size() + recordCount);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            index[entities[i].networkId] = i;
+        }
+
+        for (u32 i = 0; i < recordCount; ++i) {
+            const NetworkId id = reader.readVarint();
+            const u16 mask = static_cast<u16>(reader.readBits(EntitySnapshotCodec::FIELD_MASK_BITS));
+            if (reader.hasError()) {
+                return false;
+            }
+            auto it = index.find(id);
+            if (it == index.end()) {
+                it = index.emplace(id, entities.size()).first;
+                entities.emplace_back();
+                entities.back().networkId = id;
+            }
+            EntitySnapshotCodec::read(reader, entities[it->second], mask);
+        }
+        if (reader.hasError()) {
+            return false;
+        }
+
+        for (auto& entity : entities) {
+            entity.tick = tick;
+        }
+
+        out.tick = tick;
+        out.serverTime = serverTime;
+        out.gameTime = gameTime;
+        out.currentWave = currentWave;
+        out.timeToNextWave = timeToNextWave;
+        out.lastProcessedInput = lastProcessedInput;
+        return true;
+    }
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "core/Types.h"
+#include "NetworkTypes.h"
+#include "BitStream.h"
+#include <algorithm>
+#include <cstring>
+
+namespace WorldEditor {
+
+// Splits an encoded snapshot into datagram-sized fragments. Each fragment carries the
+// snapshot tick, its index and the fragment count, followed by SNAPSHOT_FRAGMENT_SIZE
+// bytes of the snapshot (the last one carries the remainder). There is no resend: a
+// snapshot missing a fragment is simply never completed, the client does not acknowledge
+// it, and the server keeps sending deltas against the older baseline.
+class SnapshotFragmenter {
+public:
+    static constexpr size_t HEADER_SIZE = 6;    // Tick, index, count
+    static constexpr size_t MAX_SNAPSHOT_SIZE =
+        static_cast<size_t>(NetworkConfig::SNAPSHOT_FRAGMENT_SIZE) * NetworkConfig::MAX_SNAPSHOT_FRAGMENTS;
+
+    static u32 getFragmentCount(size_t snapshotSize) {
+        if (snapshotSize == 0) {
+            return 1;
+        }
+        return static_cast<u32>((snapshotSize + NetworkConfig::SNAPSHOT_FRAGMENT_SIZE - 1) /
+                                NetworkConfig::SNAPSHOT_FRAGMENT_SIZE);
+    }
+
+    // Writes fragment `index` (header and data) to out. Returns bytes written, or 0 if the
+    // snapshot has too many fragments, the index is out of range or out is too small.
+    static size_t writeFragment(const u8* snapshot, size_t snapshotSize, TickNumber tick, u32 index,
+                                u8* out, size_t outSize) {
+        const u32 count = getFragmentCount(snapshotSize);
+        if (count > NetworkConfig::MAX_SNAPSHOT_FRAGMENTS || index >= count) {
+            return 0;
+        }
+        const size_t offset = static_cast<size_t>(index) * NetworkConfig::SNAPSHOT_FRAGMENT_SIZE;
+        const size_t chunkSize = std::min<size_t>(snapshotSize - offset, NetworkConfig::SNAPSHOT_FRAGMENT_SIZE);
+        if (outSize < HEADER_SIZE + chunkSize) {
+            return 0;
+        }
+
+        BitWriter writer(out, HEADER_SIZE);
+        writer.writeBits(tick, 32);
+        writer.writeBits(index, 8);
+        writer.writeBits(count, 8);
+        memcpy(out + HEADER_SIZE, snapshot + offset, chunkSize);
+        return HEADER_SIZE + chunkSize;
+    }
+};
+
+// Collects the fragments of one snapshot at a time. A fragment of a newer tick abandons
+// the snapshot being assembled (its missing fragments were lost or are late); fragments
+// of older or already completed ticks are ignored. The buffer is allocated once.
+class SnapshotReassembler {
+public:
+    SnapshotReassembler() : buffer_(SnapshotFragmenter::MAX_SNAPSHOT_SIZE) {}
+
+    // Feeds one received fragment. Returns true once its snapshot is complete; outData and
+    // outSize then describe the whole encoded snapshot, valid until the next call. A
+    // snapshot that fits one fragment points straight into data without a copy.
+    bool add(const u8* data, size_t size, const u8*& outData, size_t& outSize) {
+        if (size < SnapshotFragmenter::HEADER_SIZE) {
+            return false;
+        }
+        BitReader reader(data, SnapshotFragmenter::HEADER_SIZE);
+        const TickNumber tick = reader.readBits(32);
+        const u32 index = reader.readBits(8);
+        const u32 count = reader.readBits(8);
+        const u8* chunk = data + SnapshotFragmenter::HEADER_SIZE;
+        const size_t chunkSize = size - SnapshotFragmenter::HEADER_SIZE;
+
+        // Every fragment but the last is full size
+        const bool last = index + 1 == count;
+        if (count == 0 || count > NetworkConfig::MAX_SNAPSHOT_FRAGMENTS || index >= count ||
+            chunkSize > NetworkConfig::SNAPSHOT_FRAGMENT_SIZE ||
+            (!last && chunkSize != NetworkConfig::SNAPSHOT_FRAGMENT_SIZE)) {
+            return false;
+        }
+
+        if (hasCompleted_ && tick <= completedTick_) {
+            return false;
+        }
+        if (assembling_ && tick != tick_) {
+            if (tick < tick_) {
+                return false;
+            }
+            assembling_ = false;
+            ++droppedCount_;
+        }
+
+        if (count == 1) {
+            complete(tick);
+            outData = chunk;
+            outSize = chunkSize;
+            return true;
+        }
+
+        if (!assembling_) {
+            assembling_ = true;
+            tick_ = tick;
+            count_ = count;
+            receivedMask_ = 0;
+            lastSize_ = 0;
+        }
+        const u32 bit = 1u << index;
+        if (count != count_ || (receivedMask_ & bit)) {
+            return false;
+        }
+
+        memcpy(buffer_.data() + static_cast<size_t>(index) * NetworkConfig::SNAPSHOT_FRAGMENT_SIZE,
+               chunk, chunkSize);
+        receivedMask_ |= bit;
+        if (last) {
+            lastSize_ = chunkSize;
+        }
+
+        const u32 allFragments = count_ == 32 ? 0xFFFFFFFFu : (1u << count_) - 1u;
+        if (receivedMask_ != allFragments) {
+            return false;
+        }
+        complete(tick);
+        outData = buffer_.data();
+        outSize = static_cast<size_t>(count_ - 1) * NetworkConfig::SNAPSHOT_FRAGMENT_SIZE + lastSize_;
+        return true;
+    }
+
+    void clear() {
+        assembling_ = false;
+        hasCompleted_ = false;
+        droppedCount_ = 0;
+    }
+
+    // Snapshots abandoned with fragments missing
+    u32 getDroppedCount() const { return droppedCount_; }
+
+private:
+    static_assert(NetworkConfig::MAX_SNAPSHOT_FRAGMENTS <= 32, "Received fragments are tracked in a u32 mask");
+
+    void complete(TickNumber tick) {
+        assembling_ = false;
+        hasCompleted_ = true;
+        completedTick_ = tick;
+    }
+
+    Vector<u8> buffer_;
+    bool assembling_ = false;
+    TickNumber tick_ = 0;
+    u32 count_ = 0;
+    u32 receivedMask_ = 0;
+    size_t lastSize_ = 0;
+    bool hasCompleted_ = false;
+    TickNumber completedTick_ = 0;
+    u32 droppedCount_ = 0;
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,181 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace WorldEditor {
+
+namespace {
+
+// Which JobSystem the current thread works for, and its queue index there
+thread_local const JobSystem* t_owner = nullptr;
+thread_local u32 t_queueIndex = 0;
+
+} // namespace
+
+JobSystem::JobSystem(const JobSystemConfig& config) {
+    u32 workerCount = 0;
+    if (config.workerCount >= 0) {
+        workerCount = static_cast<u32>(config.workerCount);
+    } else {
+        const u32 hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    queues_.reserve(workerCount + 1);
+    for (u32 i = 0; i < workerCount + 1; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    workers_.reserve(workerCount);
+    for (u32 i = 0; i < workerCount; ++i) {
+        workers_.emplace_back([this, i, pin = config.pinWorkers]() {
+            Profiler::setThreadName("JobWorker " + std::to_string(i));
+            if (pin && !pinCurrentThread(i + 1)) {
+                LOG_WARN("JobSystem: failed to pin worker {} to core {}", i, i + 1);
+            }
+            workerLoop(i + 1);
+        });
+    }
+
+    LOG_INFO("JobSystem started with {} worker(s)", workerCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    sleepCv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void JobSystem::submit(JobCounter& counter, Job job) {
+    counter.remaining.fetch_add(1, std::memory_order_relaxed);
+    if (workers_.empty()) {
+        job();
+        counter.remaining.fetch_sub(1, std::memory_order_release);
+        return;
+    }
+
+    {
+        // Counted before the push so runOne() never decrements below zero, and under the
+        // sleep mutex so a worker cannot miss the wakeup between its check and wait
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    WorkerQueue& queue = *queues_[currentQueueIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back([&counter, job = std::move(job)]() {
+            job();
+            counter.remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    sleepCv_.notify_one();
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    const u32 queueIndex = currentQueueIndex();
+    while (!counter.isDone()) {
+        if (!runOne(queueIndex)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::pinCurrentThread(u32 core) {
+#ifdef _WIN32
+    if (core >= sizeof(DWORD_PTR) * 8) {
+        return false;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << core) != 0;
+#elif defined(__linux__)
+    if (core >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)core;
+    return false;
+#endif
+}
+
+void JobSystem::workerLoop(u32 index) {
+    t_owner = this;
+    t_queueIndex = index;
+
+    while (true) {
+        if (runOne(index)) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleepCv_.wait(lock, [this]() {
+            return stopping_ || pending_.load(std::memory_order_relaxed) > 0;
+        });
+        if (stopping_) {
+            return;
+        }
+    }
+}
+
+bool JobSystem::runOne(u32 queueIndex) {
+    Job job;
+    if (!popLocal(queueIndex, job) && !steal(queueIndex, job)) {
+        return false;
+    }
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    job();
+    return true;
+}
+
+bool JobSystem::popLocal(u32 queueIndex, Job& job) {
+    WorkerQueue& queue = *queues_[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    return true;
+}
+
+bool JobSystem::steal(u32 thiefIndex, Job& job) {
+    const u32 count = static_cast<u32>(queues_.size());
+    // Start at the neighbour so thieves spread out instead of all hitting queue 0
+    for (u32 offset = 1; offset < count; ++offset) {
+        WorkerQueue& victim = *queues_[(thiefIndex + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.jobs.empty()) {
+            continue;
+        }
+        job = std::move(victim.jobs.front());
+        victim.jobs.pop_front();
+        return true;
+    }
+    return false;
+}
+
+u32 JobSystem::currentQueueIndex() const {
+    return t_owner == this ? t_queueIndex : 0u;
+}
+
+} // namespace WorldEditor
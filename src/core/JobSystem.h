@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace WorldEditor {
+
+// Counts outstanding jobs of one batch. JobSystem::wait() returns once it drops to zero.
+struct JobCounter {
+    std::atomic<u32> remaining{0};
+
+    bool isDone() const { return remaining.load(std::memory_order_acquire) == 0; }
+};
+
+struct JobSystemConfig {
+    i32 workerCount = -1;       // -1 = hardware threads - 1 (the calling thread also runs jobs)
+    bool pinWorkers = false;    // Pin worker i to core i + 1, leaving core 0 for the simulation thread
+};
+
+// Work-stealing job system.
+//
+// Every worker owns a deque: it pushes and pops its own jobs at the back (LIFO, cache warm)
+// and steals from the front of other deques when it runs dry. Threads that are not workers
+// (the simulation thread) submit into a shared deque and help execute jobs while waiting,
+// so nested parallelFor calls cannot deadlock.
+//
+// With zero workers everything runs inline on the caller, which is the serial fallback.
+class JobSystem {
+public:
+    using Job = std::function<void()>;
+
+    enum class ReduceMode : u8 {
+        Deterministic,  // Chunking depends only on count/grain, partials combined in chunk order
+        Fast            // One chunk per thread; result may depend on the thread count
+    };
+
+    explicit JobSystem(const JobSystemConfig& config = {});
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    u32 getWorkerCount() const { return static_cast<u32>(workers_.size()); }
+    u32 getThreadCount() const { return getWorkerCount() + 1; }
+
+    void submit(JobCounter& counter, Job job);
+
+    // Blocks until the counter reaches zero, executing queued jobs meanwhile
+    void wait(JobCounter& counter);
+
+    // Calls func(begin, end) over [0, count) in chunks of at most grain elements.
+    // Chunk 0 runs on the calling thread.
+    template<typename Func>
+    void parallelFor(u32 count, u32 grain, Func&& func) {
+        if (count == 0) {
+            return;
+        }
+        grain = grain > 0 ? grain : 1;
+        const u32 chunks = (count + grain - 1) / grain;
+        if (chunks == 1 || workers_.empty()) {
+            func(0u, count);
+            return;
+        }
+
+        JobCounter counter;
+        for (u32 chunk = 1; chunk < chunks; ++chunk) {
+            const u32 begin = chunk * grain;
+            const u32 end = begin + grain < count ? begin + grain : count;
+            submit(counter, [&func, begin, end]() { func(begin, end); });
+        }
+        func(0u, grain < count ? grain : count);
+        wait(counter);
+    }
+
+    // map(begin, end) -> T produces one partial per chunk, combine(T, T) -> T folds them.
+    // Deterministic mode gives bit-identical results for any worker count (including 0).
+    template<typename T, typename MapFunc, typename CombineFunc>
+    T parallelReduce(u32 count, u32 grain, T identity, MapFunc&& map, CombineFunc&& combine,
+                     ReduceMode mode = ReduceMode::Deterministic) {
+        static_assert(!std::is_same_v<T, bool>, "Vector<bool> partials cannot be written concurrently");
+        if (count == 0) {
+            return identity;
+        }
+        if (mode == ReduceMode::Fast) {
+            const u32 threads = getThreadCount();
+            grain = (count + threads - 1) / threads;
+        }
+        grain = grain > 0 ? grain : 1;
+
+        const u32 chunks = (count + grain - 1) / grain;
+        Vector<T> partials(chunks, identity);
+        parallelFor(chunks, 1, [&](u32 first, u32 last) {
+            for (u32 chunk = first; chunk < last; ++chunk) {
+                const u32 begin = chunk * grain;
+                const u32 end = begin + grain < count ? begin + grain : count;
+                partials[chunk] = map(begin, end);
+            }
+        });
+
+        T result = identity;
+        for (const T& partial : partials) {
+            result = combine(result, partial);
+        }
+        return result;
+    }
+
+    // Pin the calling thread to one logical core. Returns false where unsupported.
+    static bool pinCurrentThread(u32 core);
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    void workerLoop(u32 index);
+    bool runOne(u32 queueIndex);
+    bool popLocal(u32 queueIndex, Job& job);
+    bool steal(u32 thiefIndex, Job& job);
+    u32 currentQueueIndex() const;
+
+    // Queue 0 is shared by non-worker threads, queue i + 1 belongs to worker i
+    Vector<UniquePtr<WorkerQueue>> queues_;
+    Vector<std::thread> workers_;
+
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCv_;
+    std::atomic<u32> pending_{0};
+    bool stopping_ = false;
+};
+
+} // namespace WorldEditor
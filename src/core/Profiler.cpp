@@ -0,0 +1,202 @@
+#include "Profiler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace WorldEditor {
+
+namespace {
+
+struct ProfileEvent {
+    const char* name;
+    u64 startNs;
+    u64 durationNs;
+};
+
+struct ThreadRing {
+    u32 threadId = 0;
+    String threadName;
+    Vector<ProfileEvent> events;
+    std::atomic<u64> written{0};
+};
+
+struct ProfilerState {
+    std::mutex mutex;
+    Vector<std::shared_ptr<ThreadRing>> rings;     // Kept after thread exit so dumps stay valid
+    std::unordered_set<String> names;              // Node-based: pointers stay stable
+    u32 nextThreadId = 1;
+
+    std::atomic<bool> enabled{true};
+    std::atomic<bool> dumpRequested{false};
+    String dumpPath;
+
+    f64 slowTickMs = 0.0;
+    f64 slowTickCooldown = 10.0;
+    String slowTickDirectory;
+    u64 lastSlowDumpNs = 0;
+
+    u64 epochNs = Profiler::nowNs();
+};
+
+static_assert((Profiler::RING_CAPACITY & (Profiler::RING_CAPACITY - 1)) == 0, "Ring capacity must be a power of two");
+
+ProfilerState& state() {
+    static ProfilerState instance;
+    return instance;
+}
+
+ThreadRing& localRing() {
+    thread_local std::shared_ptr<ThreadRing> ring;
+    if (!ring) {
+        ring = std::make_shared<ThreadRing>();
+        ring->events.resize(Profiler::RING_CAPACITY);
+
+        auto& s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        ring->threadId = s.nextThreadId++;
+        ring->threadName = "Thread " + std::to_string(ring->threadId);
+        s.rings.push_back(ring);
+    }
+    return *ring;
+}
+
+void writeEscaped(std::ofstream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') {
+            out << '\\';
+        }
+        out << *c;
+    }
+}
+
+} // namespace
+
+void Profiler::setEnabled(bool enabled) {
+    state().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled() {
+    return state().enabled.load(std::memory_order_relaxed);
+}
+
+u64 Profiler::nowNs() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+void Profiler::record(const char* name, u64 startNs, u64 endNs) {
+    ThreadRing& ring = localRing();
+    const u64 index = ring.written.load(std::memory_order_relaxed);
+    ring.events[index & (RING_CAPACITY - 1)] = {name, startNs, endNs - startNs};
+    ring.written.store(index + 1, std::memory_order_release);
+}
+
+const char* Profiler::intern(const String& name) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    return s.names.insert(name).first->c_str();
+}
+
+void Profiler::setThreadName(const String& name) {
+    ThreadRing& ring = localRing();
+    std::lock_guard<std::mutex> lock(state().mutex);
+    ring.threadName = name;
+}
+
+bool Profiler::writeChromeTrace(const String& path) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        LOG_ERROR("Profiler: cannot write trace '{}'", path);
+        return false;
+    }
+
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+
+    char number[64];
+    size_t eventCount = 0;
+    bool first = true;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    for (const auto& ring : s.rings) {
+        out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":"
+            << ring->threadId << ",\"args\":{\"name\":\"";
+        writeEscaped(out, ring->threadName.c_str());
+        out << "\"}}";
+        first = false;
+
+        const u64 written = ring->written.load(std::memory_order_acquire);
+        const u64 begin = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+        for (u64 i = begin; i < written; ++i) {
+            const ProfileEvent& event = ring->events[i & (RING_CAPACITY - 1)];
+            // Chrome trace timestamps are microseconds
+            const f64 ts = static_cast<f64>(event.startNs - s.epochNs) / 1000.0;
+            const f64 dur = static_cast<f64>(event.durationNs) / 1000.0;
+            std::snprintf(number, sizeof(number), "%.3f,\"dur\":%.3f", ts, dur);
+
+            out << ",\n{\"ph\":\"X\",\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"pid\":1,\"tid\":" << ring->threadId << ",\"ts\":" << number << "}";
+            eventCount++;
+        }
+    }
+    out << "\n]}\n";
+
+    LOG_INFO("Profiler: wrote {} events to '{}'", eventCount, path);
+    return static_cast<bool>(out);
+}
+
+void Profiler::requestDump(const String& path) {
+    auto& s = state();
+    {
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.dumpPath = path;
+    }
+    s.dumpRequested.store(true, std::memory_order_release);
+}
+
+void Profiler::setSlowTickDump(f64 thresholdMs, const String& directory, f64 cooldownSeconds) {
+    auto& s = state();
+    std::lock_guard<std::mutex> lock(s.mutex);
+    s.slowTickMs = thresholdMs;
+    s.slowTickDirectory = directory;
+    s.slowTickCooldown = cooldownSeconds;
+}
+
+void Profiler::endTick(u64 tick, f64 tickMs) {
+    auto& s = state();
+
+    if (s.dumpRequested.exchange(false, std::memory_order_acq_rel)) {
+        String path;
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            path = s.dumpPath;
+        }
+        writeChromeTrace(path);
+    }
+
+    if (s.slowTickMs <= 0.0 || tickMs <= s.slowTickMs) {
+        return;
+    }
+
+    const u64 now = nowNs();
+    const u64 cooldownNs = static_cast<u64>(s.slowTickCooldown * 1e9);
+    if (s.lastSlowDumpNs != 0 && now - s.lastSlowDumpNs < cooldownNs) {
+        return;
+    }
+    s.lastSlowDumpNs = now;
+
+    char fileName[96];
+    std::snprintf(fileName, sizeof(fileName), "slow_tick_%llu_%.1fms.json",
+                  static_cast<unsigned long long>(tick), tickMs);
+    const String path = s.slowTickDirectory.empty() ? String(fileName) : s.slowTickDirectory + "/" + fileName;
+
+    LOG_WARN("Slow tick {}: {:.2f} ms (budget {:.2f} ms), dumping trace to {}", tick, tickMs, s.slowTickMs, path);
+    writeChromeTrace(path);
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Types.h"
+
+// Scoped-zone profiler. Zones are recorded into per-thread ring buffers (no locks on the
+// hot path) and exported as Chrome trace JSON, which chrome://tracing and Perfetto open.
+//
+// Zones compile out entirely unless WORLD_EDITOR_PROFILING is 1 (CMake option of the
+// same name). Zone names must outlive the trace: use string literals or Profiler::intern().
+
+#ifndef WORLD_EDITOR_PROFILING
+#define WORLD_EDITOR_PROFILING 0
+#endif
+
+namespace WorldEditor {
+
+class Profiler {
+public:
+    static constexpr u32 RING_CAPACITY = 16384;    // Events kept per thread (power of two)
+
+    // Runtime switch on top of the compile-time one (default on)
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    static u64 nowNs();
+    static void record(const char* name, u64 startNs, u64 endNs);
+
+    // Stable copy of a dynamic name, e.g. System::getName()
+    static const char* intern(const String& name);
+    static void setThreadName(const String& name);
+
+    // Write every buffered event. Call between ticks: rings are not locked against writers.
+    static bool writeChromeTrace(const String& path);
+
+    // Thread-safe (console/signal handlers); the dump happens in the next endTick()
+    static void requestDump(const String& path);
+
+    // Ticks slower than thresholdMs dump the buffered history into directory
+    // (at most one dump per cooldown so a stall does not flood the disk). 0 disables.
+    static void setSlowTickDump(f64 thresholdMs, const String& directory, f64 cooldownSeconds = 10.0);
+
+    // Call once per tick on the tick thread, after the tick finished
+    static void endTick(u64 tick, f64 tickMs);
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name)
+        : name_(name), startNs_(Profiler::isEnabled() ? Profiler::nowNs() : 0) {}
+
+    ~ProfileScope() {
+        if (startNs_ != 0) {
+            Profiler::record(name_, startNs_, Profiler::nowNs());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* name_;
+    u64 startNs_;
+};
+
+} // namespace WorldEditor
+
+#if WORLD_EDITOR_PROFILING
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_SCOPE(name) ::WorldEditor::ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -517,6 +517,8 @@ public:
     void GetGameServerTarget(std::string& ip, u16& port) const { ip = m_gameServerIp; port = m_gameServerPort; }
     const std::string& GetGameServerIp() const { return m_gameServerIp; }
     u16 GetGameServerPort() const { return m_gameServerPort; }
+    void SetGameServerLobby(u64 lobbyId) { m_gameServerLobbyId = lobbyId; }
+    u64 GetGameServerLobby() const { return m_gameServerLobbyId; }
     
     // Player team info (set by HeroPickState, used by InGameState)
     void SetPlayerTeam(u8 teamSlot) { m_playerTeamSlot = teamSlot; }
@@ -552,6 +554,7 @@ private:
     std::unique_ptr<::WorldEditor::Network::NetworkClient> m_networkClient;
     std::string m_gameServerIp;
     u16 m_gameServerPort = 0;
+    u64 m_gameServerLobbyId = 0;  // Selects our match on a multi-match server
     u8 m_playerTeamSlot = 0;  // 0-4 = Radiant, 5-9 = Dire
     bool m_gameInProgress = false;  // True when in active game (for "Return to Game" button)
 };
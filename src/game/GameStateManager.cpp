@@ -363,8 +363,9 @@ bool GameStateManager::ConnectToGameServer(const std::string& ip, u16 port, cons
     m_gameServerIp = ip;
     m_gameServerPort = port;
     
-    // Set username before connecting
+    // Set username and lobby before connecting
     m_networkClient->setUsername(username);
+    m_networkClient->setLobbyId(m_gameServerLobbyId);
     
     // Set accountId from AuthClient for reconnect support
     if (m_authClient && m_authClient->IsAuthenticated()) {
@@ -1358,7 +1358,17 @@ void InGameState::SendInputToServer() {
     WorldEditor::PlayerInput input;
     input.sequenceNumber = m_inputSequence++;
     input.commandType = WorldEditor::InputCommandType::None;
-    input.timestamp = static_cast<f32>(m_inputSequence) / 30.0f;
+    input.timestamp = m_clientWorld ? m_clientWorld->getViewTime() : 0.0f;
+    
+    // Where the camera looks on the ground; the server sends us the units around it
+    if (m_gameplayController) {
+        const auto& camera = m_gameplayController->getCamera();
+        const Vec3 forward = camera.getForwardLH();
+        if (forward.y < -0.01f) {
+            input.cameraFocus = camera.position + forward * (-camera.position.y / forward.y);
+            input.hasCameraFocus = true;
+        }
+    }
     
     if (!m_gameplayController || !m_gameWorld) {
         client->sendInput(input);
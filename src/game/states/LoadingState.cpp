@@ -239,6 +239,9 @@ void LoadingState::Update(f32 deltaTime) {
         m_serverWorld->addSystem(std::make_unique<::WorldEditor::ProjectileSystem>(entityManager));
         m_serverWorld->addSystem(std::make_unique<::WorldEditor::CollisionSystem>(entityManager));
         
+        // Client world: projectiles get mesh entities (the dedicated server keeps them headless)
+        entityManager.getProjectiles().setVisualsEnabled(true);
+        
         LOG_INFO("LoadingState: All game systems added");
         ConsoleLog("Game systems initialized: Hero, Creep, Tower, Projectile, Collision");
         
@@ -329,6 +329,7 @@ void MainMenuState::SetupMatchmakingCallbacks() {
         m_ui->matchmakingPanel->HideFindingUI();
 
         if (m_manager) {
+            m_manager->SetGameServerLobby(m_mmClient->getCurrentLobby().lobbyId);
             if (auto* loading = m_manager->GetLoadingState()) {
                 loading->SetServerTarget(serverIP, port);
                 loading->SetReconnect(false);
@@ -387,6 +388,7 @@ void MainMenuState::SetupReconnectCallbacks() {
         m_ui->reconnectPanel->Hide();
         
         if (m_manager) {
+            m_manager->SetGameServerLobby(m_mmClient->getActiveGameInfo().lobbyId);
             if (auto* loading = m_manager->GetLoadingState()) {
                 loading->SetServerTarget(serverIP, port);
                 loading->SetReconnect(true);
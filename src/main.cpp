@@ -952,13 +952,7 @@ int main(int argc, char* argv[]) {
                                         abilityRange = ability.data.castRange;
                                         
                                         // Set indicator color based on ability
-                                        if (ability.data.name.find("Fire") != String::npos) {
-                                            abilityIndicatorColor = Vec4(1.0f, 0.5f, 0.1f, 0.5f);
-                                        } else if (ability.data.name.find("Ice") != String::npos) {
-                                            abilityIndicatorColor = Vec4(0.6f, 0.9f, 1.0f, 0.5f);
-                                        } else {
-                                            abilityIndicatorColor = Vec4(0.4f, 0.6f, 1.0f, 0.5f);
-                                        }
+                                        abilityIndicatorColor = Vec4(Vec3(ability.data.color), 0.5f);
                                     } else {
                                         // NoTarget or Passive - cast immediately
                                         heroSystem->castAbility(playerHero, abilityIdx, Vec3(0), INVALID_ENTITY);
@@ -1707,6 +1701,9 @@ int main(int argc, char* argv[]) {
                         }
                     }
                     
+                    // Cliffs and ramps may have changed under the hero paths
+                    world.getEntityManager().markNavGridDirty();
+                    
                     terrainNeedsRebuild = false;
                     lastTerrainMeshUpdateTime = nowTime;
                     lastModifiedTerrain = INVALID_ENTITY;
@@ -2028,12 +2025,12 @@ int main(int argc, char* argv[]) {
                             if (objComp.type == WorldEditor::ObjectType::Tower || 
                                 objComp.type == WorldEditor::ObjectType::Building ||
                                 objComp.type == WorldEditor::ObjectType::Base) {
-                                auto& collision = world.addComponent<WorldEditor::CollisionComponent>(objE);
-                                collision.shape = WorldEditor::CollisionShape::Box;
+                                WorldEditor::CollisionComponent collision(WorldEditor::CollisionShape::Box);
                                 collision.boxSize = collisionSize;
                                 collision.isStatic = true;
                                 collision.isTrigger = false;
                                 collision.blocksMovement = true;
+                                world.addComponent<WorldEditor::CollisionComponent>(objE, collision);
                             }
                             
                             editorUI.setSelected(objE);
@@ -83,8 +83,8 @@ struct ServerRegisterPayload {
     char serverIp[kIpStringMax]{};
     u16 gamePort = 0;
     u16 controlPort = 0;
-    u16 capacity = 0;
-    u16 _reserved = 0;
+    u16 capacity = 0;       // Players across all match slots
+    u16 maxMatches = 0;     // Concurrent matches (0 = legacy server, one match)
 };
 
 struct ServerHeartbeatPayload {
@@ -92,6 +92,8 @@ struct ServerHeartbeatPayload {
     u16 currentPlayers = 0;
     u16 capacity = 0;
     f32 uptimeSeconds = 0.0f;
+    u16 activeMatches = 0;
+    u16 maxMatches = 0;
 };
 
 struct AssignLobbyPayload {
@@ -6,15 +6,19 @@ namespace Network {
 
 constexpr f32 CONNECTION_TIMEOUT = 5.0f;
 constexpr f32 PING_INTERVAL = 1.0f;
+constexpr f32 CONNECTION_RETRY_INTERVAL = 0.5f;  // After a rejection, until CONNECTION_TIMEOUT
 
 NetworkClient::NetworkClient()
     : state_(ConnectionState::Disconnected)
     , clientId_(INVALID_CLIENT_ID)
     , accountId_(0)
+    , lobbyId_(0)
     , connectionTimeout_(0.0f)
+    , connectionRetryTimer_(0.0f)
     , pingTimer_(0.0f)
     , lastPingTime_(0.0f)
     , rtt_(0.0f)
+    , latestSnapshot_(nullptr)
     , hasNewSnapshot_(false)
     , nextInputSequence_(1)
     , packetLoss_(0)
@@ -48,13 +52,25 @@ bool NetworkClient::connect(const char* serverIP, u16 serverPort) {
     
     serverAddress_ = NetworkAddress(serverIP, serverPort);
     state_ = ConnectionState::Connecting;
+    latestSnapshot_ = nullptr;
+    receivedSnapshots_.clear();
+    snapshotFragments_.clear();
     connectionTimeout_ = CONNECTION_TIMEOUT;
+    connectionRetryTimer_ = 0.0f;
     
+    sendConnectionRequest();
+    LOG_INFO("Connection request sent to {} (username: {}, accountId: {}, lobby: {})",
+             serverAddress_.toString(), username_, accountId_, lobbyId_);
+    return true;
+}
+
+void NetworkClient::sendConnectionRequest() {
     // Send connection request with username and accountId
     ConnectionRequestPayload payload;
     memset(&payload, 0, sizeof(payload));
     strncpy(payload.username, username_.c_str(), sizeof(payload.username) - 1);
     payload.accountId = accountId_;
+    payload.lobbyId = lobbyId_;
     
     PacketHeader header;
     header.type = PacketType::ConnectionRequest;
@@ -67,9 +83,6 @@ bool NetworkClient::connect(const char* serverIP, u16 serverPort) {
     
     socket_.sendTo(packet, sizeof(packet), serverAddress_);
     totalPacketsSent_++;
-    
-    LOG_INFO("Connection request sent to {} (username: {}, accountId: {})", serverAddress_.toString(), username_, accountId_);
-    return true;
 }
 
 void NetworkClient::disconnect() {
@@ -105,6 +118,13 @@ void NetworkClient::update(f32 deltaTime) {
             disconnect();
             return;
         }
+        
+        if (connectionRetryTimer_ > 0.0f) {
+            connectionRetryTimer_ -= deltaTime;
+            if (connectionRetryTimer_ <= 0.0f) {
+                sendConnectionRequest();
+            }
+        }
     }
     
     // Send periodic pings
@@ -160,6 +180,10 @@ void NetworkClient::handlePacket(const u8* data, size_t size) {
             handleConnectionRejected();
             break;
             
+        case PacketType::Disconnect:
+            handleServerDisconnect();
+            break;
+            
         case PacketType::WorldSnapshot:
             handleWorldSnapshot(payload, payloadSize);
             break;
@@ -217,30 +241,72 @@ void NetworkClient::handleConnectionAccepted(const u8* data, size_t size) {
 }
 
 void NetworkClient::handleConnectionRejected() {
-    LOG_ERROR("Connection rejected by server");
-    disconnect();
+    if (state_ != ConnectionState::Connecting) return;
+    
+    // Our lobby may not be assigned to this server yet; ask again until the timeout
+    LOG_WARN("Connection rejected by server, retrying");
+    if (connectionRetryTimer_ <= 0.0f) {
+        connectionRetryTimer_ = CONNECTION_RETRY_INTERVAL;
+    }
+}
+
+void NetworkClient::handleServerDisconnect() {
+    if (state_ != ConnectionState::Connected) return;
+    
+    // The server closed our match; nothing to send back
+    socket_.close();
+    state_ = ConnectionState::Disconnected;
+    clientId_ = INVALID_CLIENT_ID;
+    
+    LOG_INFO("Disconnected by server");
 }
 
 void NetworkClient::handleWorldSnapshot(const u8* data, size_t size) {
     if (state_ != ConnectionState::Connected) return;
     
-    if (size < sizeof(SnapshotHeader)) {
-        LOG_WARN("Invalid snapshot size: {} < {}", size, sizeof(SnapshotHeader));
+    // Snapshots larger than one datagram arrive in fragments; a lost fragment drops that
+    // snapshot (it is never acknowledged, so the server keeps our older baseline)
+    const u8* snapshotData = nullptr;
+    size_t snapshotSize = 0;
+    if (!snapshotFragments_.add(data, size, snapshotData, snapshotSize)) {
+        return;
+    }
+    
+    TickNumber tick = 0;
+    bool hasBaseline = false;
+    TickNumber baselineTick = 0;
+    if (!SnapshotDeltaCodec::peekHeader(snapshotData, snapshotSize, tick, hasBaseline, baselineTick)) {
+        LOG_WARN("Invalid snapshot header ({} bytes)", snapshotSize);
+        return;
+    }
+    
+    // Late arrivals are stale
+    if (latestSnapshot_ && tick <= latestSnapshot_->tick) {
+        return;
+    }
+    
+    // A delta against a baseline we no longer have cannot be rebuilt; the server moves on
+    // to a newer baseline (or a full snapshot) as our acks arrive
+    const WorldSnapshot* baseline = hasBaseline ? receivedSnapshots_.find(baselineTick) : nullptr;
+    if (hasBaseline && !baseline) {
         return;
     }
     
-    if (!latestSnapshot_.deserialize(data, size)) {
-        LOG_WARN("Failed to deserialize snapshot");
+    // Decoded straight from the datagram or reassembly buffer, then swapped into history
+    if (!SnapshotDeltaCodec::decode(snapshotData, snapshotSize, baseline, decodeSnapshot_)) {
+        LOG_WARN("Failed to decode snapshot");
         return;
     }
     
+    latestSnapshot_ = &receivedSnapshots_.store(decodeSnapshot_);
     hasNewSnapshot_ = true;
+    sendSnapshotAck(latestSnapshot_->tick);
     
     // Debug: log received snapshots periodically
     static int recvCount = 0;
     if (++recvCount % 300 == 1) {
-        LOG_INFO("Client received snapshot: tick={}, entities={}", 
-                 latestSnapshot_.tick, latestSnapshot_.entities.size());
+        LOG_INFO("Client received snapshot: tick={}, entities={}, fragments dropped={}", 
+                 latestSnapshot_->tick, latestSnapshot_->entities.size(), snapshotFragments_.getDroppedCount());
     }
 }
 
@@ -260,6 +326,20 @@ void NetworkClient::sendInput(const PlayerInput& input) {
     totalPacketsSent_++;
 }
 
+void NetworkClient::sendSnapshotAck(TickNumber tick) {
+    PacketHeader header;
+    header.type = PacketType::SnapshotAck;
+    header.sequence = 0;
+    header.payloadSize = sizeof(TickNumber);
+    
+    u8 packet[PacketHeader::SIZE + sizeof(TickNumber)];
+    memcpy(packet, &header, PacketHeader::SIZE);
+    memcpy(packet + PacketHeader::SIZE, &tick, sizeof(TickNumber));
+    
+    socket_.sendTo(packet, sizeof(packet), serverAddress_);
+    totalPacketsSent_++;
+}
+
 void NetworkClient::sendPing() {
     PacketHeader header;
     header.type = PacketType::Ping;
@@ -3,6 +3,8 @@
 #include "NetworkCommon.h"
 #include "common/GameInput.h"
 #include "common/GameSnapshot.h"
+#include "common/SnapshotDelta.h"
+#include "common/SnapshotFragments.h"
 
 namespace WorldEditor {
 namespace Network {
@@ -36,6 +38,10 @@ public:
     void setAccountId(u64 accountId) { accountId_ = accountId; }
     u64 getAccountId() const { return accountId_; }
     
+    // Set matchmaking lobby before connecting (routes us to our match on a multi-match server)
+    void setLobbyId(u64 lobbyId) { lobbyId_ = lobbyId; }
+    u64 getLobbyId() const { return lobbyId_; }
+    
     // Input sending
     void sendInput(const PlayerInput& input);
     
@@ -57,11 +63,11 @@ public:
     
     // Snapshot receiving
     bool hasNewSnapshot() const { return hasNewSnapshot_; }
-    const WorldSnapshot& getLatestSnapshot() const { return latestSnapshot_; }
+    const WorldSnapshot& getLatestSnapshot() const { return latestSnapshot_ ? *latestSnapshot_ : emptySnapshot_; }
     void clearNewSnapshotFlag() { hasNewSnapshot_ = false; }
     
     // Game time from server (from latest snapshot)
-    f32 getServerGameTime() const { return latestSnapshot_.gameTime; }
+    f32 getServerGameTime() const { return getLatestSnapshot().gameTime; }
     
     // State
     ConnectionState getState() const { return state_; }
@@ -77,12 +83,15 @@ private:
     void handlePacket(const u8* data, size_t size);
     void handleConnectionAccepted(const u8* data, size_t size);
     void handleConnectionRejected();
+    void handleServerDisconnect();
     void handleWorldSnapshot(const u8* data, size_t size);
     void handleHeroPickBroadcast(const u8* data, size_t size);
     void handleAllHeroesPicked(const u8* data, size_t size);
     void handleHeroPickTimer(const u8* data, size_t size);
     void handleTeamAssignment(const u8* data, size_t size);
     void handlePlayerInfo(const u8* data, size_t size);
+    void sendSnapshotAck(TickNumber tick);
+    void sendConnectionRequest();
     void sendPing();
     void handlePong();
     
@@ -92,16 +101,22 @@ private:
     ClientId clientId_;
     std::string username_;  // Player's username
     u64 accountId_;         // Auth account ID for reconnect support
+    u64 lobbyId_;           // Matchmaking lobby (0 = any open match)
     
     // Timing
     f32 connectionTimeout_;
+    f32 connectionRetryTimer_;  // Counts down to the next request after a rejection
     f32 pingTimer_;
     f32 lastPingTime_;
     f32 rtt_;  // Round-trip time
     
     // Snapshots
-    WorldSnapshot latestSnapshot_;
+    const WorldSnapshot* latestSnapshot_;   // Lives in receivedSnapshots_; null until the first one
+    WorldSnapshot emptySnapshot_;
     bool hasNewSnapshot_;
+    SnapshotHistory receivedSnapshots_;     // Baselines for the server's deltas
+    SnapshotReassembler snapshotFragments_;
+    WorldSnapshot decodeSnapshot_;          // Decode target, swapped into receivedSnapshots_
     
     // Sequence numbers
     SequenceNumber nextInputSequence_;
@@ -42,6 +42,7 @@ enum class PacketType : u8 {
     // Reliability
     Ping = 20,
     Pong = 21,
+    SnapshotAck = 22,        // Client -> Server: newest snapshot tick reconstructed
     
     // Game events
     GameEvent = 30
@@ -100,6 +101,7 @@ struct PlayerInfoPayload {
 struct ConnectionRequestPayload {
     char username[32];
     u64 accountId;  // Auth account ID for reconnect support
+    u64 lobbyId;    // Matchmaking lobby to join on a multi-match server (0 = any open match)
 };
 
 // ============ Network Address ============
@@ -122,6 +124,11 @@ struct NetworkAddress {
                addr.sin_port == other.addr.sin_port;
     }
     
+    // Packed ip:port, used as a hash key for connection lookup
+    u64 toKey() const {
+        return (static_cast<u64>(addr.sin_addr.s_addr) << 16) | addr.sin_port;
+    }
+    
     String toString() const {
         char ip[INET_ADDRSTRLEN];
         inet_ntop(AF_INET, &addr.sin_addr, ip, INET_ADDRSTRLEN);
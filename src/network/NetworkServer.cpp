@@ -1,18 +1,26 @@
 #include "NetworkServer.h"
 #include "server/ServerWorld.h"
+#include "core/Profiler.h"
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 
 namespace WorldEditor {
 namespace Network {
 
+static_assert(PacketHeader::SIZE + SnapshotFragmenter::HEADER_SIZE + NetworkConfig::SNAPSHOT_FRAGMENT_SIZE <= MAX_PACKET_SIZE,
+              "A snapshot fragment must fit one packet");
+
+// Below this a snapshot would be little more than its header; wait for the budget to refill
+constexpr f32 MIN_SNAPSHOT_BUDGET = 128.0f;
+
 NetworkServer::NetworkServer()
     : running_(false)
     , port_(0)
     , nextClientId_(1)
     , nextSequence_(1)
-    , inHeroPickPhase_(false)
-    , heroPickTimer_(0.0f)
-    , heroPickTimerBroadcastInterval_(0.0f)
+    , snapshotBuffer_(SnapshotFragmenter::MAX_SNAPSHOT_SIZE)
+    , snapshotBandwidth_(NetworkConfig::SNAPSHOT_BANDWIDTH)
     , totalPacketsSent_(0)
     , totalPacketsReceived_(0)
     , totalBytesSent_(0)
@@ -55,6 +63,8 @@ void NetworkServer::stop() {
         }
     }
     clients_.clear();
+    addressToClient_.clear();
+    matches_.clear();
     
     socket_.close();
     running_ = false;
@@ -68,10 +78,20 @@ void NetworkServer::update(f32 deltaTime) {
     
     receivePackets();
     checkClientTimeouts(deltaTime);
+    updateSnapshotBudgets(deltaTime);
     updateHeroPickPhase(deltaTime);
 }
 
+void NetworkServer::updateSnapshotBudgets(f32 deltaTime) {
+    const f32 bandwidth = static_cast<f32>(snapshotBandwidth_);
+    const f32 burst = std::max(bandwidth * NetworkConfig::SNAPSHOT_BURST_TIME, MIN_SNAPSHOT_BUDGET);
+    for (auto& [clientId, client] : clients_) {
+        client.snapshotBudget = std::min(client.snapshotBudget + bandwidth * deltaTime, burst);
+    }
+}
+
 void NetworkServer::receivePackets() {
+    PROFILE_SCOPE("NetworkServer::receivePackets");
     u8 buffer[MAX_PACKET_SIZE];
     NetworkAddress sender;
     
@@ -115,6 +135,14 @@ void NetworkServer::handlePacket(const NetworkAddress& sender, const u8* data, s
             break;
         }
             
+        case PacketType::SnapshotAck: {
+            ClientId clientId = findClientByAddress(sender);
+            if (clientId != INVALID_CLIENT_ID) {
+                handleSnapshotAck(clientId, payload, payloadSize);
+            }
+            break;
+        }
+            
         case PacketType::Disconnect: {
             ClientId clientId = findClientByAddress(sender);
             if (clientId != INVALID_CLIENT_ID) {
@@ -161,9 +189,31 @@ void NetworkServer::handleConnectionRequest(const NetworkAddress& sender, const
         return;
     }
     
-    // Check max clients
-    if (clients_.size() >= MAX_CLIENTS) {
-        LOG_WARN("Server full, rejecting connection from {}", sender.toString());
+    // Parse username, accountId and lobbyId from payload (older clients omit the lobby)
+    std::string username = "Player";
+    u64 accountId = 0;
+    u64 lobbyId = 0;
+    if (size >= offsetof(ConnectionRequestPayload, lobbyId)) {
+        ConnectionRequestPayload reqPayload{};
+        memcpy(&reqPayload, data, std::min(size, sizeof(ConnectionRequestPayload)));
+        username = std::string(reqPayload.username, strnlen(reqPayload.username, sizeof(reqPayload.username)));
+        accountId = reqPayload.accountId;
+        if (size >= sizeof(ConnectionRequestPayload)) {
+            lobbyId = reqPayload.lobbyId;
+        }
+        if (username.empty()) {
+            username = "Player";
+        }
+    }
+    
+    // Pick the match, then check that match's player limit
+    u64 matchId = 0;
+    bool admitted = matchResolver_ ? matchResolver_(lobbyId, matchId) : true;
+    if (admitted && getMatchClientCount(matchId) >= MAX_CLIENTS) {
+        admitted = false;
+    }
+    if (!admitted) {
+        LOG_WARN("No room for lobby {}, rejecting connection from {}", lobbyId, sender.toString());
         
         PacketHeader rejectHeader;
         rejectHeader.type = PacketType::ConnectionRejected;
@@ -174,19 +224,6 @@ void NetworkServer::handleConnectionRequest(const NetworkAddress& sender, const
         return;
     }
     
-    // Parse username and accountId from payload
-    std::string username = "Player";
-    u64 accountId = 0;
-    if (size >= sizeof(ConnectionRequestPayload)) {
-        ConnectionRequestPayload reqPayload;
-        memcpy(&reqPayload, data, sizeof(ConnectionRequestPayload));
-        username = std::string(reqPayload.username, strnlen(reqPayload.username, sizeof(reqPayload.username)));
-        accountId = reqPayload.accountId;
-        if (username.empty()) {
-            username = "Player";
-        }
-    }
-    
     // Accept connection
     ClientId newClientId = allocateClientId();
     
@@ -196,8 +233,12 @@ void NetworkServer::handleConnectionRequest(const NetworkAddress& sender, const
     client.lastHeartbeat = 0.0f;
     client.username = username;
     client.accountId = accountId;
+    client.matchId = matchId;
+    addressToClient_[sender.toKey()] = newClientId;
+    matches_[matchId].clients.push_back(newClientId);
     
-    LOG_INFO("Client {} ({}) connected from {} (ID: {})", username, clients_.size(), sender.toString(), newClientId);
+    LOG_INFO("Client {} ({}) connected from {} (ID: {}, match {})",
+             username, clients_.size(), sender.toString(), newClientId, matchId);
     
     // Send acceptance
     struct AcceptPayload {
@@ -256,9 +297,43 @@ void NetworkServer::handleDisconnect(ClientId clientId) {
         onClientDisconnected_(clientId);
     }
     
+    addressToClient_.erase(it->second.address.toKey());
+    auto matchIt = matches_.find(it->second.matchId);
+    if (matchIt != matches_.end()) {
+        auto& matchClients = matchIt->second.clients;
+        matchClients.erase(std::remove(matchClients.begin(), matchClients.end(), clientId), matchClients.end());
+        if (matchClients.empty()) {
+            matches_.erase(matchIt);
+        }
+    }
+    
     clients_.erase(it);
 }
 
+void NetworkServer::disconnectMatch(u64 matchId) {
+    auto matchIt = matches_.find(matchId);
+    if (matchIt == matches_.end()) return;
+    
+    // Copy: handleDisconnect edits the list and erases the session with its last client
+    const Vector<ClientId> matchClients = matchIt->second.clients;
+    
+    PacketHeader header;
+    header.type = PacketType::Disconnect;
+    header.payloadSize = 0;
+    
+    for (ClientId clientId : matchClients) {
+        auto it = clients_.find(clientId);
+        if (it == clients_.end()) continue;
+        
+        header.sequence = nextSequence_++;
+        socket_.sendTo(&header, PacketHeader::SIZE, it->second.address);
+        totalPacketsSent_++;
+        totalBytesSent_ += PacketHeader::SIZE;
+        
+        handleDisconnect(clientId);
+    }
+}
+
 void NetworkServer::checkClientTimeouts(f32 deltaTime) {
     Vector<ClientId> timedOutClients;
     
@@ -277,12 +352,8 @@ void NetworkServer::checkClientTimeouts(f32 deltaTime) {
 }
 
 ClientId NetworkServer::findClientByAddress(const NetworkAddress& addr) const {
-    for (const auto& [clientId, client] : clients_) {
-        if (client.address == addr) {
-            return clientId;
-        }
-    }
-    return INVALID_CLIENT_ID;
+    auto it = addressToClient_.find(addr.toKey());
+    return (it != addressToClient_.end()) ? it->second : INVALID_CLIENT_ID;
 }
 
 ClientId NetworkServer::allocateClientId() {
@@ -293,42 +364,117 @@ bool NetworkServer::isClientConnected(ClientId clientId) const {
     return clients_.find(clientId) != clients_.end();
 }
 
+size_t NetworkServer::getMatchClientCount(u64 matchId) const {
+    auto it = matches_.find(matchId);
+    return (it != matches_.end()) ? it->second.clients.size() : 0;
+}
+
+bool NetworkServer::isInHeroPickPhase(u64 matchId) const {
+    auto it = matches_.find(matchId);
+    return it != matches_.end() && it->second.inHeroPickPhase;
+}
+
+void NetworkServer::sendToMatch(u64 matchId, const void* packet, size_t size) {
+    auto it = matches_.find(matchId);
+    if (it == matches_.end()) return;
+    
+    for (ClientId clientId : it->second.clients) {
+        socket_.sendTo(packet, size, clients_[clientId].address);
+    }
+    
+    totalPacketsSent_ += it->second.clients.size();
+    totalBytesSent_ += size * it->second.clients.size();
+}
+
 void NetworkServer::sendSnapshotToClient(ClientId clientId, const WorldSnapshot& snapshot) {
     auto it = clients_.find(clientId);
     if (it == clients_.end()) return;
     
-    // Serialize snapshot to buffer
-    u8 snapshotBuffer[MAX_PACKET_SIZE - PacketHeader::SIZE];
-    size_t snapshotSize = snapshot.serialize(snapshotBuffer, sizeof(snapshotBuffer));
+    ConnectedClient& client = it->second;
+    if (client.sentSnapshots.find(snapshot.tick)) {
+        return; // No tick since the last send
+    }
     
-    if (snapshotSize == 0) {
-        LOG_WARN("Failed to serialize snapshot (too many entities?)");
+    // Delta against the newest snapshot the client acknowledged; full while there is none
+    const WorldSnapshot* baseline = client.hasAckedSnapshot
+        ? client.sentSnapshots.find(client.lastAckedSnapshot)
+        : nullptr;
+    
+    // A saturated link skips ticks rather than queueing datagrams for the OS to drop
+    if (client.snapshotBudget < MIN_SNAPSHOT_BUDGET) {
         return;
     }
     
-    PacketHeader header;
-    header.type = PacketType::WorldSnapshot;
-    header.sequence = nextSequence_++;
-    header.payloadSize = static_cast<u16>(snapshotSize);
+    // Highest-priority records first; what does not fit the budget waits for a later tick
+    // with its priority still growing
+    const size_t budget = std::min(snapshotBuffer_.size(), static_cast<size_t>(client.snapshotBudget));
+    size_t snapshotSize = 0;
+    WorldSnapshot sent;
+    {
+        PROFILE_SCOPE("SnapshotDeltaCodec::encode");
+        const Vector<u32>& order = client.replication.schedule(snapshot, clientId);
+        snapshotSize = SnapshotDeltaCodec::encode(snapshot, baseline, snapshotBuffer_.data(), budget, sent,
+                                                  &order, &deferredRecords_);
+    }
     
-    u8 packet[MAX_PACKET_SIZE];
-    memcpy(packet, &header, PacketHeader::SIZE);
-    memcpy(packet + PacketHeader::SIZE, snapshotBuffer, snapshotSize);
+    if (snapshotSize == 0) {
+        LOG_WARN("Failed to encode snapshot for client {}", clientId);
+        return;
+    }
+    client.replication.finish(deferredRecords_);
+    client.sentSnapshots.add(sent);
+    client.lastSentSnapshot = snapshot.tick;
     
-    size_t packetSize = PacketHeader::SIZE + snapshotSize;
-    socket_.sendTo(packet, packetSize, it->second.address);
+    const u32 fragmentCount = SnapshotFragmenter::getFragmentCount(snapshotSize);
+    for (u32 fragment = 0; fragment < fragmentCount; ++fragment) {
+        u8 packet[MAX_PACKET_SIZE];
+        const size_t fragmentSize = SnapshotFragmenter::writeFragment(
+            snapshotBuffer_.data(), snapshotSize, snapshot.tick, fragment,
+            packet + PacketHeader::SIZE, sizeof(packet) - PacketHeader::SIZE);
+        
+        PacketHeader header;
+        header.type = PacketType::WorldSnapshot;
+        header.sequence = nextSequence_++;
+        header.payloadSize = static_cast<u16>(fragmentSize);
+        memcpy(packet, &header, PacketHeader::SIZE);
+        
+        size_t packetSize = PacketHeader::SIZE + fragmentSize;
+        {
+            PROFILE_SCOPE("NetworkServer::sendTo");
+            socket_.sendTo(packet, packetSize, client.address);
+        }
+        
+        totalPacketsSent_++;
+        totalBytesSent_ += packetSize;
+        client.snapshotBudget -= static_cast<f32>(packetSize);
+    }
+}
+
+void NetworkServer::handleSnapshotAck(ClientId clientId, const u8* data, size_t size) {
+    if (size < sizeof(TickNumber)) {
+        LOG_WARN("Invalid snapshot ack size from client {}", clientId);
+        return;
+    }
     
-    totalPacketsSent_++;
-    totalBytesSent_ += packetSize;
+    TickNumber tick = 0;
+    memcpy(&tick, data, sizeof(TickNumber));
+    
+    auto& client = clients_[clientId];
+    client.lastHeartbeat = 0.0f;
+    client.acknowledgeSnapshot(tick);
 }
 
-void NetworkServer::sendSnapshotToAll(const WorldSnapshot& snapshot) {
-    for (const auto& [clientId, client] : clients_) {
+void NetworkServer::sendSnapshotToMatch(u64 matchId, const WorldSnapshot& snapshot) {
+    PROFILE_SCOPE("NetworkServer::sendSnapshotToMatch");
+    auto it = matches_.find(matchId);
+    if (it == matches_.end()) return;
+    
+    for (ClientId clientId : it->second.clients) {
         sendSnapshotToClient(clientId, snapshot);
     }
 }
 
-void NetworkServer::broadcastGameEvent(const void* eventData, size_t size) {
+void NetworkServer::broadcastGameEvent(u64 matchId, const void* eventData, size_t size) {
     if (size > MAX_PACKET_SIZE - PacketHeader::SIZE) {
         LOG_ERROR("Game event too large: {} bytes", size);
         return;
@@ -343,22 +489,19 @@ void NetworkServer::broadcastGameEvent(const void* eventData, size_t size) {
     memcpy(packet, &header, PacketHeader::SIZE);
     memcpy(packet + PacketHeader::SIZE, eventData, size);
     
-    size_t packetSize = PacketHeader::SIZE + size;
-    
-    for (const auto& [clientId, client] : clients_) {
-        socket_.sendTo(packet, packetSize, client.address);
-    }
-    
-    totalPacketsSent_ += clients_.size();
-    totalBytesSent_ += packetSize * clients_.size();
+    sendToMatch(matchId, packet, PacketHeader::SIZE + size);
 }
 
 // ============ Hero Pick Phase ============
 
-void NetworkServer::startHeroPickPhase(f32 pickTime) {
-    inHeroPickPhase_ = true;
-    heroPickTimer_ = pickTime;
-    heroPickTimerBroadcastInterval_ = 0.0f;
+void NetworkServer::startHeroPickPhase(u64 matchId, f32 pickTime) {
+    auto matchIt = matches_.find(matchId);
+    if (matchIt == matches_.end()) return;
+    
+    MatchSession& session = matchIt->second;
+    session.inHeroPickPhase = true;
+    session.heroPickTimer = pickTime;
+    session.heroPickTimerBroadcastInterval = 0.0f;
     
     // Reset all client pick states and assign teams
     // Radiant: slots 0-4, Dire: slots 5-9
@@ -366,7 +509,8 @@ void NetworkServer::startHeroPickPhase(f32 pickTime) {
     u8 radiantCount = 0;
     u8 direCount = 0;
     
-    for (auto& [clientId, client] : clients_) {
+    for (ClientId clientId : session.clients) {
+        ConnectedClient& client = clients_[clientId];
         client.pickedHero.clear();
         client.hasConfirmedPick = false;
         
@@ -389,14 +533,14 @@ void NetworkServer::startHeroPickPhase(f32 pickTime) {
         sendTeamAssignment(clientId, client.teamSlot);
     }
     
-    LOG_INFO("Hero pick phase started with {} seconds. Radiant: {}, Dire: {}", 
-             pickTime, radiantCount, direCount);
+    LOG_INFO("Hero pick phase started in match {} with {} seconds. Radiant: {}, Dire: {}", 
+             matchId, pickTime, radiantCount, direCount);
     
     // Broadcast all player info so everyone knows who's in the game
-    broadcastAllPlayerInfo();
+    broadcastAllPlayerInfo(matchId);
     
     // Broadcast initial timer
-    broadcastPickTimer(heroPickTimer_, 0);
+    broadcastPickTimer(matchId, session.heroPickTimer, 0);
 }
 
 void NetworkServer::sendTeamAssignment(ClientId clientId, u8 teamSlot) {
@@ -445,50 +589,65 @@ void NetworkServer::broadcastPlayerInfo(ClientId playerId) {
     memcpy(packet, &header, PacketHeader::SIZE);
     memcpy(packet + PacketHeader::SIZE, &payload, sizeof(PlayerInfoPayload));
     
-    for (const auto& [clientId, client] : clients_) {
-        socket_.sendTo(packet, sizeof(packet), client.address);
-    }
-    
-    totalPacketsSent_ += clients_.size();
+    sendToMatch(it->second.matchId, packet, sizeof(packet));
 }
 
-void NetworkServer::broadcastAllPlayerInfo() {
-    for (const auto& [clientId, client] : clients_) {
+void NetworkServer::broadcastAllPlayerInfo(u64 matchId) {
+    auto it = matches_.find(matchId);
+    if (it == matches_.end()) return;
+    
+    for (ClientId clientId : it->second.clients) {
         broadcastPlayerInfo(clientId);
     }
 }
 
 void NetworkServer::updateHeroPickPhase(f32 deltaTime) {
-    if (!inHeroPickPhase_) return;
+    // Callbacks may start or end matches, so walk a copy of the ids
+    Vector<u64> picking;
+    for (const auto& [matchId, session] : matches_) {
+        if (session.inHeroPickPhase) {
+            picking.push_back(matchId);
+        }
+    }
     
-    heroPickTimer_ -= deltaTime;
-    heroPickTimerBroadcastInterval_ += deltaTime;
+    for (u64 matchId : picking) {
+        auto it = matches_.find(matchId);
+        if (it != matches_.end()) {
+            updateHeroPickPhase(matchId, it->second, deltaTime);
+        }
+    }
+}
+
+void NetworkServer::updateHeroPickPhase(u64 matchId, MatchSession& session, f32 deltaTime) {
+    session.heroPickTimer -= deltaTime;
+    session.heroPickTimerBroadcastInterval += deltaTime;
     
     // Broadcast timer every second
-    if (heroPickTimerBroadcastInterval_ >= 1.0f) {
-        heroPickTimerBroadcastInterval_ = 0.0f;
-        broadcastPickTimer(heroPickTimer_, 0);
+    if (session.heroPickTimerBroadcastInterval >= 1.0f) {
+        session.heroPickTimerBroadcastInterval = 0.0f;
+        broadcastPickTimer(matchId, session.heroPickTimer, 0);
     }
     
     // Check if all players have picked
-    if (allPlayersHavePicked()) {
-        LOG_INFO("All players have picked their heroes!");
-        inHeroPickPhase_ = false;
-        broadcastAllPicked(static_cast<u8>(clients_.size()), 3.0f);
+    if (allPlayersHavePicked(matchId)) {
+        LOG_INFO("All players in match {} have picked their heroes!", matchId);
+        session.inHeroPickPhase = false;
+        broadcastAllPicked(matchId, static_cast<u8>(session.clients.size()), 3.0f);
         
         if (onAllPicked_) {
-            onAllPicked_();
+            onAllPicked_(matchId);
         }
     }
     // Timer expired - force random picks for those who haven't picked
-    else if (heroPickTimer_ <= 0.0f) {
-        LOG_INFO("Hero pick timer expired!");
+    else if (session.heroPickTimer <= 0.0f) {
+        LOG_INFO("Hero pick timer expired in match {}!", matchId);
         
         // Auto-pick for players who haven't picked
         const char* defaultHeroes[] = {"Axe", "Juggernaut", "Invoker", "Crystal Maiden", "Pudge"};
         int heroIdx = 0;
         
-        for (auto& [clientId, client] : clients_) {
+        for (ClientId clientId : session.clients) {
+            ConnectedClient& client = clients_[clientId];
             if (!client.hasConfirmedPick) {
                 client.pickedHero = defaultHeroes[heroIdx % 5];
                 client.hasConfirmedPick = true;
@@ -502,11 +661,11 @@ void NetworkServer::updateHeroPickPhase(f32 deltaTime) {
             }
         }
         
-        inHeroPickPhase_ = false;
-        broadcastAllPicked(static_cast<u8>(clients_.size()), 3.0f);
+        session.inHeroPickPhase = false;
+        broadcastAllPicked(matchId, static_cast<u8>(session.clients.size()), 3.0f);
         
         if (onAllPicked_) {
-            onAllPicked_();
+            onAllPicked_(matchId);
         }
     }
 }
@@ -557,14 +716,10 @@ void NetworkServer::broadcastHeroPick(ClientId playerId, const std::string& hero
     memcpy(packet, &header, PacketHeader::SIZE);
     memcpy(packet + PacketHeader::SIZE, &payload, sizeof(HeroPickBroadcastPayload));
     
-    for (const auto& [clientId, client] : clients_) {
-        socket_.sendTo(packet, sizeof(packet), client.address);
-    }
-    
-    totalPacketsSent_ += clients_.size();
+    sendToMatch(getClientMatch(playerId), packet, sizeof(packet));
 }
 
-void NetworkServer::broadcastPickTimer(f32 timeRemaining, u8 phase) {
+void NetworkServer::broadcastPickTimer(u64 matchId, f32 timeRemaining, u8 phase) {
     HeroPickTimerPayload payload;
     payload.timeRemaining = timeRemaining;
     payload.currentPhase = phase;
@@ -578,12 +733,10 @@ void NetworkServer::broadcastPickTimer(f32 timeRemaining, u8 phase) {
     memcpy(packet, &header, PacketHeader::SIZE);
     memcpy(packet + PacketHeader::SIZE, &payload, sizeof(HeroPickTimerPayload));
     
-    for (const auto& [clientId, client] : clients_) {
-        socket_.sendTo(packet, sizeof(packet), client.address);
-    }
+    sendToMatch(matchId, packet, sizeof(packet));
 }
 
-void NetworkServer::broadcastAllPicked(u8 playerCount, f32 startDelay) {
+void NetworkServer::broadcastAllPicked(u64 matchId, u8 playerCount, f32 startDelay) {
     AllHeroesPickedPayload payload;
     payload.playerCount = playerCount;
     payload.gameStartDelay = startDelay;
@@ -597,18 +750,17 @@ void NetworkServer::broadcastAllPicked(u8 playerCount, f32 startDelay) {
     memcpy(packet, &header, PacketHeader::SIZE);
     memcpy(packet + PacketHeader::SIZE, &payload, sizeof(AllHeroesPickedPayload));
     
-    for (const auto& [clientId, client] : clients_) {
-        socket_.sendTo(packet, sizeof(packet), client.address);
-    }
+    sendToMatch(matchId, packet, sizeof(packet));
     
-    LOG_INFO("Broadcasted AllHeroesPicked to {} clients", clients_.size());
+    LOG_INFO("Broadcasted AllHeroesPicked to {} clients in match {}", getMatchClientCount(matchId), matchId);
 }
 
-bool NetworkServer::allPlayersHavePicked() const {
-    if (clients_.empty()) return false;
+bool NetworkServer::allPlayersHavePicked(u64 matchId) const {
+    auto it = matches_.find(matchId);
+    if (it == matches_.end() || it->second.clients.empty()) return false;
     
-    for (const auto& [clientId, client] : clients_) {
-        if (!client.hasConfirmedPick) {
+    for (ClientId clientId : it->second.clients) {
+        if (!clients_.at(clientId).hasConfirmedPick) {
             return false;
         }
     }
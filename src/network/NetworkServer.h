@@ -3,6 +3,9 @@
 #include "NetworkCommon.h"
 #include "common/GameInput.h"
 #include "common/GameSnapshot.h"
+#include "common/SnapshotDelta.h"
+#include "common/SnapshotFragments.h"
+#include "common/ReplicationScheduler.h"
 #include <unordered_map>
 
 namespace WorldEditor {
@@ -21,6 +24,15 @@ struct ConnectedClient {
     SequenceNumber lastReceivedInput;
     SequenceNumber lastSentSnapshot;
     
+    // Delta baselines: what this client was sent, and the newest tick it acknowledged
+    SnapshotHistory sentSnapshots;
+    TickNumber lastAckedSnapshot;
+    bool hasAckedSnapshot;
+    
+    // Bandwidth: which records go first, and snapshot bytes this client may still be sent
+    ReplicationScheduler replication;
+    f32 snapshotBudget;
+    
     // Player info
     std::string username;
     u64 accountId;  // Auth account ID for reconnect support
@@ -30,14 +42,36 @@ struct ConnectedClient {
     u8 teamSlot;
     bool hasConfirmedPick;
     
+    // Match this connection belongs to (one socket serves every hosted match)
+    u64 matchId;
+    
     ConnectedClient() 
         : clientId(INVALID_CLIENT_ID)
         , lastHeartbeat(0.0f)
         , lastReceivedInput(0)
         , lastSentSnapshot(0)
+        , lastAckedSnapshot(0)
+        , hasAckedSnapshot(false)
+        , snapshotBudget(0.0f)
         , accountId(0)
         , teamSlot(0)
-        , hasConfirmedPick(false) {}
+        , hasConfirmedPick(false)
+        , matchId(0) {}
+    
+    // Moves the delta baseline to tick if it is newer than the current one and is a
+    // snapshot this client was actually sent. Acks can arrive out of order; one for a
+    // tick never sent (corrupted, spoofed) must not pin the baseline.
+    bool acknowledgeSnapshot(TickNumber tick) {
+        if (hasAckedSnapshot && tick <= lastAckedSnapshot) {
+            return false;
+        }
+        if (!sentSnapshots.find(tick)) {
+            return false;
+        }
+        lastAckedSnapshot = tick;
+        hasAckedSnapshot = true;
+        return true;
+    }
 };
 
 // ============ Network Server ============
@@ -54,7 +88,14 @@ public:
     
     // Client management
     bool isClientConnected(ClientId clientId) const;
+    // Tell every client of the match to leave and drop their connections
+    void disconnectMatch(u64 matchId);
     size_t getClientCount() const { return clients_.size(); }
+    size_t getMatchClientCount(u64 matchId) const;
+    u64 getClientMatch(ClientId clientId) const {
+        auto it = clients_.find(clientId);
+        return (it != clients_.end()) ? it->second.matchId : 0;
+    }
     std::string getClientUsername(ClientId clientId) const {
         auto it = clients_.find(clientId);
         return (it != clients_.end()) ? it->second.username : "";
@@ -68,27 +109,34 @@ public:
         return (it != clients_.end()) ? it->second.teamSlot : 0;
     }
     
-    // Packet sending
+    // Packet sending (broadcasts only reach the clients of one match)
     void sendSnapshotToClient(ClientId clientId, const WorldSnapshot& snapshot);
-    void sendSnapshotToAll(const WorldSnapshot& snapshot);
-    void broadcastGameEvent(const void* eventData, size_t size);
+    void sendSnapshotToMatch(u64 matchId, const WorldSnapshot& snapshot);
+    void broadcastGameEvent(u64 matchId, const void* eventData, size_t size);
     
-    // Hero pick phase
-    void startHeroPickPhase(f32 pickTime = 30.0f);
+    // Hero pick phase (per match)
+    void startHeroPickPhase(u64 matchId, f32 pickTime = 30.0f);
     void sendTeamAssignment(ClientId clientId, u8 teamSlot);
     void broadcastPlayerInfo(ClientId playerId);
-    void broadcastAllPlayerInfo();
+    void broadcastAllPlayerInfo(u64 matchId);
     void broadcastHeroPick(ClientId playerId, const std::string& heroName, u8 teamSlot, bool confirmed);
-    void broadcastPickTimer(f32 timeRemaining, u8 phase);
-    void broadcastAllPicked(u8 playerCount, f32 startDelay);
-    bool allPlayersHavePicked() const;
+    void broadcastPickTimer(u64 matchId, f32 timeRemaining, u8 phase);
+    void broadcastAllPicked(u64 matchId, u8 playerCount, f32 startDelay);
+    bool allPlayersHavePicked(u64 matchId) const;
     
     // Callbacks
     using OnClientConnectedCallback = std::function<void(ClientId)>;
     using OnClientDisconnectedCallback = std::function<void(ClientId)>;
     using OnClientInputCallback = std::function<void(ClientId, const PlayerInput&)>;
     using OnHeroPickCallback = std::function<void(ClientId, const std::string& heroName, u8 teamSlot)>;
-    using OnAllPickedCallback = std::function<void()>;
+    using OnAllPickedCallback = std::function<void(u64 matchId)>;
+    
+    // Maps the lobby a connecting client asked for to a hosted match; false rejects the
+    // connection. Without a resolver every client joins match 0.
+    using MatchResolver = std::function<bool(u64 lobbyId, u64& matchId)>;
+    void setMatchResolver(MatchResolver resolver) {
+        matchResolver_ = resolver;
+    }
     
     void setOnClientConnected(OnClientConnectedCallback callback) { 
         onClientConnected_ = callback; 
@@ -107,17 +155,35 @@ public:
     }
     
     bool isRunning() const { return running_; }
-    bool isInHeroPickPhase() const { return inHeroPickPhase_; }
+    bool isInHeroPickPhase(u64 matchId) const;
+    
+    // Snapshot bytes per second each client may receive; past it, low-priority records
+    // are sent less often
+    void setSnapshotBandwidth(u32 bytesPerSecond) { snapshotBandwidth_ = bytesPerSecond; }
+    u32 getSnapshotBandwidth() const { return snapshotBandwidth_; }
     
 private:
+    // Connections and pick phase of one hosted match
+    struct MatchSession {
+        Vector<ClientId> clients;    // Connection order
+        bool inHeroPickPhase = false;
+        f32 heroPickTimer = 0.0f;
+        f32 heroPickTimerBroadcastInterval = 0.0f;
+    };
+    
+
     void receivePackets();
     void handlePacket(const NetworkAddress& sender, const u8* data, size_t size);
     void handleConnectionRequest(const NetworkAddress& sender, const u8* data, size_t size);
     void handleClientInput(ClientId clientId, const u8* data, size_t size);
+    void handleSnapshotAck(ClientId clientId, const u8* data, size_t size);
     void handleHeroPick(ClientId clientId, const u8* data, size_t size);
     void handleDisconnect(ClientId clientId);
     void checkClientTimeouts(f32 deltaTime);
+    void updateSnapshotBudgets(f32 deltaTime);
     void updateHeroPickPhase(f32 deltaTime);
+    void updateHeroPickPhase(u64 matchId, MatchSession& session, f32 deltaTime);
+    void sendToMatch(u64 matchId, const void* packet, size_t size);
     
     ClientId findClientByAddress(const NetworkAddress& addr) const;
     ClientId allocateClientId();
@@ -127,14 +193,14 @@ private:
     u16 port_;
     
     std::unordered_map<ClientId, ConnectedClient> clients_;
+    std::unordered_map<u64, ClientId> addressToClient_;  // NetworkAddress::toKey() -> connection
+    std::unordered_map<u64, MatchSession> matches_;
     ClientId nextClientId_;
     
     SequenceNumber nextSequence_;
-    
-    // Hero pick phase
-    bool inHeroPickPhase_;
-    f32 heroPickTimer_;
-    f32 heroPickTimerBroadcastInterval_;
+    Vector<u8> snapshotBuffer_;     // One encoded snapshot before it is split into fragments
+    Vector<NetworkId> deferredRecords_;
+    u32 snapshotBandwidth_;
     
     // Callbacks
     OnClientConnectedCallback onClientConnected_;
@@ -142,6 +208,7 @@ private:
     OnClientInputCallback onClientInput_;
     OnHeroPickCallback onHeroPick_;
     OnAllPickedCallback onAllPicked_;
+    MatchResolver matchResolver_;
     
     // Stats
     u64 totalPacketsSent_;
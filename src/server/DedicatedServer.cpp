@@ -1,15 +1,17 @@
 #define NOMINMAX
-#include "ServerWorld.h"
+#include "MatchHost.h"
 #include "network/NetworkServer.h"
 #include "network/NetworkCommon.h"
 #include "network/MatchmakingTypes.h"
 #include "network/MatchmakingProtocol.h"
-#include "world/HeroSystem.h"
-#include "world/Components.h"
 #include "core/Timer.h"
+#include "core/JobSystem.h"
+#include "core/Profiler.h"
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include <algorithm>
 #include <iostream>
+#include <cstring>
 #include <thread>
 #include <atomic>
 #include <random>
@@ -33,24 +35,9 @@ static void CopyString(char* dst, size_t dstSize, const std::string& src) {
 
 class DedicatedServerApp {
 public:
-    // Client info for tracking
-    struct ClientInfo {
-        ClientId clientId = 0;
-        u64 accountId = 0;
-        std::string username;
-        std::string heroName;
-        u8 teamSlot = 0;
-        bool isConnected = false;
-    };
-    
     DedicatedServerApp() 
         : running_(false)
-        , tickRate_(NetworkConfig::SERVER_TICK_RATE)
-        , gameStarted_(false)
-        , gameEnded_(false)
-        , gameEndTimer_(0.0f)
-        , gameStartDelay_(0.0f)
-        , minPlayersToPlay_(1) {  // Minimum 1 for testing, should be 2+ in production
+        , tickRate_(NetworkConfig::SERVER_TICK_RATE) {
     }
     
     bool initialize(u16 port, const char* coordinatorIP = "127.0.0.1", u16 coordinatorPort = kCoordinatorPort) {
@@ -62,44 +49,66 @@ public:
             return false;
         }
         
-        // Create server world
-        serverWorld_ = std::make_unique<ServerWorld>();
-        LOG_INFO("Server world created");
-        
-        // Initialize game systems
-        auto& entityManager = serverWorld_->getEntityManager();
-        serverWorld_->addSystem(std::make_unique<HeroSystem>(entityManager));
-        LOG_INFO("HeroSystem added to server world");
+        // Worker pool shared by every match (the tick thread runs jobs too)
+        JobSystemConfig jobConfig;
+        jobConfig.pinWorkers = pinThreads_;
+        jobSystem_ = std::make_unique<JobSystem>(jobConfig);
         
-        // Create network server
+        // One socket for all matches; connections are routed to matches by client id
         networkServer_ = std::make_unique<NetworkServer>();
+        matchHost_ = std::make_unique<MatchHost>(*networkServer_, jobSystem_.get(), maxMatches_, tickRate_);
+        LOG_INFO("Match host created ({} match slots, {} workers)", maxMatches_, jobSystem_->getWorkerCount());
+        
+        networkServer_->setMatchResolver([this](u64 lobbyId, u64& matchId) {
+            return matchHost_->resolveMatch(lobbyId, matchId);
+        });
         
         // Setup callbacks
         networkServer_->setOnClientConnected([this](ClientId clientId) {
-            onClientConnected(clientId);
+            if (Match* match = matchHost_->getClientMatch(clientId)) {
+                match->onClientConnected(clientId);
+            }
         });
         
         networkServer_->setOnClientDisconnected([this](ClientId clientId) {
-            onClientDisconnected(clientId);
+            if (Match* match = matchHost_->getClientMatch(clientId)) {
+                match->onClientDisconnected(clientId);
+            }
         });
         
         networkServer_->setOnClientInput([this](ClientId clientId, const PlayerInput& input) {
-            onClientInput(clientId, input);
+            if (Match* match = matchHost_->getClientMatch(clientId)) {
+                match->onClientInput(clientId, input);
+            }
         });
         
         // Handle hero picks - store hero name for each client
-        networkServer_->setOnHeroPick([this](ClientId clientId, const std::string& heroName, u8 teamSlot) {
-            auto it = clients_.find(clientId);
-            if (it != clients_.end()) {
-                it->second.heroName = heroName;
-                LOG_INFO("Client {} picked hero '{}' (team slot {})", clientId, heroName, teamSlot);
+        networkServer_->setOnHeroPick([this](ClientId clientId, const std::string& heroName, u8 /*teamSlot*/) {
+            if (Match* match = matchHost_->getClientMatch(clientId)) {
+                match->onHeroPick(clientId, heroName);
             }
         });
         
         // Start game when all heroes are picked (with delay)
-        networkServer_->setOnAllPicked([this]() {
-            LOG_INFO("All heroes picked! Game starting in 3 seconds...");
-            gameStartDelay_ = 3.0f;  // 3 second delay before game starts
+        networkServer_->setOnAllPicked([this](u64 matchId) {
+            if (Match* match = matchHost_->findMatch(matchId)) {
+                match->onAllPicked();
+            }
+        });
+        
+        // Notify matchmaking coordinator about disconnects
+        matchHost_->setOnPlayerDisconnected([this](u64 matchId, u64 accountId, u8 teamSlot, const std::string& heroName) {
+            if (!mmSocket_.isValid() || matchId >= MatchHost::LOCAL_MATCH_BASE) {
+                return;
+            }
+            PlayerDisconnectedPayload p{};
+            p.serverId = serverId_;
+            p.lobbyId = matchId;
+            p.accountId = accountId;  // Use real accountId from auth
+            p.teamSlot = teamSlot;
+            CopyString(p.heroName, sizeof(p.heroName), heroName);
+            sendPacketToCoordinator_(MatchmakingMessageType::PlayerDisconnected, &p, sizeof(p), matchId);
+            LOG_INFO("Notified coordinator: accountId={} left lobby {}", accountId, matchId);
         });
         
         // Start network server
@@ -137,8 +146,9 @@ public:
             networkServer_->stop();
         }
         
-        serverWorld_.reset();
+        matchHost_.reset();
         networkServer_.reset();
+        jobSystem_.reset();
         
         NetworkSystem::Shutdown();
         
@@ -148,14 +158,18 @@ public:
     void run() {
         running_ = true;
         
+        // Workers are pinned to cores 1..N, keep the tick thread on core 0
+        if (pinThreads_ && !JobSystem::pinCurrentThread(0)) {
+            LOG_WARN("Failed to pin simulation thread to core 0");
+        }
+        Profiler::setThreadName("Simulation");
+        
         Timer frameTimer;
         Timer statsTimer;
         Timer mmTimer;
         f64 lastFrameTime = frameTimer.elapsed();
         
-        const f32 tickInterval = 1.0f / static_cast<f32>(tickRate_);
-        f32 accumulator = 0.0f;
-        
+        u64 passCount = 0;
         u64 tickCount = 0;
         
         while (running_) {
@@ -163,42 +177,27 @@ public:
             f32 deltaTime = static_cast<f32>(currentTime - lastFrameTime);
             lastFrameTime = currentTime;
             
-            accumulator += deltaTime;
-            
-            // Fixed timestep simulation
-            while (accumulator >= tickInterval) {
-                tick(tickInterval);
-                accumulator -= tickInterval;
-                tickCount++;
+            // Every match on its own fixed-rate deadline
+            u32 ticked = 0;
+            {
+                Timer tickTimer;
+                ticked = tick(currentTime);
+                if (ticked > 0) {
+                    tickCount += ticked;
+                    passCount++;
+                    // Serves on-demand dumps and writes a trace when the pass blew its budget
+                    Profiler::endTick(passCount, tickTimer.elapsedMillis());
+                }
             }
             
             // Network update (process packets)
-            networkServer_->update(deltaTime);
-            
-            // Handle game end timer
-            if (gameEnded_ && gameEndTimer_ > 0.0f) {
-                gameEndTimer_ -= deltaTime;
-                if (gameEndTimer_ <= 0.0f) {
-                    LOG_INFO("Game end timer expired, shutting down server...");
-                    running_ = false;
-                    break;
-                }
+            {
+                PROFILE_SCOPE("NetworkServer::update");
+                networkServer_->update(deltaTime);
             }
             
-            // Handle game start delay (after hero pick)
-            if (gameStartDelay_ > 0.0f && !gameStarted_) {
-                gameStartDelay_ -= deltaTime;
-                if (gameStartDelay_ <= 0.0f) {
-                    LOG_INFO("Game start delay expired, starting game!");
-                    
-                    // Create heroes for all connected clients
-                    spawnHeroesForClients();
-                    
-                    serverWorld_->startGame();
-                    gameStarted_ = true;
-                    gameStartDelay_ = 0.0f;
-                }
-            }
+            // Hero pick delays, end-of-game timers, closing finished matches
+            matchHost_->updateLobbies(deltaTime);
 
             // Matchmaking side-channel (register/heartbeat + AssignLobby)
             if (mmSocket_.isValid()) {
@@ -217,8 +216,10 @@ public:
                 statsTimer.reset();
             }
             
-            // Sleep to avoid busy-waiting
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // Sleep to avoid busy-waiting (not while matches are catching up)
+            if (ticked == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
         }
     }
     
@@ -226,230 +227,28 @@ public:
         running_ = false;
     }
     
-private:
-    void tick(f32 deltaTime) {
-        // Update game simulation
-        serverWorld_->update(deltaTime);
-        
-        // Create and send snapshot to all clients
-        if (networkServer_->getClientCount() > 0) {
-            WorldSnapshot snapshot = serverWorld_->createSnapshot();
-            networkServer_->sendSnapshotToAll(snapshot);
-        }
-    }
-    
-    void onClientConnected(ClientId clientId) {
-        LOG_INFO(">>> Client {} connected", clientId);
-        
-        // Get username and accountId from NetworkServer
-        std::string username = networkServer_->getClientUsername(clientId);
-        u64 accountId = networkServer_->getClientAccountId(clientId);
-        u8 teamSlot = networkServer_->getClientTeamSlot(clientId);
-        if (username.empty()) {
-            username = "Player" + std::to_string(clientId);
-        }
-        
-        // Create client info
-        ClientInfo info;
-        info.clientId = clientId;
-        info.accountId = accountId;
-        info.username = username;
-        info.teamSlot = teamSlot;  // Use slot from NetworkServer
-        info.isConnected = true;
-        clients_[clientId] = info;
-        
-        LOG_INFO(">>> Player '{}' connected (slot {}, team {}, accountId={})", 
-                 username, info.teamSlot, (info.teamSlot < 5 ? "Radiant" : "Dire"), accountId);
-        
-        // Add client to server world
-        serverWorld_->addClient(clientId);
-        
-        // Check if we should start hero pick phase
-        size_t clientCount = networkServer_->getClientCount();
-        
-        // Start hero pick when we have at least 2 players (for testing)
-        // In production, wait for expected player count from matchmaking
-        if (clientCount >= 2 && !networkServer_->isInHeroPickPhase() && !gameStarted_) {
-            LOG_INFO("Starting hero pick phase with {} players...", clientCount);
-            networkServer_->startHeroPickPhase(30.0f);  // 30 seconds to pick
-        }
-        
-        // Game will start after hero pick phase completes (via onAllPicked callback)
-    }
-    
-    void onClientDisconnected(ClientId clientId) {
-        // Get client info before removing
-        std::string username = "Unknown";
-        u64 accountId = 0;
-        u8 clientTeamSlot = 0;
-        std::string heroName;
-        
-        auto it = clients_.find(clientId);
-        if (it != clients_.end()) {
-            username = it->second.username;
-            accountId = it->second.accountId;
-            clientTeamSlot = it->second.teamSlot;
-            heroName = it->second.heroName;
-            it->second.isConnected = false;
-        }
-        
-        LOG_INFO("<<< Player '{}' disconnected (slot {}, accountId={})", username, clientTeamSlot, accountId);
-        
-        // Notify matchmaking coordinator about disconnect
-        if (mmSocket_.isValid() && currentLobbyId_ != 0) {
-            PlayerDisconnectedPayload p{};
-            p.serverId = serverId_;
-            p.lobbyId = currentLobbyId_;
-            p.accountId = accountId;  // Use real accountId from auth
-            p.teamSlot = clientTeamSlot;
-            CopyString(p.heroName, sizeof(p.heroName), heroName);
-            sendPacketToCoordinator_(MatchmakingMessageType::PlayerDisconnected, &p, sizeof(p), currentLobbyId_);
-            LOG_INFO("Notified coordinator: player '{}' (accountId={}) disconnected", username, accountId);
-        }
-        
-        serverWorld_->removeClient(clientId);
-        
-        size_t remainingClients = networkServer_->getClientCount();
-        
-        // Check if game should end
-        if (remainingClients == 0) {
-            LOG_INFO("=== ALL PLAYERS DISCONNECTED ===");
-            LOG_INFO("Game ended - no players remaining");
-            
-            // Calculate winner based on game state
-            calculateGameResult();
-            
-            // Pause game
-            serverWorld_->pauseGame();
-            
-            // Schedule server shutdown after a delay
-            LOG_INFO("Server will shutdown in 5 seconds...");
-            gameEndTimer_ = 5.0f;
-            gameEnded_ = true;
-        }
-        else if (gameStarted_ && remainingClients < minPlayersToPlay_) {
-            // Not enough players to continue - end game
-            LOG_INFO("=== NOT ENOUGH PLAYERS ===");
-            LOG_INFO("Only {} players remaining, minimum {} required", remainingClients, minPlayersToPlay_);
-            
-            calculateGameResult();
-            gameEnded_ = true;
-            gameEndTimer_ = 10.0f;  // Give time for remaining players to see result
-        }
-    }
-    
-    void spawnHeroesForClients() {
-        LOG_INFO("Spawning heroes for {} clients...", clients_.size());
-        
-        auto* heroSystem = static_cast<WorldEditor::HeroSystem*>(serverWorld_->getSystem("HeroSystem"));
-        if (!heroSystem) {
-            LOG_ERROR("HeroSystem not found!");
-            return;
-        }
-        
-        // Map size: 16000x16000 units
-        // Radiant base: bottom-left (~1500, 1500)
-        // Dire base: top-right (~14500, 14500)
-        const Vec3 radiantSpawn(1600.0f, 50.0f, 1600.0f);
-        const Vec3 direSpawn(14400.0f, 50.0f, 14400.0f);
-        const f32 spawnSpread = 200.0f;  // Spread heroes apart
-        
-        int radiantIndex = 0;
-        int direIndex = 0;
-        
-        for (auto& [clientId, clientInfo] : clients_) {
-            if (!clientInfo.isConnected) continue;
-            
-            // Get current team slot from NetworkServer (it's assigned during hero pick phase)
-            u8 teamSlot = networkServer_->getClientTeamSlot(clientId);
-            clientInfo.teamSlot = teamSlot;  // Update our cached value
-            
-            // Determine team based on slot (0-4 = Radiant/Team 1, 5-9 = Dire/Team 2)
-            i32 teamId = (teamSlot < 5) ? 1 : 2;
-            
-            // Calculate spawn position with spread
-            Vec3 spawnPos;
-            if (teamId == 1) {
-                spawnPos = radiantSpawn + Vec3(radiantIndex * spawnSpread, 0.0f, radiantIndex * spawnSpread * 0.5f);
-                radiantIndex++;
-            } else {
-                spawnPos = direSpawn - Vec3(direIndex * spawnSpread, 0.0f, direIndex * spawnSpread * 0.5f);
-                direIndex++;
-            }
-            
-            // Use picked hero or default to Warrior
-            std::string heroType = clientInfo.heroName.empty() ? "Warrior" : clientInfo.heroName;
-            
-            // Create hero
-            Entity heroEntity = heroSystem->createHeroByType(heroType, teamId, spawnPos);
-            
-            // Assign network ID for multiplayer sync
-            NetworkId netId = serverWorld_->assignNetworkId(heroEntity);
-            
-            // Map client to their hero entity in ServerWorld
-            serverWorld_->setClientHero(clientId, heroEntity);
-            clientToEntity_[clientId] = heroEntity;
-            
-            // Mark as player controlled
-            if (serverWorld_->hasComponent<WorldEditor::HeroComponent>(heroEntity)) {
-                auto& hero = serverWorld_->getComponent<WorldEditor::HeroComponent>(heroEntity);
-                hero.isPlayerControlled = true;
-                hero.heroName = clientInfo.username + "'s " + heroType;
-            }
-            
-            LOG_INFO("Spawned hero '{}' for client {} (slot={}, team {}) at ({}, {}, {}) networkId={}", 
-                     heroType, clientId, teamSlot, teamId, spawnPos.x, spawnPos.y, spawnPos.z, netId);
-        }
-        
-        LOG_INFO("All heroes spawned: {} Radiant, {} Dire", radiantIndex, direIndex);
-    }
+    // Pin the tick thread and job workers to fixed cores (call before initialize)
+    void setPinThreads(bool pin) { pinThreads_ = pin; }
     
-    void calculateGameResult() {
-        // Count remaining players per team
-        // Radiant: slots 0-4, Dire: slots 5-9
-        int radiantPlayers = 0;
-        int direPlayers = 0;
-        
-        // TODO: Get actual team counts from NetworkServer client info
-        // For now, simple logic: team with more remaining players wins
-        
-        f32 gameTime = serverWorld_->getGameTime();
-        
-        LOG_INFO("=== GAME RESULT ===");
-        LOG_INFO("  Game Duration: {:.1f} seconds", gameTime);
-        
-        if (radiantPlayers > direPlayers) {
-            LOG_INFO("  Winner: RADIANT");
-            LOG_INFO("  Radiant players: {}, Dire players: {}", radiantPlayers, direPlayers);
-        } else if (direPlayers > radiantPlayers) {
-            LOG_INFO("  Winner: DIRE");
-            LOG_INFO("  Radiant players: {}, Dire players: {}", radiantPlayers, direPlayers);
-        } else {
-            // Both teams have same players (or 0) - check other conditions
-            // For now, if all disconnected, it's a draw
-            LOG_INFO("  Result: DRAW (all players disconnected)");
-        }
-        
-        // TODO: Send game result to matchmaking coordinator for stats
-        // TODO: Update player MMR based on result
-    }
+    // Concurrent matches hosted by this process (call before initialize)
+    void setMaxMatches(u32 maxMatches) { maxMatches_ = std::max(maxMatches, 1u); }
     
-    void onClientInput(ClientId clientId, const PlayerInput& input) {
-        // Process input in server world
-        serverWorld_->processInput(clientId, input);
+private:
+    u32 tick(f64 now) {
+        PROFILE_SCOPE("DedicatedServer::tick");
+        return matchHost_->update(now);
     }
     
     void printStats(u64 tickCount, f32 duration) {
         f32 avgTickRate = static_cast<f32>(tickCount) / duration;
-        size_t entityCount = serverWorld_->getEntityCount();
-        size_t clientCount = networkServer_->getClientCount();
-        f32 gameTime = serverWorld_->getGameTime();
+        u32 matchCount = matchHost_->getMatchCount();
         
         LOG_INFO("=== Server Stats ===");
-        LOG_INFO("  Tick Rate: {:.1f} Hz (target: {})", avgTickRate, tickRate_);
-        LOG_INFO("  Clients: {}", clientCount);
-        LOG_INFO("  Entities: {}", entityCount);
-        LOG_INFO("  Game Time: {:.1f}s", gameTime);
+        LOG_INFO("  Matches: {} / {}", matchCount, matchHost_->getMaxMatches());
+        LOG_INFO("  Tick Rate: {:.1f} Hz per match (target: {})",
+                 matchCount > 0 ? avgTickRate / matchCount : 0.0f, tickRate_);
+        LOG_INFO("  Missed deadlines: {}", matchHost_->getMissedDeadlines());
+        LOG_INFO("  Clients: {}", networkServer_->getClientCount());
     }
 
 private:
@@ -471,17 +270,21 @@ private:
         // For local dev, advertise localhost. Later: detect LAN/public IP.
         CopyCString(p.serverIp, sizeof(p.serverIp), "127.0.0.1");
         p.gamePort = gamePort;
-        p.capacity = (u16)MAX_CLIENTS;
+        p.capacity = (u16)matchHost_->getPlayerCapacity();
+        p.maxMatches = (u16)matchHost_->getMaxMatches();
         sendPacketToCoordinator_(MatchmakingMessageType::ServerRegister, &p, sizeof(p));
-        LOG_INFO("MM: Registered server {} as 127.0.0.1:{} cap={}", serverId_, gamePort, p.capacity);
+        LOG_INFO("MM: Registered server {} as 127.0.0.1:{} cap={} matches={}",
+                 serverId_, gamePort, p.capacity, p.maxMatches);
     }
 
     void sendServerHeartbeat_(f32 uptimeSeconds) {
         ServerHeartbeatPayload p{};
         p.serverId = serverId_;
-        p.currentPlayers = (u16)networkServer_->getClientCount();
-        p.capacity = (u16)MAX_CLIENTS;
+        p.currentPlayers = (u16)matchHost_->getPlayerCount();
+        p.capacity = (u16)matchHost_->getPlayerCapacity();
         p.uptimeSeconds = uptimeSeconds;
+        p.activeMatches = (u16)matchHost_->getMatchCount();
+        p.maxMatches = (u16)matchHost_->getMaxMatches();
         sendPacketToCoordinator_(MatchmakingMessageType::ServerHeartbeat, &p, sizeof(p));
     }
 
@@ -502,36 +305,30 @@ private:
             const auto type = (MatchmakingMessageType)h.type;
             if (type == MatchmakingMessageType::AssignLobby && payloadSize >= sizeof(AssignLobbyPayload)) {
                 const auto* p = (const AssignLobbyPayload*)payload;
-                currentLobbyId_ = p->lobbyId;
-                LOG_INFO("MM: Assigned lobby {} (expectedPlayers={})", p->lobbyId, p->expectedPlayers);
+                if (matchHost_->createMatch(p->lobbyId, p->expectedPlayers)) {
+                    LOG_INFO("MM: Assigned lobby {} (expectedPlayers={})", p->lobbyId, p->expectedPlayers);
+                } else {
+                    LOG_WARN("MM: Lobby {} assigned but no match slot is free", p->lobbyId);
+                }
             }
         }
     }
     
-    std::unique_ptr<ServerWorld> serverWorld_;
+    std::unique_ptr<JobSystem> jobSystem_;
     std::unique_ptr<NetworkServer> networkServer_;
+    std::unique_ptr<MatchHost> matchHost_;
     std::atomic<bool> running_;
+    bool pinThreads_ = false;
+    u32 maxMatches_ = 1;
     u32 tickRate_;
-    
-    // Game state
-    bool gameStarted_ = false;
-    bool gameEnded_ = false;
-    f32 gameEndTimer_ = 0.0f;
-    f32 gameStartDelay_ = 0.0f;  // Delay after hero pick before game starts
-    size_t minPlayersToPlay_ = 1;  // Minimum players to continue game
 
     // Matchmaking (server pool)
     UDPSocket mmSocket_;
     std::string coordinatorIP_ = "127.0.0.1";
     u16 coordinatorPort_ = kCoordinatorPort;
     u64 serverId_ = 0;
-    u64 currentLobbyId_ = 0;  // Current game lobby ID
     f32 heartbeatTimer_ = 0.0f;
     f32 heartbeatInterval_ = 2.0f;
-    
-    // Client tracking
-    std::unordered_map<ClientId, ClientInfo> clients_;
-    std::unordered_map<ClientId, Entity> clientToEntity_;  // Client -> controlled hero entity
 };
 
 // ============ Main Entry Point ============
@@ -542,6 +339,11 @@ static DedicatedServerApp* g_serverApp = nullptr;
 #include <windows.h>
 
 BOOL WINAPI ConsoleHandler(DWORD signal) {
+    // Ctrl+Break: dump the profiler history without stopping the server
+    if (signal == CTRL_BREAK_EVENT) {
+        Profiler::requestDump("trace_ondemand.json");
+        return TRUE;
+    }
     if (signal == CTRL_C_EVENT || signal == CTRL_CLOSE_EVENT) {
         LOG_INFO("Shutdown signal received");
         if (g_serverApp) {
@@ -565,18 +367,43 @@ int main(int argc, char** argv) {
     const char* mmIP = "127.0.0.1";
     u16 mmPort = kCoordinatorPort;
     
-    if (argc > 1) {
-        port = static_cast<u16>(std::atoi(argv[1]));
+    // Positional: [port] [mmIP] [mmPort]; flags: --pin-threads, --slow-tick-ms <ms>, --max-matches <n>
+    bool pinThreads = false;
+    f64 slowTickMs = 0.0;
+    u32 maxMatches = 1;
+    std::vector<const char*> args;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--pin-threads") == 0) {
+            pinThreads = true;
+        } else if (std::strcmp(argv[i], "--slow-tick-ms") == 0 && i + 1 < argc) {
+            slowTickMs = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--max-matches") == 0 && i + 1 < argc) {
+            maxMatches = static_cast<u32>(std::max(1, std::atoi(argv[++i])));
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+    
+    if (args.size() > 0) {
+        port = static_cast<u16>(std::atoi(args[0]));
+    }
+    if (args.size() > 1) {
+        mmIP = args[1];
     }
-    if (argc > 2) {
-        mmIP = argv[2];
+    if (args.size() > 2) {
+        mmPort = static_cast<u16>(std::atoi(args[2]));
     }
-    if (argc > 3) {
-        mmPort = static_cast<u16>(std::atoi(argv[3]));
+    
+    // Ticks over the threshold dump a Chrome trace (open in chrome://tracing or Perfetto)
+    if (slowTickMs > 0.0) {
+        Profiler::setSlowTickDump(slowTickMs, ".");
+        LOG_INFO("Slow tick traces enabled above {:.1f} ms", slowTickMs);
     }
     
     // Create server app
     DedicatedServerApp serverApp;
+    serverApp.setPinThreads(pinThreads);
+    serverApp.setMaxMatches(maxMatches);
     g_serverApp = &serverApp;
     
     // Setup signal handler
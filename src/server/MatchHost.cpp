@@ -0,0 +1,442 @@
+#include "MatchHost.h"
+#include "world/HeroSystem.h"
+#include "world/Components.h"
+#include "core/JobSystem.h"
+#include "core/Profiler.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+using namespace Network;
+
+namespace {
+
+// A lobby nobody connects to gives its slot back after this long
+constexpr f32 kEmptyMatchTimeout = 60.0f;
+
+} // namespace
+
+// ============ Match ============
+
+Match::Match(u64 matchId, u16 expectedPlayers, NetworkServer& network, JobSystem* jobSystem, u32 tickRate)
+    : matchId_(matchId)
+    , expectedPlayers_(expectedPlayers)
+    , network_(network)
+    , serverWorld_(std::make_unique<ServerWorld>()) {
+    serverWorld_->setJobSystem(jobSystem);
+    serverWorld_->setTickRate(tickRate);
+
+    auto& entityManager = serverWorld_->getEntityManager();
+    serverWorld_->addSystem(std::make_unique<HeroSystem>(entityManager));
+}
+
+void Match::onClientConnected(ClientId clientId) {
+    // Get username and accountId from NetworkServer
+    std::string username = network_.getClientUsername(clientId);
+    u64 accountId = network_.getClientAccountId(clientId);
+    u8 teamSlot = network_.getClientTeamSlot(clientId);
+    if (username.empty()) {
+        username = "Player" + std::to_string(clientId);
+    }
+
+    ClientInfo info;
+    info.clientId = clientId;
+    info.accountId = accountId;
+    info.username = username;
+    info.teamSlot = teamSlot;
+    info.isConnected = true;
+    clients_[clientId] = info;
+    connectedPlayers_++;
+
+    LOG_INFO(">>> Match {}: player '{}' connected (slot {}, team {}, accountId={})",
+             matchId_, username, info.teamSlot, (info.teamSlot < 5 ? "Radiant" : "Dire"), accountId);
+
+    serverWorld_->addClient(clientId);
+
+    // Start hero pick when we have at least 2 players (for testing)
+    // In production, wait for expectedPlayers_ from matchmaking
+    size_t clientCount = getPlayerCount();
+    if (clientCount >= 2 && !network_.isInHeroPickPhase(matchId_) && !gameStarted_) {
+        LOG_INFO("Match {}: starting hero pick phase with {} players...", matchId_, clientCount);
+        network_.startHeroPickPhase(matchId_, 30.0f);  // 30 seconds to pick
+    }
+}
+
+void Match::onClientDisconnected(ClientId clientId) {
+    // Sent away as the finished match closes: not a leaver, and the result is already in
+    if (finished_) {
+        serverWorld_->removeClient(clientId);
+        clientSnapshots_.erase(clientId);
+        return;
+    }
+
+    std::string username = "Unknown";
+    u64 accountId = 0;
+    u8 clientTeamSlot = 0;
+    std::string heroName;
+
+    auto it = clients_.find(clientId);
+    if (it != clients_.end()) {
+        username = it->second.username;
+        accountId = it->second.accountId;
+        clientTeamSlot = it->second.teamSlot;
+        heroName = it->second.heroName;
+        if (it->second.isConnected) {
+            connectedPlayers_--;
+        }
+        it->second.isConnected = false;
+    }
+
+    LOG_INFO("<<< Match {}: player '{}' disconnected (slot {}, accountId={})", matchId_, username, clientTeamSlot, accountId);
+
+    if (onPlayerDisconnected_) {
+        onPlayerDisconnected_(matchId_, accountId, clientTeamSlot, heroName);
+    }
+
+    serverWorld_->removeClient(clientId);
+    clientSnapshots_.erase(clientId);
+
+    // NetworkServer drops the connection after this callback returns
+    size_t remainingClients = connectedPlayers_;
+
+    if (remainingClients == 0) {
+        LOG_INFO("=== MATCH {}: ALL PLAYERS DISCONNECTED ===", matchId_);
+
+        calculateGameResult();
+        serverWorld_->pauseGame();
+
+        LOG_INFO("Match {} will close in 5 seconds...", matchId_);
+        gameEndTimer_ = 5.0f;
+        gameEnded_ = true;
+    }
+    else if (gameStarted_ && remainingClients < minPlayersToPlay_) {
+        LOG_INFO("=== MATCH {}: NOT ENOUGH PLAYERS ===", matchId_);
+        LOG_INFO("Only {} players remaining, minimum {} required", remainingClients, minPlayersToPlay_);
+
+        calculateGameResult();
+        gameEnded_ = true;
+        gameEndTimer_ = 10.0f;  // Give time for remaining players to see result
+    }
+}
+
+void Match::onClientInput(ClientId clientId, const PlayerInput& input) {
+    serverWorld_->processInput(clientId, input);
+}
+
+void Match::onHeroPick(ClientId clientId, const std::string& heroName) {
+    auto it = clients_.find(clientId);
+    if (it != clients_.end()) {
+        it->second.heroName = heroName;
+        LOG_INFO("Match {}: client {} picked hero '{}'", matchId_, clientId, heroName);
+    }
+}
+
+void Match::onAllPicked() {
+    LOG_INFO("Match {}: all heroes picked! Game starting in 3 seconds...", matchId_);
+    gameStartDelay_ = 3.0f;
+}
+
+void Match::update(f32 deltaTime) {
+    if (finished_) return;
+
+    if (gameEnded_ && gameEndTimer_ > 0.0f) {
+        gameEndTimer_ -= deltaTime;
+        if (gameEndTimer_ <= 0.0f) {
+            LOG_INFO("Match {} finished", matchId_);
+            finished_ = true;
+        }
+        return;
+    }
+
+    if (gameStartDelay_ > 0.0f && !gameStarted_) {
+        gameStartDelay_ -= deltaTime;
+        if (gameStartDelay_ <= 0.0f) {
+            LOG_INFO("Match {}: start delay expired, starting game!", matchId_);
+            spawnHeroesForClients();
+            serverWorld_->startGame();
+            gameStarted_ = true;
+            gameStartDelay_ = 0.0f;
+        }
+    }
+
+    // Nobody ever showed up for this lobby
+    if (clients_.empty()) {
+        emptyTimer_ += deltaTime;
+        if (emptyTimer_ >= kEmptyMatchTimeout) {
+            LOG_WARN("Match {}: no players joined within {:.0f}s, closing", matchId_, kEmptyMatchTimeout);
+            finished_ = true;
+        }
+    }
+}
+
+void Match::simulate(f32 deltaTime) {
+    PROFILE_SCOPE("Match::simulate");
+
+    serverWorld_->update(deltaTime);
+
+    hasSnapshot_ = connectedPlayers_ > 0;
+    if (hasSnapshot_) {
+        snapshot_ = serverWorld_->createSnapshot();
+        
+        // Each player only gets what their team sees and what is around them
+        for (const auto& [clientId, info] : clients_) {
+            if (info.isConnected) {
+                serverWorld_->filterSnapshot(clientId, snapshot_, clientSnapshots_[clientId]);
+            }
+        }
+    }
+}
+
+void Match::sendSnapshot() {
+    if (hasSnapshot_) {
+        for (const auto& [clientId, info] : clients_) {
+            if (info.isConnected) {
+                network_.sendSnapshotToClient(clientId, clientSnapshots_[clientId]);
+            }
+        }
+        hasSnapshot_ = false;
+    }
+}
+
+void Match::spawnHeroesForClients() {
+    LOG_INFO("Match {}: spawning heroes for {} clients...", matchId_, clients_.size());
+
+    auto* heroSystem = static_cast<HeroSystem*>(serverWorld_->getSystem("HeroSystem"));
+    if (!heroSystem) {
+        LOG_ERROR("HeroSystem not found!");
+        return;
+    }
+
+    // Map size: 16000x16000 units
+    // Radiant base: bottom-left (~1500, 1500)
+    // Dire base: top-right (~14500, 14500)
+    const Vec3 radiantSpawn(1600.0f, 50.0f, 1600.0f);
+    const Vec3 direSpawn(14400.0f, 50.0f, 14400.0f);
+    const f32 spawnSpread = 200.0f;  // Spread heroes apart
+
+    int radiantIndex = 0;
+    int direIndex = 0;
+
+    for (auto& [clientId, clientInfo] : clients_) {
+        if (!clientInfo.isConnected) continue;
+
+        // Team slot is assigned by NetworkServer during the hero pick phase
+        u8 teamSlot = network_.getClientTeamSlot(clientId);
+        clientInfo.teamSlot = teamSlot;
+
+        // Determine team based on slot (0-4 = Radiant/Team 1, 5-9 = Dire/Team 2)
+        i32 teamId = (teamSlot < 5) ? 1 : 2;
+
+        Vec3 spawnPos;
+        if (teamId == 1) {
+            spawnPos = radiantSpawn + Vec3(radiantIndex * spawnSpread, 0.0f, radiantIndex * spawnSpread * 0.5f);
+            radiantIndex++;
+        } else {
+            spawnPos = direSpawn - Vec3(direIndex * spawnSpread, 0.0f, direIndex * spawnSpread * 0.5f);
+            direIndex++;
+        }
+
+        // Use picked hero or default to Warrior
+        std::string heroType = clientInfo.heroName.empty() ? "Warrior" : clientInfo.heroName;
+
+        Entity heroEntity = heroSystem->createHeroByType(heroType, teamId, spawnPos);
+        NetworkId netId = serverWorld_->assignNetworkId(heroEntity);
+        serverWorld_->setClientHero(clientId, heroEntity);
+
+        if (serverWorld_->hasComponent<HeroComponent>(heroEntity)) {
+            auto& hero = serverWorld_->getComponent<HeroComponent>(heroEntity);
+            hero.isPlayerControlled = true;
+            hero.heroName = clientInfo.username + "'s " + heroType;
+        }
+
+        LOG_INFO("Spawned hero '{}' for client {} (slot={}, team {}) at ({}, {}, {}) networkId={}",
+                 heroType, clientId, teamSlot, teamId, spawnPos.x, spawnPos.y, spawnPos.z, netId);
+    }
+
+    LOG_INFO("Match {}: all heroes spawned: {} Radiant, {} Dire", matchId_, radiantIndex, direIndex);
+}
+
+void Match::calculateGameResult() {
+    // Count remaining players per team
+    // Radiant: slots 0-4, Dire: slots 5-9
+    int radiantPlayers = 0;
+    int direPlayers = 0;
+    for (const auto& [clientId, clientInfo] : clients_) {
+        if (!clientInfo.isConnected) continue;
+        if (clientInfo.teamSlot < 5) {
+            radiantPlayers++;
+        } else {
+            direPlayers++;
+        }
+    }
+
+    f32 gameTime = serverWorld_->getGameTime();
+
+    LOG_INFO("=== MATCH {} RESULT ===", matchId_);
+    LOG_INFO("  Game Duration: {:.1f} seconds", gameTime);
+
+    if (radiantPlayers > direPlayers) {
+        LOG_INFO("  Winner: RADIANT");
+        LOG_INFO("  Radiant players: {}, Dire players: {}", radiantPlayers, direPlayers);
+    } else if (direPlayers > radiantPlayers) {
+        LOG_INFO("  Winner: DIRE");
+        LOG_INFO("  Radiant players: {}, Dire players: {}", radiantPlayers, direPlayers);
+    } else {
+        LOG_INFO("  Result: DRAW (all players disconnected)");
+    }
+
+    // TODO: Send game result to matchmaking coordinator for stats
+    // TODO: Update player MMR based on result
+}
+
+// ============ MatchHost ============
+
+MatchHost::MatchHost(NetworkServer& network, JobSystem* jobSystem, u32 maxMatches, u32 tickRate)
+    : network_(network)
+    , jobSystem_(jobSystem)
+    , maxMatches_(std::max(maxMatches, 1u))
+    , tickRate_(tickRate)
+    , tickInterval_(1.0 / static_cast<f64>(tickRate)) {
+}
+
+Match* MatchHost::createMatch(u64 matchId, u16 expectedPlayers) {
+    // Coordinator may resend AssignLobby; a lobby maps to exactly one match
+    if (Match* existing = findMatch(matchId)) {
+        return existing;
+    }
+    return openMatch(matchId, expectedPlayers, false);
+}
+
+Match* MatchHost::openMatch(u64 matchId, u16 expectedPlayers, bool local) {
+    if (matches_.size() >= maxMatches_) {
+        LOG_WARN("MatchHost: all {} match slots busy, cannot open match {}", maxMatches_, matchId);
+        return nullptr;
+    }
+
+    Slot& slot = matches_[matchId];
+    slot.match = std::make_unique<Match>(matchId, expectedPlayers, network_, jobSystem_, tickRate_);
+    slot.match->setOnPlayerDisconnected(onPlayerDisconnected_);
+    slot.local = local;
+    // First tick one interval from now; matches opened at different times stay staggered
+    slot.deadline = TickDeadline(tickInterval_, now_, MAX_CATCH_UP_TICKS);
+
+    LOG_INFO("MatchHost: opened match {} for {} players ({} / {} slots)",
+             matchId, expectedPlayers, matches_.size(), maxMatches_);
+    return slot.match.get();
+}
+
+Match* MatchHost::findMatch(u64 matchId) {
+    auto it = matches_.find(matchId);
+    return (it != matches_.end()) ? it->second.match.get() : nullptr;
+}
+
+Match* MatchHost::getClientMatch(ClientId clientId) {
+    if (!network_.isClientConnected(clientId)) {
+        return nullptr;
+    }
+    return findMatch(network_.getClientMatch(clientId));
+}
+
+bool MatchHost::resolveMatch(u64 lobbyId, u64& matchId) {
+    slotInfo_.clear();
+    for (const auto& [id, slot] : matches_) {
+        MatchSlotInfo info;
+        info.matchId = id;
+        info.local = slot.local;
+        info.joinable = slot.match->isJoinable();
+        info.finished = slot.match->isFinished();
+        info.players = slot.match->getPlayerCount();
+        slotInfo_.push_back(info);
+    }
+
+    switch (admitLobby(slotInfo_, lobbyId, MAX_CLIENTS, matchId)) {
+        case LobbyAdmission::Join:
+            return true;
+        case LobbyAdmission::OpenLocal:
+            while (matches_.count(nextLocalMatchId_) != 0) {
+                nextLocalMatchId_++;
+            }
+            if (!openMatch(nextLocalMatchId_, 0, true)) {
+                return false;
+            }
+            matchId = nextLocalMatchId_++;
+            return true;
+        default:
+            return false;
+    }
+}
+
+u32 MatchHost::update(f64 now) {
+    now_ = now;
+
+    due_.clear();
+    for (auto& [id, slot] : matches_) {
+        f64 skippedBehind = 0.0;
+        if (slot.match->isFinished() || !slot.deadline.poll(now, skippedBehind)) {
+            continue;
+        }
+        if (skippedBehind > 0.0) {
+            LOG_WARN("MatchHost: match {} is {:.1f} ms behind, skipping ticks", id, skippedBehind * 1000.0);
+        }
+        due_.push_back(&slot);
+    }
+
+    if (due_.empty()) {
+        return 0;
+    }
+
+    // Simulate due matches side by side; each match's own systems share the same pool
+    const f32 dt = static_cast<f32>(tickInterval_);
+    if (jobSystem_ && due_.size() > 1) {
+        jobSystem_->parallelFor(static_cast<u32>(due_.size()), 1, [this, dt](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i) {
+                due_[i]->match->simulate(dt);
+            }
+        });
+    } else {
+        for (Slot* slot : due_) {
+            slot->match->simulate(dt);
+        }
+    }
+
+    // Socket and per-client state are single-threaded
+    for (Slot* slot : due_) {
+        slot->match->sendSnapshot();
+    }
+
+    return static_cast<u32>(due_.size());
+}
+
+void MatchHost::updateLobbies(f32 deltaTime) {
+    for (auto it = matches_.begin(); it != matches_.end();) {
+        Match& match = *it->second.match;
+        match.update(deltaTime);
+
+        // Stragglers of a finished match are sent away before it goes
+        if (match.isFinished()) {
+            network_.disconnectMatch(it->first);
+            LOG_INFO("MatchHost: closed match {} (missed deadlines: {})", it->first, it->second.deadline.getMissed());
+            it = matches_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+u32 MatchHost::getPlayerCount() const {
+    u32 players = 0;
+    for (const auto& [id, slot] : matches_) {
+        players += static_cast<u32>(slot.match->getPlayerCount());
+    }
+    return players;
+}
+
+u64 MatchHost::getMissedDeadlines() const {
+    u64 missed = 0;
+    for (const auto& [id, slot] : matches_) {
+        missed += slot.deadline.getMissed();
+    }
+    return missed;
+}
+
+} // namespace WorldEditor
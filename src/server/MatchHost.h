@@ -0,0 +1,148 @@
+#pragma once
+
+#include "ServerWorld.h"
+#include "MatchSlots.h"
+#include "network/NetworkServer.h"
+#include "core/Types.h"
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace WorldEditor {
+
+class JobSystem;
+
+// One hosted game: its own ServerWorld, players and tick deadline.
+// simulate() may run on a worker thread; everything else runs on the host thread.
+class Match {
+public:
+    struct ClientInfo {
+        ClientId clientId = 0;
+        u64 accountId = 0;
+        std::string username;
+        std::string heroName;
+        u8 teamSlot = 0;
+        bool isConnected = false;
+    };
+
+    // (matchId, accountId, teamSlot, heroName) - forwarded to the matchmaking coordinator
+    using OnPlayerDisconnectedCallback = std::function<void(u64, u64, u8, const std::string&)>;
+
+    Match(u64 matchId, u16 expectedPlayers, Network::NetworkServer& network, JobSystem* jobSystem, u32 tickRate);
+
+    u64 getId() const { return matchId_; }
+    u16 getExpectedPlayers() const { return expectedPlayers_; }
+    ServerWorld& getWorld() { return *serverWorld_; }
+    size_t getPlayerCount() const { return network_.getMatchClientCount(matchId_); }
+    // New players are only seated before the game starts
+    bool isJoinable() const { return !gameStarted_ && !gameEnded_; }
+    bool isFinished() const { return finished_; }
+
+    void setOnPlayerDisconnected(OnPlayerDisconnectedCallback callback) {
+        onPlayerDisconnected_ = callback;
+    }
+
+    // Network events, already routed to this match by connection
+    void onClientConnected(ClientId clientId);
+    void onClientDisconnected(ClientId clientId);
+    void onClientInput(ClientId clientId, const PlayerInput& input);
+    void onHeroPick(ClientId clientId, const std::string& heroName);
+    void onAllPicked();
+
+    // Lobby flow timers (pick delay, end-of-game linger)
+    void update(f32 deltaTime);
+
+    // Tick phase: advance the world and build each player's snapshot. Touches only this match.
+    void simulate(f32 deltaTime);
+    // Send phase: hand the snapshots to the (single-threaded) network server
+    void sendSnapshot();
+
+private:
+    void spawnHeroesForClients();
+    void calculateGameResult();
+
+    u64 matchId_;
+    u16 expectedPlayers_;
+    Network::NetworkServer& network_;
+    UniquePtr<ServerWorld> serverWorld_;
+
+    // Game state
+    bool gameStarted_ = false;
+    bool gameEnded_ = false;
+    bool finished_ = false;
+    f32 gameEndTimer_ = 0.0f;
+    f32 gameStartDelay_ = 0.0f;  // Delay after hero pick before game starts
+    f32 emptyTimer_ = 0.0f;        // Time spent waiting for the first player
+    size_t minPlayersToPlay_ = 1;  // Minimum players to continue game
+    size_t connectedPlayers_ = 0;  // Owned by the host thread, read by simulate()
+
+    WorldSnapshot snapshot_;
+    std::unordered_map<ClientId, WorldSnapshot> clientSnapshots_;   // snapshot_ filtered per player
+    bool hasSnapshot_ = false;
+
+    std::unordered_map<ClientId, ClientInfo> clients_;
+    OnPlayerDisconnectedCallback onPlayerDisconnected_;
+};
+
+// Runs many matches in one process on a shared worker pool. Each match keeps its own
+// fixed-rate deadline; every host pass ticks the matches that are due in parallel and
+// then sends their snapshots from the host thread.
+class MatchHost {
+public:
+    MatchHost(Network::NetworkServer& network, JobSystem* jobSystem, u32 maxMatches, u32 tickRate);
+
+    // Matchmaking assigned a lobby to us. nullptr when every slot is taken.
+    Match* createMatch(u64 matchId, u16 expectedPlayers);
+    Match* findMatch(u64 matchId);
+
+    // NetworkServer::MatchResolver: lobby 0 (direct connect) joins or opens a local match,
+    // any other lobby must already have been assigned by createMatch
+    bool resolveMatch(u64 lobbyId, u64& matchId);
+
+    // Tick every due match; returns how many ticked (0 = the caller may sleep)
+    u32 update(f64 now);
+    // Lobby timers and removal of finished matches, once per host pass
+    void updateLobbies(f32 deltaTime);
+
+    Match* getClientMatch(ClientId clientId);
+
+    u32 getMaxMatches() const { return maxMatches_; }
+    u32 getMatchCount() const { return static_cast<u32>(matches_.size()); }
+    u32 getPlayerCount() const;
+    u32 getPlayerCapacity() const { return maxMatches_ * Network::MAX_CLIENTS; }
+    u64 getMissedDeadlines() const;
+
+    // Matches that fall further behind than this skip ticks instead of catching up
+    static constexpr u32 MAX_CATCH_UP_TICKS = 5;
+
+    void setOnPlayerDisconnected(Match::OnPlayerDisconnectedCallback callback) {
+        onPlayerDisconnected_ = callback;
+    }
+
+    // First id for direct-connect (lobby 0) matches; lobbies keep the coordinator's id
+    static constexpr u64 LOCAL_MATCH_BASE = 1ull << 63;
+
+private:
+    struct Slot {
+        UniquePtr<Match> match;
+        TickDeadline deadline;      // In host clock seconds
+        bool local = false;         // Opened by a direct connect, not by matchmaking
+    };
+
+    Match* openMatch(u64 matchId, u16 expectedPlayers, bool local);
+
+    Network::NetworkServer& network_;
+    JobSystem* jobSystem_;
+    u32 maxMatches_;
+    u32 tickRate_;
+    f64 tickInterval_;
+    f64 now_ = 0.0;
+    u64 nextLocalMatchId_ = LOCAL_MATCH_BASE;
+
+    std::unordered_map<u64, Slot> matches_;
+    Vector<Slot*> due_;
+    Vector<MatchSlotInfo> slotInfo_;    // Admission scratch
+    Match::OnPlayerDisconnectedCallback onPlayerDisconnected_;
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,56 @@
+#include "MatchSlots.h"
+
+namespace WorldEditor {
+
+LobbyAdmission admitLobby(const Vector<MatchSlotInfo>& slots, u64 lobbyId, size_t maxPlayers, u64& matchId) {
+    if (lobbyId != 0) {
+        // Only lobbies the coordinator assigned to us. A client that beats AssignLobby
+        // here is rejected and retries until the lobby shows up.
+        for (const auto& slot : slots) {
+            if (slot.matchId == lobbyId) {
+                if (slot.local || slot.finished) {
+                    return LobbyAdmission::Reject;
+                }
+                matchId = lobbyId;
+                return LobbyAdmission::Join;
+            }
+        }
+        return LobbyAdmission::Reject;
+    }
+
+    // Direct connect: fill the lowest open local match
+    u64 best = 0;
+    for (const auto& slot : slots) {
+        if (slot.local && slot.joinable && !slot.finished && slot.players < maxPlayers &&
+            (best == 0 || slot.matchId < best)) {
+            best = slot.matchId;
+        }
+    }
+    if (best == 0) {
+        return LobbyAdmission::OpenLocal;
+    }
+    matchId = best;
+    return LobbyAdmission::Join;
+}
+
+bool TickDeadline::poll(f64 now, f64& skippedBehind) {
+    skippedBehind = 0.0;
+    if (now < nextTickTime_) {
+        return false;
+    }
+
+    // Started a whole interval late: this tick missed its deadline
+    const f64 lateness = now - nextTickTime_;
+    if (lateness >= interval_) {
+        missed_++;
+    }
+    // Too far behind to catch up without starving the other matches
+    if (lateness >= interval_ * maxCatchUp_) {
+        skippedBehind = lateness;
+        nextTickTime_ = now;
+    }
+    nextTickTime_ += interval_;
+    return true;
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "core/Types.h"
+
+namespace WorldEditor {
+
+// The parts of MatchHost that need neither the socket nor a world: which match a
+// connecting client is admitted to, and when each match ticks.
+
+// What admission needs to know about one hosted match
+struct MatchSlotInfo {
+    u64 matchId = 0;
+    bool local = false;         // Opened by a direct connect, not by matchmaking
+    bool joinable = false;      // Still seating players
+    bool finished = false;
+    size_t players = 0;
+};
+
+enum class LobbyAdmission : u8 {
+    Reject,
+    Join,           // matchId is set
+    OpenLocal       // Direct connect and no local match has room: open one
+};
+
+// lobbyId != 0: only a live lobby the coordinator assigned, never a local match.
+// lobbyId == 0 (direct connect): the lowest-id joinable local match with a free seat.
+LobbyAdmission admitLobby(const Vector<MatchSlotInfo>& slots, u64 lobbyId, size_t maxPlayers, u64& matchId);
+
+// Fixed-rate deadline of one match on the host clock. A tick that starts a whole
+// interval late counts as missed; more than maxCatchUp intervals behind, the backlog
+// is dropped instead of being run back to back.
+class TickDeadline {
+public:
+    TickDeadline() = default;
+    TickDeadline(f64 interval, f64 now, u32 maxCatchUp)
+        : interval_(interval), nextTickTime_(now + interval), maxCatchUp_(maxCatchUp) {}
+
+    // True when a tick is due at now; moves the deadline on by one interval.
+    // skippedBehind is how far behind the dropped backlog was, 0 if none.
+    bool poll(f64 now, f64& skippedBehind);
+
+    f64 getNextTickTime() const { return nextTickTime_; }
+    u64 getMissed() const { return missed_; }
+
+private:
+    f64 interval_ = 0.0;
+    f64 nextTickTime_ = 0.0;
+    u32 maxCatchUp_ = 0;
+    u64 missed_ = 0;
+};
+
+} // namespace WorldEditor
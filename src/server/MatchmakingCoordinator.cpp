@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <deque>
@@ -28,6 +29,9 @@ using namespace WorldEditor::Matchmaking::Wire;
 
 namespace {
 
+// Two heartbeat intervals: long enough for the server to report a new match
+constexpr f32 kAssignSettleSeconds = 5.0f;
+
 static u64 RandomU64() {
     static std::mt19937_64 rng{ std::random_device{}() };
     return rng();
@@ -78,7 +82,9 @@ struct ServerEntry {
     u16 currentPlayers = 0;
     f32 uptimeSeconds = 0.0f;
     f32 timeSinceHeartbeat = 0.0f;
-    bool reserved = false;
+    u16 maxMatches = 1;           // Match slots the server hosts concurrently
+    u16 activeMatches = 0;
+    f32 timeSinceAssign = 1e9f;   // Heartbeats older than an assignment undercount it
     NetworkAddress controlAddr; // address we received ServerRegister from
 };
 
@@ -200,6 +206,7 @@ private:
         // Server pool TTL.
         for (auto it = servers_.begin(); it != servers_.end();) {
             it->second.timeSinceHeartbeat += dt;
+            it->second.timeSinceAssign += dt;
             // TTL 15s for now.
             if (it->second.timeSinceHeartbeat > 15.0f) {
                 LOG_WARN("Server {} timed out (no heartbeat)", it->second.serverId);
@@ -527,10 +534,11 @@ private:
         }
 
         ServerEntry& s = servers_.at(serverOpt.value());
-        s.reserved = true;
+        s.activeMatches++;
+        s.timeSinceAssign = 0.0f;
 
-        LOG_INFO("Lobby {} assigned to server {} {}:{}",
-                 l.lobbyId, s.serverId, s.ip, s.gamePort);
+        LOG_INFO("Lobby {} assigned to server {} {}:{} ({} / {} matches)",
+                 l.lobbyId, s.serverId, s.ip, s.gamePort, s.activeMatches, s.maxMatches);
 
         // Tell server (best-effort).
         AssignLobbyPayload ap{};
@@ -579,7 +587,7 @@ private:
 
         for (auto& kv : servers_) {
             ServerEntry& s = kv.second;
-            if (s.reserved) continue;
+            if (s.activeMatches >= s.maxMatches) continue;
             if (s.capacity > 0 && s.currentPlayers >= s.capacity) continue;
 
             // Prefer least loaded.
@@ -606,7 +614,8 @@ private:
         s.currentPlayers = 0;
         s.uptimeSeconds = 0.0f;
         s.timeSinceHeartbeat = 0.0f;
-        s.reserved = false;
+        s.maxMatches = std::max<u16>(p->maxMatches, 1);
+        s.activeMatches = 0;
         s.controlAddr = from;
 
         if (s.serverId == 0 || s.ip.empty() || s.gamePort == 0) {
@@ -614,23 +623,32 @@ private:
         }
 
         servers_[s.serverId] = s;
-        LOG_INFO("Server registered: id={} {}:{} cap={}", s.serverId, s.ip, s.gamePort, s.capacity);
+        LOG_INFO("Server registered: id={} {}:{} cap={} matches={}", s.serverId, s.ip, s.gamePort, s.capacity, s.maxMatches);
     }
 
     void onServerHeartbeat(const void* payload, u32 payloadSize) {
-        if (!payload || payloadSize < sizeof(ServerHeartbeatPayload)) return;
-        const auto* p = static_cast<const ServerHeartbeatPayload*>(payload);
-        auto it = servers_.find(p->serverId);
+        // Older servers stop before the match counters
+        if (!payload || payloadSize < offsetof(ServerHeartbeatPayload, activeMatches)) return;
+        ServerHeartbeatPayload p{};
+        std::memcpy(&p, payload, std::min<size_t>(payloadSize, sizeof(p)));
+        auto it = servers_.find(p.serverId);
         if (it == servers_.end()) return;
 
         ServerEntry& s = it->second;
-        s.currentPlayers = p->currentPlayers;
-        s.capacity = p->capacity;
-        s.uptimeSeconds = p->uptimeSeconds;
+        s.currentPlayers = p.currentPlayers;
+        s.capacity = p.capacity;
+        s.uptimeSeconds = p.uptimeSeconds;
         s.timeSinceHeartbeat = 0.0f;
-        if (s.reserved && s.currentPlayers == 0) {
-            // allow reuse after match ends (simple heuristic)
-            s.reserved = false;
+
+        if (payloadSize >= sizeof(ServerHeartbeatPayload)) {
+            // Trust the server's count, except right after we assigned it a lobby
+            s.maxMatches = std::max<u16>(p.maxMatches, 1);
+            s.activeMatches = s.timeSinceAssign < kAssignSettleSeconds
+                ? std::max(s.activeMatches, p.activeMatches)
+                : p.activeMatches;
+        } else if (s.currentPlayers == 0) {
+            // Single-match server: reuse after match ends (simple heuristic)
+            s.activeMatches = 0;
         }
     }
     
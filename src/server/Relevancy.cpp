@@ -0,0 +1,53 @@
+#include "Relevancy.h"
+#include "world/Components.h"
+
+namespace WorldEditor {
+
+namespace {
+
+bool withinGroundRadius(const Vec3& a, const Vec3& b, f32 radius) {
+    const f32 dx = b.x - a.x;
+    const f32 dz = b.z - a.z;
+    return dx * dx + dz * dz <= radius * radius;
+}
+
+} // namespace
+
+void RelevancyFilter::update(ClientId clientId, const View& view, const EntityManager& entityManager) {
+    const Registry& registry = entityManager.getRegistry();
+    const VisibilityGrid& visibility = entityManager.getVisibility();
+    std::unordered_set<Entity>& current = relevant_[clientId];
+    const bool limited = view.hasHero || view.hasCamera;
+
+    next_.clear();
+    auto transforms = registry.view<TransformComponent>();
+    for (auto entity : transforms) {
+        if (!visibility.isVisibleTo(view.teamId, entity)) {
+            continue;
+        }
+        if (!limited || registry.all_of<HeroComponent>(entity) || registry.all_of<ObjectComponent>(entity)) {
+            next_.insert(entity);
+            continue;
+        }
+
+        const f32 margin = current.count(entity) ? settings_.hysteresis : 0.0f;
+        const Vec3& position = transforms.get<TransformComponent>(entity).position;
+        if ((view.hasHero && withinGroundRadius(position, view.heroPosition, settings_.heroRadius + margin)) ||
+            (view.hasCamera && withinGroundRadius(position, view.cameraFocus, settings_.cameraRadius + margin))) {
+            next_.insert(entity);
+        }
+    }
+    current.swap(next_);
+}
+
+bool RelevancyFilter::isRelevant(ClientId clientId, Entity entity) const {
+    auto it = relevant_.find(clientId);
+    return it != relevant_.end() && it->second.count(entity) > 0;
+}
+
+size_t RelevancyFilter::getRelevantCount(ClientId clientId) const {
+    auto it = relevant_.find(clientId);
+    return it != relevant_.end() ? it->second.size() : 0;
+}
+
+} // namespace WorldEditor
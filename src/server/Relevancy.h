@@ -0,0 +1,55 @@
+#pragma once
+
+#include "common/NetworkTypes.h"
+#include "world/EntityManager.h"
+#include "core/Types.h"
+#include <unordered_set>
+
+namespace WorldEditor {
+
+// Interest radii in world units
+struct RelevancySettings {
+    f32 heroRadius = 2200.0f;       // Around the client's own hero
+    f32 cameraRadius = 1800.0f;     // Around the ground point the client's camera looks at
+    f32 hysteresis = 400.0f;        // Extra distance before a relevant unit is dropped
+};
+
+// Per-client interest management for snapshots. An entity is relevant to a client when
+// the client's team sees it (VisibilityGrid) and it matters to that client: heroes and
+// structures at any distance (minimap, and they cost little once deltas apply), other
+// units only near the client's hero or camera focus.
+//
+// A unit that is already relevant stays so until it is `hysteresis` past the radius, so
+// units on the edge do not flicker in and out. Vision gets no such grace: an enemy that
+// leaves vision is dropped at once, otherwise the snapshot would reveal it.
+class RelevancyFilter {
+public:
+    // What one client looks at
+    struct View {
+        TeamId teamId = TEAM_NEUTRAL;   // Teams other than Radiant and Dire see everything
+        bool hasHero = false;
+        Vec3 heroPosition = Vec3(0.0f);
+        bool hasCamera = false;
+        Vec3 cameraFocus = Vec3(0.0f);
+    };
+
+    void setSettings(const RelevancySettings& settings) { settings_ = settings; }
+    const RelevancySettings& getSettings() const { return settings_; }
+
+    // Re-evaluates the client's relevant set against the current world. A view with
+    // neither hero nor camera has no distance limit.
+    void update(ClientId clientId, const View& view, const EntityManager& entityManager);
+
+    bool isRelevant(ClientId clientId, Entity entity) const;
+    size_t getRelevantCount(ClientId clientId) const;
+
+    void removeClient(ClientId clientId) { relevant_.erase(clientId); }
+    void clear() { relevant_.clear(); }
+
+private:
+    RelevancySettings settings_;
+    Map<ClientId, std::unordered_set<Entity>> relevant_;
+    std::unordered_set<Entity> next_;   // Scratch set swapped in by update()
+};
+
+} // namespace WorldEditor
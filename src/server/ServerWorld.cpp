@@ -1,25 +1,69 @@
 #include "ServerWorld.h"
 #include "world/Components.h"
 #include "world/System.h"
-#include "world/WorldLegacy.h"
 #include "world/HeroSystem.h"
 #include "world/CreepSpawnSystem.h"
+#include "core/Profiler.h"
 #include <algorithm>
+#include <cmath>
+
+#ifdef DIRECTX_RENDERER
+#include "world/WorldLegacy.h"
+#endif
 
 namespace WorldEditor {
 
+namespace {
+
+// Frames of transform history covering the lag compensation window at this tick rate
+size_t historyFrameCount(u32 tickRate) {
+    return static_cast<size_t>(std::ceil(NetworkConfig::LAG_COMPENSATION_WINDOW * static_cast<f32>(tickRate))) + 1;
+}
+
+f32 groundDistance(const Vec3& a, const Vec3& b) {
+    Vec3 delta = b - a;
+    delta.y = 0.0f;
+    return glm::length(delta);
+}
+
+} // namespace
+
 ServerWorld::ServerWorld() {
     entityManager_.setWorld(nullptr); // Will be set properly when needed
+    systems_.setSyncPoint([this]() { syncPoint(); });
+    transformHistory_.setFrameCount(historyFrameCount(tickRate_));
+    connectNetworkIdHooks();
 }
 
 #ifdef DIRECTX_RENDERER
 ServerWorld::ServerWorld(ID3D12Device* device) : device_(device) {
     entityManager_.setWorld(nullptr);
+    systems_.setSyncPoint([this]() { syncPoint(); });
+    transformHistory_.setFrameCount(historyFrameCount(tickRate_));
+    connectNetworkIdHooks();
 }
 #endif
 
 ServerWorld::~ServerWorld() {
     clear();
+    auto& registry = entityManager_.getRegistry();
+    registry.on_construct<CreepComponent>().disconnect(*this);
+    registry.on_construct<ObjectComponent>().disconnect(*this);
+    registry.on_update<ObjectComponent>().disconnect(*this);
+    registry.on_destroy<HeroComponent>().disconnect(*this);
+    registry.on_destroy<CreepComponent>().disconnect(*this);
+    registry.on_destroy<ObjectComponent>().disconnect(*this);
+}
+
+void ServerWorld::connectNetworkIdHooks() {
+    auto& registry = entityManager_.getRegistry();
+    registry.on_construct<CreepComponent>().connect<&ServerWorld::onCreepConstructed>(*this);
+    registry.on_construct<ObjectComponent>().connect<&ServerWorld::onObjectChanged>(*this);
+    registry.on_update<ObjectComponent>().connect<&ServerWorld::onObjectChanged>(*this);
+    // Also catches command-buffer destroys and dead creep cleanup
+    registry.on_destroy<HeroComponent>().connect<&ServerWorld::onReplicatedDestroyed>(*this);
+    registry.on_destroy<CreepComponent>().connect<&ServerWorld::onReplicatedDestroyed>(*this);
+    registry.on_destroy<ObjectComponent>().connect<&ServerWorld::onReplicatedDestroyed>(*this);
 }
 
 void ServerWorld::update(f32 deltaTime) {
@@ -38,16 +82,37 @@ void ServerWorld::update(f32 deltaTime) {
         // Update game state
         updateGameState(tickInterval);
         
+        // Positions as of this tick's snapshot time, for rewinding client commands
+        transformHistory_.record(entityManager_.getRegistry(), gameTime_);
+        
         tickAccumulator_ -= tickInterval;
         currentTick_++;
     }
 }
 
+void ServerWorld::setTickRate(u32 tickRate) {
+    tickRate_ = tickRate;
+    transformHistory_.setFrameCount(historyFrameCount(tickRate_));
+}
+
 void ServerWorld::updateSystems(f32 deltaTime) {
-    // Update all systems in order
-    for (auto& [name, system] : systems_) {
-        system->update(deltaTime);
-    }
+    PROFILE_SCOPE("ServerWorld::updateSystems");
+    assignPendingNetworkIds();
+    
+    // Proximity queries in every system read from this tick's grid
+    entityManager_.rebuildSpatialGrid();
+    // Units can only target what their team sees
+    entityManager_.updateVisibility();
+    entityManager_.getCombatEvents().clearKills();
+    
+    // Dependency-ordered, deterministic system execution
+    systems_.update(deltaTime);
+}
+
+void ServerWorld::syncPoint() {
+    // Damage recorded this stage lands before the stage's destroys take effect
+    entityManager_.resolveCombat();
+    entityManager_.flushCommands();
 }
 
 void ServerWorld::updateGameState(f32 deltaTime) {
@@ -80,7 +145,11 @@ void ServerWorld::clear() {
     entityManager_.clear();
     entityToNetworkId_.clear();
     networkIdToEntity_.clear();
+    pendingObjects_.clear();
     clientToEntity_.clear();
+    clientCameraFocus_.clear();
+    transformHistory_.clear();
+    relevancy_.clear();
     nextNetworkId_ = 1;
     currentTick_ = 0;
     gameTime_ = 0.0f;
@@ -125,7 +194,37 @@ void ServerWorld::removeNetworkId(Entity entity) {
     }
 }
 
+void ServerWorld::onCreepConstructed(Registry&, Entity entity) {
+    if (!entityToNetworkId_.count(entity)) {
+        assignNetworkId(entity);
+    }
+}
+
+void ServerWorld::onObjectChanged(Registry&, Entity entity) {
+    pendingObjects_.push_back(entity);
+}
+
+void ServerWorld::onReplicatedDestroyed(Registry&, Entity entity) {
+    removeNetworkId(entity);
+}
+
+void ServerWorld::assignPendingNetworkIds() {
+    // Of the map objects only towers are replicated
+    for (Entity entity : pendingObjects_) {
+        if (isValid(entity) && hasComponent<ObjectComponent>(entity) &&
+            getComponent<ObjectComponent>(entity).type == ObjectType::Tower &&
+            !entityToNetworkId_.count(entity)) {
+            assignNetworkId(entity);
+        }
+    }
+    pendingObjects_.clear();
+}
+
 void ServerWorld::processInput(ClientId clientId, const PlayerInput& input) {
+    if (input.hasCameraFocus) {
+        clientCameraFocus_[clientId] = input.cameraFocus;
+    }
+    
     // Find client's controlled entity
     auto it = clientToEntity_.find(clientId);
     if (it == clientToEntity_.end()) {
@@ -133,34 +232,136 @@ void ServerWorld::processInput(ClientId clientId, const PlayerInput& input) {
     }
     
     Entity heroEntity = it->second;
-    if (!isValid(heroEntity)) {
+    if (!isValid(heroEntity) || !hasComponent<HeroComponent>(heroEntity)) {
         return;
     }
     
+    auto* heroSystem = static_cast<HeroSystem*>(getSystem("HeroSystem"));
+    if (!heroSystem) {
+        return;
+    }
+    
+    // Clients resend their current order every input tick; only changes are applied
+    const auto& hero = getComponent<HeroComponent>(heroEntity);
+    const Vec3 heroPosition = getComponent<TransformComponent>(heroEntity).position;
+    
+    // Targets are judged where the client saw them, at most LAG_COMPENSATION_WINDOW ago
+    const f32 viewTime = transformHistory_.clampTime(input.timestamp);
+    
     // Process input based on command type
     switch (input.commandType) {
         case InputCommandType::Move:
-            // TODO: Issue move command to hero
+        case InputCommandType::AttackMove: {
+            const bool attackMove = input.isAttackMove || input.commandType == InputCommandType::AttackMove;
+            // Compared with the ordered goal: the path may end short of it (unreachable or snapped)
+            if (hero.hasMoveOrder && hero.moveOrderAttackMove == attackMove &&
+                hero.moveOrderGoal == input.targetPosition) {
+                break;
+            }
+            HeroCommand command;
+            command.type = attackMove ? HeroCommand::Type::AttackMove : HeroCommand::Type::MoveTo;
+            command.targetPosition = input.targetPosition;
+            heroSystem->issueCommand(heroEntity, command);
             break;
+        }
             
-        case InputCommandType::AttackTarget:
-            // TODO: Issue attack command to hero
+        case InputCommandType::AttackTarget: {
+            const Entity target = getEntityByNetworkId(input.targetEntityId);
+            if (hero.state == HeroState::Attacking && hero.targetEntity == target) {
+                break;
+            }
+            // The hero closes in by itself; the target only has to be an enemy the client could see
+            Vec3 seenPosition;
+            if (!isEnemyTarget(heroEntity, target) || !getTargetPositionAt(target, viewTime, seenPosition)) {
+                break;
+            }
+            heroSystem->attackTarget(heroEntity, target);
             break;
+        }
             
-        case InputCommandType::CastAbility:
-            // TODO: Cast ability
+        case InputCommandType::CastAbility: {
+            const i32 abilityIndex = input.abilityIndex;
+            if (abilityIndex < 0 || abilityIndex >= 6) {
+                break;
+            }
+            if (hero.state == HeroState::CastingAbility && hero.currentCastingAbility == abilityIndex) {
+                break;
+            }
+            
+            const f32 castRange = hero.abilities[abilityIndex].data.castRange;
+            Entity target = INVALID_ENTITY;
+            Vec3 targetPosition = input.abilityTargetPosition;
+            if (input.abilityTargetType == TargetType::Unit) {
+                // In range of where the target was on the client's screen
+                target = getEntityByNetworkId(input.abilityTargetEntityId);
+                Vec3 seenPosition;
+                if (!getTargetPositionAt(target, viewTime, seenPosition) ||
+                    groundDistance(heroPosition, seenPosition) > castRange) {
+                    break;
+                }
+                targetPosition = getComponent<TransformComponent>(target).position;
+            } else if (input.abilityTargetType == TargetType::Position &&
+                       groundDistance(heroPosition, targetPosition) > castRange) {
+                break;
+            }
+            heroSystem->castAbility(heroEntity, abilityIndex, targetPosition, target);
             break;
+        }
             
         case InputCommandType::Stop:
-            // TODO: Stop hero
+            heroSystem->stopHero(heroEntity);
             break;
             
+        case InputCommandType::Hold: {
+            HeroCommand command;
+            command.type = HeroCommand::Type::Hold;
+            heroSystem->issueCommand(heroEntity, command);
+            break;
+        }
+            
         default:
             break;
     }
 }
 
+bool ServerWorld::getTargetPositionAt(Entity target, f32 viewTime, Vec3& outPosition) const {
+    if (target == INVALID_ENTITY || !isValid(target) || !hasComponent<TransformComponent>(target)) {
+        return false;
+    }
+    
+    // Heroes and creeps rewind; a unit without history was dead or not spawned yet
+    if (hasComponent<HeroComponent>(target) || hasComponent<CreepComponent>(target)) {
+        return transformHistory_.getPosition(target, viewTime, outPosition);
+    }
+    
+    // Structures stand still
+    if (hasComponent<HealthComponent>(target) && getComponent<HealthComponent>(target).isDead) {
+        return false;
+    }
+    outPosition = getComponent<TransformComponent>(target).position;
+    return true;
+}
+
+bool ServerWorld::isEnemyTarget(Entity hero, Entity target) const {
+    if (target == INVALID_ENTITY || !isValid(target)) {
+        return false;
+    }
+    
+    i32 targetTeam = 0;
+    if (hasComponent<HeroComponent>(target)) {
+        targetTeam = getComponent<HeroComponent>(target).teamId;
+    } else if (hasComponent<CreepComponent>(target)) {
+        targetTeam = getComponent<CreepComponent>(target).teamId;
+    } else if (hasComponent<ObjectComponent>(target)) {
+        targetTeam = getComponent<ObjectComponent>(target).teamId;
+    } else {
+        return false;
+    }
+    return targetTeam != getComponent<HeroComponent>(hero).teamId;
+}
+
 WorldSnapshot ServerWorld::createSnapshot() const {
+    PROFILE_SCOPE("ServerWorld::createSnapshot");
     WorldSnapshot snapshot;
     snapshot.tick = currentTick_;
     snapshot.serverTime = gameTime_;
@@ -179,9 +380,8 @@ WorldSnapshot ServerWorld::createSnapshot() const {
         }
     }
     
-    // Debug: log snapshot contents periodically
-    static int snapshotCount = 0;
-    if (++snapshotCount % 300 == 1) { // Every ~10 seconds at 30 tick rate
+    // Debug: log snapshot contents periodically (per world: matches snapshot concurrently)
+    if (++snapshotLogCounter_ % 300 == 1) { // Every ~10 seconds at 30 tick rate
         LOG_INFO("Snapshot: tick={}, entities={}", snapshot.tick, snapshot.entities.size());
         for (const auto& e : snapshot.entities) {
             LOG_INFO("  Entity: netId={}, type={}, owner={}, team={}, pos=({:.0f},{:.0f},{:.0f})", 
@@ -193,6 +393,40 @@ WorldSnapshot ServerWorld::createSnapshot() const {
     return snapshot;
 }
 
+void ServerWorld::filterSnapshot(ClientId clientId, const WorldSnapshot& snapshot, WorldSnapshot& out) {
+    PROFILE_SCOPE("ServerWorld::filterSnapshot");
+    
+    // Clients without a hero yet (pick phase) see everything
+    RelevancyFilter::View view;
+    auto heroIt = clientToEntity_.find(clientId);
+    if (heroIt != clientToEntity_.end() && isValid(heroIt->second) &&
+        hasComponent<HeroComponent>(heroIt->second) && hasComponent<TransformComponent>(heroIt->second)) {
+        view.teamId = getComponent<HeroComponent>(heroIt->second).teamId;
+        view.hasHero = true;
+        view.heroPosition = getComponent<TransformComponent>(heroIt->second).position;
+    }
+    auto cameraIt = clientCameraFocus_.find(clientId);
+    if (cameraIt != clientCameraFocus_.end()) {
+        view.hasCamera = true;
+        view.cameraFocus = cameraIt->second;
+    }
+    relevancy_.update(clientId, view, entityManager_);
+    
+    out.tick = snapshot.tick;
+    out.serverTime = snapshot.serverTime;
+    out.gameTime = snapshot.gameTime;
+    out.currentWave = snapshot.currentWave;
+    out.timeToNextWave = snapshot.timeToNextWave;
+    out.lastProcessedInput = snapshot.lastProcessedInput;
+    out.entities.clear();
+    for (const auto& entity : snapshot.entities) {
+        auto it = networkIdToEntity_.find(entity.networkId);
+        if (it != networkIdToEntity_.end() && relevancy_.isRelevant(clientId, it->second)) {
+            out.entities.push_back(entity);
+        }
+    }
+}
+
 EntitySnapshot ServerWorld::createEntitySnapshot(Entity entity) const {
     EntitySnapshot snapshot;
     
@@ -265,6 +499,9 @@ void ServerWorld::startGame() {
     currentWave_ = 0;
     timeToNextWave_ = 30.0f;
     
+    // Towers loaded with the map are in the first snapshot
+    assignPendingNetworkIds();
+    
     // Start creep spawning
     if (auto* spawnSystem = static_cast<CreepSpawnSystem*>(getSystem("CreepSpawnSystem"))) {
         spawnSystem->startGame();
@@ -301,9 +538,9 @@ void ServerWorld::startGame() {
                 assignNetworkId(playerHero);
                 
                 // Give starting items
-                heroSystem->giveItem(playerHero, HeroSystem::createItem_Tango());
-                heroSystem->giveItem(playerHero, HeroSystem::createItem_IronBranch());
-                heroSystem->giveItem(playerHero, HeroSystem::createItem_IronBranch());
+                heroSystem->giveItem(playerHero, "tango");
+                heroSystem->giveItem(playerHero, "iron_branch");
+                heroSystem->giveItem(playerHero, "iron_branch");
                 
                 // Learn first ability
                 heroSystem->learnAbility(playerHero, 0);
@@ -322,8 +559,8 @@ void ServerWorld::startGame() {
                     enemyComp.isPlayerControlled = false;
                     enemyComp.heroName = "Enemy Mage";
                     
-                    heroSystem->giveItem(enemyHero, HeroSystem::createItem_IronBranch());
-                    heroSystem->giveItem(enemyHero, HeroSystem::createItem_IronBranch());
+                    heroSystem->giveItem(enemyHero, "iron_branch");
+                    heroSystem->giveItem(enemyHero, "iron_branch");
                     
                     heroSystem->learnAbility(enemyHero, 0);
                     heroSystem->learnAbility(enemyHero, 1);
@@ -353,6 +590,8 @@ void ServerWorld::resetGame() {
     currentWave_ = 0;
     timeToNextWave_ = 30.0f;
     currentTick_ = 0;
+    transformHistory_.clear();
+    relevancy_.clear();
     
     if (auto* spawnSystem = static_cast<CreepSpawnSystem*>(getSystem("CreepSpawnSystem"))) {
         spawnSystem->resetGame();
@@ -371,6 +610,8 @@ void ServerWorld::setClientHero(ClientId clientId, Entity heroEntity) {
 
 void ServerWorld::removeClient(ClientId clientId) {
     clientToEntity_.erase(clientId);
+    clientCameraFocus_.erase(clientId);
+    relevancy_.removeClient(clientId);
 }
 
 Entity ServerWorld::getClientControlledEntity(ClientId clientId) const {
@@ -379,22 +620,19 @@ Entity ServerWorld::getClientControlledEntity(ClientId clientId) const {
 }
 
 void ServerWorld::addSystem(UniquePtr<System> system) {
-    String name = system->getName();
-    systems_[name] = std::move(system);
+    systems_.add(std::move(system));
 }
 
 void ServerWorld::removeSystem(const String& name) {
-    systems_.erase(name);
+    systems_.remove(name);
 }
 
 System* ServerWorld::getSystem(const String& name) {
-    auto it = systems_.find(name);
-    return (it != systems_.end()) ? it->second.get() : nullptr;
+    return systems_.find(name);
 }
 
 const System* ServerWorld::getSystem(const String& name) const {
-    auto it = systems_.find(name);
-    return (it != systems_.end()) ? it->second.get() : nullptr;
+    return systems_.find(name);
 }
 
 #ifdef DIRECTX_RENDERER
@@ -3,6 +3,9 @@
 #include "common/IGameWorld.h"
 #include "world/EntityManager.h"
 #include "world/System.h"
+#include "world/SystemScheduler.h"
+#include "world/TransformHistory.h"
+#include "Relevancy.h"
 #include "core/Types.h"
 
 #ifdef DIRECTX_RENDERER
@@ -49,6 +52,11 @@ public:
     // Client hero management
     void setClientHero(ClientId clientId, Entity heroEntity);
     
+    // Copies the entities of snapshot that are relevant to the client into out (fog of
+    // war, distance to its hero and camera); updates the client's relevant set
+    void filterSnapshot(ClientId clientId, const WorldSnapshot& snapshot, WorldSnapshot& out);
+    RelevancyFilter& getRelevancyFilter() { return relevancy_; }
+    
     // Component management (forwarded to EntityManager)
     template<typename Component, typename... Args>
     Component& addComponent(Entity entity, Args&&... args) {
@@ -81,6 +89,16 @@ public:
     System* getSystem(const String& name);
     const System* getSystem(const String& name) const;
     
+    // Serial (default, replay-safe) or Parallel execution of independent systems
+    void setSystemExecutionMode(SystemScheduler::ExecutionMode mode) { systems_.setExecutionMode(mode); }
+    SystemScheduler& getSystemScheduler() { return systems_; }
+    
+    // Shared worker pool for parallel systems and EntityManager::parallelForEach (not owned)
+    void setJobSystem(JobSystem* jobSystem) {
+        entityManager_.setJobSystem(jobSystem);
+        systems_.setJobSystem(jobSystem);
+    }
+    
     // Rendering (for editor/standalone server with visualization)
 #ifdef DIRECTX_RENDERER
     void render(ID3D12GraphicsCommandList* commandList,
@@ -91,30 +109,39 @@ public:
     
     // Tick management
     TickNumber getCurrentTick() const { return currentTick_; }
-    void setTickRate(u32 tickRate) { tickRate_ = tickRate; }
+    void setTickRate(u32 tickRate);
+    
+    // Unit positions over the last LAG_COMPENSATION_WINDOW, recorded every tick
+    const TransformHistory& getTransformHistory() const { return transformHistory_; }
     
     // Set game active without creating default heroes (for multiplayer clients)
     void setGameActive(bool active) { gameActive_ = active; }
     
-    // Network ID assignment (for external hero creation)
+    // Network ID assignment (for external hero creation). Creeps get theirs when the
+    // component is emplaced and towers on the next tick; all release theirs on destroy.
     NetworkId assignNetworkId(Entity entity);
     
 private:
     EntityManager entityManager_;
-    Map<String, UniquePtr<System>> systems_;
+    SystemScheduler systems_;
     
     // Network ID mapping
     Map<Entity, NetworkId> entityToNetworkId_;
     Map<NetworkId, Entity> networkIdToEntity_;
     NetworkId nextNetworkId_ = 1;
+    Vector<Entity> pendingObjects_;         // Object type is set after emplace; checked next tick
     
     // Client management
     Map<ClientId, Entity> clientToEntity_;  // Client -> controlled hero
+    Map<ClientId, Vec3> clientCameraFocus_; // Latest camera focus each client reported
+    RelevancyFilter relevancy_;
     
     // Simulation state
     TickNumber currentTick_ = 0;
     u32 tickRate_ = NetworkConfig::SERVER_TICK_RATE;
     f32 tickAccumulator_ = 0.0f;
+    mutable u32 snapshotLogCounter_ = 0;
+    TransformHistory transformHistory_;
     
     // Game state
     bool gameActive_ = false;
@@ -129,9 +156,19 @@ private:
     
     // Helper methods
     void removeNetworkId(Entity entity);
+    void connectNetworkIdHooks();
+    void onCreepConstructed(Registry& registry, Entity entity);
+    void onObjectChanged(Registry& registry, Entity entity);
+    void onReplicatedDestroyed(Registry& registry, Entity entity);
+    void assignPendingNetworkIds();
     void updateSystems(f32 deltaTime);
+    void syncPoint();
     void updateGameState(f32 deltaTime);
     EntitySnapshot createEntitySnapshot(Entity entity) const;
+    
+    // Lag compensation: where a target stood at viewTime, false if it was not targetable
+    bool getTargetPositionAt(Entity target, f32 viewTime, Vec3& outPosition) const;
+    bool isEnemyTarget(Entity hero, Entity target) const;
 };
 
 } // namespace WorldEditor
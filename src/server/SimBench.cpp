@@ -0,0 +1,336 @@
+// Headless server tick benchmark.
+//
+// Loads a map, runs the authoritative simulation for N minutes with scripted heroes and
+// prints per-system tick cost (mean/p50/p99 microseconds) and entity counts as JSON, so
+// tick cost can be tracked commit-to-commit. No renderer, device or network involved.
+//
+// Usage: sim_bench <map.json> [--minutes N] [--heroes N] [--tick-rate N] [--seed N]
+//                  [--parallel] [--ai-budget-us N] [--out file.json] [--trace trace.json]
+
+#include "ServerWorld.h"
+#include "world/World.h"
+#include "world/HeroSystem.h"
+#include "world/CreepSystem.h"
+#include "world/CreepSpawnSystem.h"
+#include "world/TowerSystem.h"
+#include "world/ProjectileSystem.h"
+#include "serialization/MapIO.h"
+#include "core/JobSystem.h"
+#include "core/Timer.h"
+#include "core/Profiler.h"
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+using namespace WorldEditor;
+using json = nlohmann::json;
+
+namespace {
+
+struct BenchOptions {
+    String mapPath;
+    String outPath;
+    String tracePath;
+    f32 minutes = 10.0f;
+    i32 heroesPerTeam = 5;
+    u32 tickRate = 30;
+    u32 seed = 1;
+    u32 aiBudgetMicroseconds = 0;
+    bool parallel = false;
+};
+
+struct EntityCounts {
+    size_t total = 0;
+    size_t creeps = 0;
+    size_t heroes = 0;
+    size_t projectiles = 0;
+    size_t towers = 0;
+};
+
+// Heroes push the nearest enemy in reach, otherwise walk to the enemy base
+class HeroScript {
+public:
+    HeroScript(EntityManager& entityManager, HeroSystem& heroSystem)
+        : entityManager_(entityManager), heroSystem_(heroSystem) {}
+
+    void spawn(i32 heroesPerTeam, u32 seed) {
+        static const char* kHeroTypes[] = { "Warrior", "Assassin", "Mage", "Juggernaut", "Lina" };
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<f32> jitter(-5.0f, 5.0f);
+
+        findBases();
+        for (i32 team = 1; team <= 2; ++team) {
+            for (i32 i = 0; i < heroesPerTeam; ++i) {
+                const Vec3 spawnPos = baseOf(team) + Vec3(jitter(rng), 1.0f, jitter(rng));
+                Entity hero = heroSystem_.createHeroByType(kHeroTypes[i % 5], team, spawnPos);
+                if (hero == INVALID_ENTITY) {
+                    continue;
+                }
+                // The script drives them, not the built-in enemy AI
+                entityManager_.getComponent<HeroComponent>(hero).isPlayerControlled = true;
+                heroSystem_.learnAbility(hero, 0);
+                heroes_.push_back(hero);
+            }
+        }
+    }
+
+    void update(f32 deltaTime) {
+        thinkTimer_ -= deltaTime;
+        if (thinkTimer_ > 0.0f) {
+            return;
+        }
+        thinkTimer_ = 1.0f;
+
+        const auto& grid = entityManager_.getSpatialGrid();
+        for (Entity hero : heroes_) {
+            if (!entityManager_.isValid(hero)) {
+                continue;
+            }
+            const auto& heroComp = entityManager_.getComponent<HeroComponent>(hero);
+            if (heroComp.state == HeroState::Dead) {
+                continue;
+            }
+
+            const Vec3& position = entityManager_.getComponent<TransformComponent>(hero).position;
+            const SpatialFilter enemies = SpatialFilter::enemiesOf(heroComp.teamId, SpatialType::Units | SpatialType::Tower);
+            Entity target = grid.findNearest(position, 20.0f, enemies);
+            if (target != INVALID_ENTITY) {
+                heroSystem_.attackTarget(hero, target);
+                heroSystem_.castAbility(hero, 0, entityManager_.getComponent<TransformComponent>(target).position, target);
+            } else {
+                heroSystem_.moveToPosition(hero, baseOf(heroComp.teamId == 1 ? 2 : 1));
+            }
+        }
+    }
+
+private:
+    void findBases() {
+        auto view = entityManager_.getRegistry().view<ObjectComponent, TransformComponent>();
+        for (auto entity : view) {
+            const auto& obj = view.get<ObjectComponent>(entity);
+            if (obj.type == ObjectType::Base && (obj.teamId == 1 || obj.teamId == 2)) {
+                bases_[obj.teamId - 1] = view.get<TransformComponent>(entity).position;
+            }
+        }
+    }
+
+    Vec3 baseOf(i32 teamId) const { return bases_[teamId == 1 ? 0 : 1]; }
+
+    EntityManager& entityManager_;
+    HeroSystem& heroSystem_;
+    Vector<Entity> heroes_;
+    Vec3 bases_[2] = { Vec3(50.0f, 0.0f, 50.0f), Vec3(-50.0f, 0.0f, -50.0f) };
+    f32 thinkTimer_ = 0.0f;
+};
+
+bool parseArgs(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--minutes") == 0 && hasValue) {
+            options.minutes = static_cast<f32>(std::atof(argv[++i]));
+        } else if (std::strcmp(arg, "--heroes") == 0 && hasValue) {
+            options.heroesPerTeam = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--tick-rate") == 0 && hasValue) {
+            options.tickRate = static_cast<u32>(std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--seed") == 0 && hasValue) {
+            options.seed = static_cast<u32>(std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--out") == 0 && hasValue) {
+            options.outPath = argv[++i];
+        } else if (std::strcmp(arg, "--trace") == 0 && hasValue) {
+            options.tracePath = argv[++i];
+        } else if (std::strcmp(arg, "--ai-budget-us") == 0 && hasValue) {
+            options.aiBudgetMicroseconds = static_cast<u32>(std::atoi(argv[++i]));
+        } else if (std::strcmp(arg, "--parallel") == 0) {
+            options.parallel = true;
+        } else if (arg[0] != '-' && options.mapPath.empty()) {
+            options.mapPath = arg;
+        } else {
+            return false;
+        }
+    }
+    return !options.mapPath.empty() && options.minutes > 0.0f && options.tickRate > 0;
+}
+
+EntityCounts countEntities(EntityManager& entityManager) {
+    auto& registry = entityManager.getRegistry();
+    EntityCounts counts;
+    counts.total = entityManager.getEntityCount();
+    counts.creeps = registry.view<CreepComponent>().size();
+    counts.heroes = registry.view<HeroComponent>().size();
+    counts.projectiles = entityManager.getProjectiles().size();
+    for (auto entity : registry.view<ObjectComponent>()) {
+        if (registry.get<ObjectComponent>(entity).type == ObjectType::Tower) {
+            counts.towers++;
+        }
+    }
+    return counts;
+}
+
+json countsToJson(const EntityCounts& counts) {
+    return {
+        {"total", counts.total},
+        {"creeps", counts.creeps},
+        {"heroes", counts.heroes},
+        {"projectiles", counts.projectiles},
+        {"towers", counts.towers}
+    };
+}
+
+// Sorts samples in place
+json summarize(Vector<f64>& samples) {
+    if (samples.empty()) {
+        return {{"mean_us", 0.0}, {"p50_us", 0.0}, {"p99_us", 0.0}, {"max_us", 0.0}};
+    }
+    std::sort(samples.begin(), samples.end());
+    f64 sum = 0.0;
+    for (f64 sample : samples) {
+        sum += sample;
+    }
+    auto percentile = [&samples](f64 p) {
+        const size_t index = static_cast<size_t>(p * static_cast<f64>(samples.size() - 1) + 0.5);
+        return samples[std::min(index, samples.size() - 1)];
+    };
+    return {
+        {"mean_us", sum / static_cast<f64>(samples.size())},
+        {"p50_us", percentile(0.50)},
+        {"p99_us", percentile(0.99)},
+        {"max_us", samples.back()}
+    };
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseArgs(argc, argv, options)) {
+        std::cerr << "Usage: sim_bench <map.json> [--minutes N] [--heroes N] [--tick-rate N] "
+                     "[--seed N] [--parallel] [--ai-budget-us N] [--out file.json] [--trace trace.json]\n";
+        return 2;
+    }
+
+    // Keep stdout clean for the JSON report
+    spdlog::set_level(spdlog::level::warn);
+
+    World world;
+    String error;
+    if (!MapIO::load(world, options.mapPath, &error)) {
+        LOG_ERROR("sim_bench: failed to load '{}': {}", options.mapPath, error);
+        return 1;
+    }
+
+    ServerWorld& serverWorld = world.getServerWorld();
+    EntityManager& entityManager = serverWorld.getEntityManager();
+
+    serverWorld.addSystem(std::make_unique<HeroSystem>(entityManager));
+    auto creepSystem = std::make_unique<CreepSystem>(entityManager);
+    auto towerSystem = std::make_unique<TowerSystem>(entityManager);
+    if (options.aiBudgetMicroseconds > 0) {
+        AiLodSettings creepLod = creepSystem->getAiLod().getSettings();
+        creepLod.budgetMicroseconds = options.aiBudgetMicroseconds;
+        creepSystem->getAiLod().setSettings(creepLod);
+        AiLodSettings towerLod = towerSystem->getAiLod().getSettings();
+        towerLod.budgetMicroseconds = options.aiBudgetMicroseconds;
+        towerSystem->getAiLod().setSettings(towerLod);
+    }
+    serverWorld.addSystem(std::move(creepSystem));
+    serverWorld.addSystem(std::make_unique<CreepSpawnSystem>(entityManager));
+    serverWorld.addSystem(std::move(towerSystem));
+    serverWorld.addSystem(std::make_unique<ProjectileSystem>(entityManager));
+
+    UniquePtr<JobSystem> jobSystem;
+    if (options.parallel) {
+        jobSystem = std::make_unique<JobSystem>();
+        serverWorld.setJobSystem(jobSystem.get());
+        serverWorld.setSystemExecutionMode(SystemScheduler::ExecutionMode::Parallel);
+    }
+
+    SystemScheduler& scheduler = serverWorld.getSystemScheduler();
+    scheduler.setTimingEnabled(true);
+    serverWorld.setTickRate(options.tickRate);
+    serverWorld.startGame();
+
+    auto* heroSystem = static_cast<HeroSystem*>(serverWorld.getSystem("HeroSystem"));
+    HeroScript script(entityManager, *heroSystem);
+    script.spawn(options.heroesPerTeam, options.seed);
+
+    const f32 tickInterval = 1.0f / static_cast<f32>(options.tickRate);
+    const u64 tickCount = static_cast<u64>(options.minutes * 60.0f * static_cast<f32>(options.tickRate));
+
+    Vector<Vector<f64>> systemSamples;
+    Vector<f64> tickSamples;
+    tickSamples.reserve(tickCount);
+    EntityCounts peak;
+
+    Timer wallTimer;
+    for (u64 tick = 0; tick < tickCount; ++tick) {
+        script.update(tickInterval);
+
+        Timer tickTimer;
+        serverWorld.update(tickInterval);
+        tickSamples.push_back(tickTimer.elapsedMillis() * 1000.0);
+
+        const auto& timings = scheduler.getTimings();
+        systemSamples.resize(timings.size());
+        for (size_t i = 0; i < timings.size(); ++i) {
+            systemSamples[i].push_back(timings[i].microseconds);
+        }
+
+        // Counting walks a few views; once a second is enough to catch the peak
+        if (tick % options.tickRate == 0) {
+            EntityCounts counts = countEntities(entityManager);
+            peak.total = std::max(peak.total, counts.total);
+            peak.creeps = std::max(peak.creeps, counts.creeps);
+            peak.heroes = std::max(peak.heroes, counts.heroes);
+            peak.projectiles = std::max(peak.projectiles, counts.projectiles);
+            peak.towers = std::max(peak.towers, counts.towers);
+        }
+    }
+    const f64 wallSeconds = wallTimer.elapsed();
+
+    // Zone history of the last ticks (ring buffers keep the most recent events per thread)
+    if (!options.tracePath.empty()) {
+        Profiler::writeChromeTrace(options.tracePath);
+    }
+
+    json report;
+    report["map"] = options.mapPath;
+    report["minutes"] = options.minutes;
+    report["tick_rate"] = options.tickRate;
+    report["ticks"] = tickCount;
+    report["heroes_per_team"] = options.heroesPerTeam;
+    report["seed"] = options.seed;
+    report["mode"] = options.parallel ? "parallel" : "serial";
+    report["ai_budget_us"] = options.aiBudgetMicroseconds;
+    report["wall_seconds"] = wallSeconds;
+    report["tick"] = summarize(tickSamples);
+
+    json systems = json::object();
+    const auto& timings = scheduler.getTimings();
+    for (size_t i = 0; i < timings.size() && i < systemSamples.size(); ++i) {
+        systems[timings[i].name] = summarize(systemSamples[i]);
+    }
+    report["systems"] = systems;
+    report["entities"] = {
+        {"final", countsToJson(countEntities(entityManager))},
+        {"peak", countsToJson(peak)}
+    };
+
+    const String text = report.dump(2);
+    if (options.outPath.empty()) {
+        std::cout << text << std::endl;
+    } else {
+        std::ofstream out(options.outPath);
+        if (!out) {
+            LOG_ERROR("sim_bench: cannot write '{}'", options.outPath);
+            return 1;
+        }
+        out << text << std::endl;
+    }
+    return 0;
+}
@@ -842,6 +842,8 @@ void EditorUI::drawMainMenu(World& world) {
                     auto& c = world.getComponent<TransformComponent>(cmd.entity);
                     if (cmd.kind == WorldEditor::Properties::Kind::Float) *WorldEditor::Properties::ptrFloat(&c, cmd.offset) = cmd.before.f;
                     else *WorldEditor::Properties::ptrVec3(&c, cmd.offset) = cmd.before.v;
+                    world.getEntityManager().markStaticCollidersDirty();
+                    world.getEntityManager().markLanePathsDirty();
                 }
                 if (cmd.component == ComponentSlot::Material && world.hasComponent<MaterialComponent>(cmd.entity)) {
                     auto& c = world.getComponent<MaterialComponent>(cmd.entity);
@@ -863,6 +865,8 @@ void EditorUI::drawMainMenu(World& world) {
                     auto& c = world.getComponent<TransformComponent>(cmd.entity);
                     if (cmd.kind == WorldEditor::Properties::Kind::Float) *WorldEditor::Properties::ptrFloat(&c, cmd.offset) = cmd.after.f;
                     else *WorldEditor::Properties::ptrVec3(&c, cmd.offset) = cmd.after.v;
+                    world.getEntityManager().markStaticCollidersDirty();
+                    world.getEntityManager().markLanePathsDirty();
                 }
                 if (cmd.component == ComponentSlot::Material && world.hasComponent<MaterialComponent>(cmd.entity)) {
                     auto& c = world.getComponent<MaterialComponent>(cmd.entity);
@@ -1044,6 +1048,7 @@ void EditorUI::drawTerrainTools(World& world) {
             // Convert selected terrain to tile grid and rebuild mesh immediately.
             WorldEditor::TerrainTools::initTileTerrain(t, tileInitTilesX_, tileInitTilesZ_, tileInitTileSize_, tileInitHeightStep_);
             WorldEditor::TerrainTools::syncHeightmapFromLevels(t);
+            world.getEntityManager().markNavGridDirty();
 
             // Get or create mesh component (safe pattern)
             MeshComponent* meshPtr = nullptr;
@@ -1584,6 +1589,7 @@ void EditorUI::drawInspector(World& world) {
         int typeIdx = static_cast<int>(objComp.type);
         if (ImGui::Combo("Type", &typeIdx, typeNames, IM_ARRAYSIZE(typeNames))) {
             objComp.type = static_cast<ObjectType>(typeIdx);
+            world.getEntityManager().markLanePathsDirty();
             markDirty();
         }
         
@@ -1628,12 +1634,14 @@ void EditorUI::drawInspector(World& world) {
         
         if (objComp.type == ObjectType::Waypoint) {
             if (ImGui::DragInt("Waypoint Order", &objComp.waypointOrder, 1.0f, 0, 100)) {
+                world.getEntityManager().markLanePathsDirty();
                 markDirty();
             }
             const char* waypointLaneNames[] = { "All Lanes", "Top", "Middle", "Bottom" };
             int waypointLaneComboValue = objComp.waypointLane + 1;
             if (ImGui::Combo("Waypoint Lane", &waypointLaneComboValue, waypointLaneNames, IM_ARRAYSIZE(waypointLaneNames))) {
                 objComp.waypointLane = waypointLaneComboValue - 1;
+                world.getEntityManager().markLanePathsDirty();
                 markDirty();
             }
         }
@@ -2089,7 +2097,16 @@ void EditorUI::drawTransform(World& world, Entity e) {
     }
 
     auto& tr = world.getComponent<TransformComponent>(e);
-    drawComponentProperties(e, ComponentSlot::Transform, &tr);
+    if (drawComponentProperties(e, ComponentSlot::Transform, &tr)) {
+        // Moving a tree/building invalidates the static collision broadphase
+        if (world.hasComponent<CollisionComponent>(e)) {
+            world.getEntityManager().markStaticCollidersDirty();
+        }
+        // Moving a waypoint changes the shared creep lane paths
+        if (world.hasComponent<ObjectComponent>(e)) {
+            world.getEntityManager().markLanePathsDirty();
+        }
+    }
     DragEulerDegrees("Rotation (deg)", tr.rotation);
 }
 
@@ -2480,7 +2497,6 @@ void EditorUI::drawMOBAGamePanel(World& world) {
     auto& registry = world.getEntityManager().getRegistry();
     
     auto creepView = registry.view<CreepComponent>();
-    auto projectileView = registry.view<ProjectileComponent>();
     auto towerView = registry.view<ObjectComponent>();
     
     i32 creepCount = 0;
@@ -2496,11 +2512,7 @@ void EditorUI::drawMOBAGamePanel(World& world) {
         }
     }
     
-    i32 projectileCount = 0;
-    for (auto entity : projectileView) {
-        auto& proj = projectileView.get<ProjectileComponent>(entity);
-        if (proj.active) projectileCount++;
-    }
+    i32 projectileCount = static_cast<i32>(world.getEntityManager().getProjectiles().size());
     
     i32 towerCount = 0;
     i32 radiantTowers = 0;
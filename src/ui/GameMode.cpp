@@ -100,16 +100,7 @@ void GameMode::stopAndReset(World& world) {
     }
 
     // Remove all projectiles (runtime)
-    {
-        Vector<Entity> toRemove;
-        auto view = reg.view<ProjectileComponent>();
-        for (auto e : view) {
-            toRemove.push_back(e);
-        }
-        for (auto e : toRemove) {
-            em.destroyEntity(e);
-        }
-    }
+    em.getProjectiles().clear();
 
     // Reset tower runtime cooldown state
     {
@@ -0,0 +1,108 @@
+#include "AiLodScheduler.h"
+#include "EntityManager.h"
+#include "HeroSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace WorldEditor {
+
+namespace {
+
+// Dead agents are dropped from the table this often
+constexpr i64 kPruneInterval = 256;
+
+} // namespace
+
+void AiLodScheduler::beginTick(EntityManager& entityManager, f32 deltaTime) {
+    deltaTime_ = deltaTime > 0.0f ? deltaTime : deltaTime_;
+    tick_++;
+    thinks_ = 0;
+    deferred_ = 0;
+    tickStart_ = std::chrono::steady_clock::now();
+
+    heroPositions_.clear();
+    auto view = entityManager.getRegistry().view<HeroComponent, TransformComponent>();
+    for (auto entity : view) {
+        if (view.get<HeroComponent>(entity).state != HeroState::Dead) {
+            heroPositions_.push_back(view.get<TransformComponent>(entity).position);
+        }
+    }
+
+    if (tick_ % kPruneInterval == 0) {
+        prune(entityManager);
+    }
+}
+
+AiLod AiLodScheduler::classify(const Vec3& position, bool inCombat) const {
+    if (inCombat) {
+        return AiLod::High;
+    }
+
+    // A handful of heroes per match: a flat scan beats a grid query
+    f32 closestSq = std::numeric_limits<f32>::max();
+    for (const Vec3& hero : heroPositions_) {
+        const f32 dx = hero.x - position.x;
+        const f32 dz = hero.z - position.z;
+        closestSq = std::min(closestSq, dx * dx + dz * dz);
+    }
+
+    if (closestSq <= settings_.nearHeroRadius * settings_.nearHeroRadius) {
+        return AiLod::High;
+    }
+    if (closestSq <= settings_.farHeroRadius * settings_.farHeroRadius) {
+        return AiLod::Medium;
+    }
+    return AiLod::Low;
+}
+
+bool AiLodScheduler::shouldThink(Entity entity, AiLod lod) {
+    const u64 period = periodTicks(lod);
+
+    auto [it, inserted] = lastThink_.try_emplace(entity, 0);
+    if (inserted) {
+        // Round-robin bucket: first think lands 0..period-1 ticks from now
+        const i64 bucket = static_cast<i64>(nextBucket_++ % period);
+        it->second = tick_ + bucket - static_cast<i64>(period);
+    }
+
+    const u64 waited = static_cast<u64>(tick_ - it->second);
+    if (waited < period) {
+        return false;
+    }
+
+    // Over budget: wait for the next tick unless already a whole interval late
+    if (settings_.budgetMicroseconds > 0 && waited < period * 2) {
+        const auto elapsed = std::chrono::steady_clock::now() - tickStart_;
+        if (std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() >= settings_.budgetMicroseconds) {
+            deferred_++;
+            return false;
+        }
+    }
+
+    it->second = tick_;
+    thinks_++;
+    return true;
+}
+
+u64 AiLodScheduler::periodTicks(AiLod lod) const {
+    f32 interval = settings_.lowInterval;
+    switch (lod) {
+        case AiLod::High:   interval = settings_.highInterval; break;
+        case AiLod::Medium: interval = settings_.mediumInterval; break;
+        case AiLod::Low:    interval = settings_.lowInterval; break;
+    }
+    return static_cast<u64>(std::max(1L, std::lround(interval / deltaTime_)));
+}
+
+void AiLodScheduler::prune(EntityManager& entityManager) {
+    for (auto it = lastThink_.begin(); it != lastThink_.end();) {
+        if (entityManager.isValid(it->first)) {
+            ++it;
+        } else {
+            it = lastThink_.erase(it);
+        }
+    }
+}
+
+} // namespace WorldEditor
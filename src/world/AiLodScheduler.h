@@ -0,0 +1,69 @@
+#pragma once
+
+#include "core/Types.h"
+#include <chrono>
+#include <unordered_map>
+
+namespace WorldEditor {
+
+class EntityManager;
+
+// How often an agent runs its expensive AI (target acquisition, path decisions)
+enum class AiLod : u8 {
+    High,       // Fighting or close to a hero
+    Medium,     // Within sight of a hero
+    Low         // Nobody is watching
+};
+
+struct AiLodSettings {
+    f32 highInterval = 0.1f;        // Seconds between thinks per LOD
+    f32 mediumInterval = 0.3f;
+    f32 lowInterval = 1.0f;
+    f32 nearHeroRadius = 30.0f;     // Closer than this to any hero: High
+    f32 farHeroRadius = 80.0f;      // Further than this from every hero: Low
+    u32 budgetMicroseconds = 0;     // Per-tick think budget (0 = none, keeps ticks replay-deterministic)
+};
+
+// Time-sliced AI scheduling. Every agent thinks once per interval of its LOD, but new
+// agents are spread round-robin over the ticks of that interval, so a wave spawned on
+// one tick does not think on one tick forever after. With a budget, thinks that do not
+// fit are pushed to the next tick; an agent overdue by a whole interval runs anyway.
+//
+// Usage per tick: beginTick(), then for each agent
+//   if (lod.shouldThink(entity, lod.classify(position, inCombat))) { expensive work }
+class AiLodScheduler {
+public:
+    AiLodScheduler() = default;
+
+    void setSettings(const AiLodSettings& settings) { settings_ = settings; }
+    const AiLodSettings& getSettings() const { return settings_; }
+
+    // Snapshots hero positions and starts the budget clock
+    void beginTick(EntityManager& entityManager, f32 deltaTime);
+
+    AiLod classify(const Vec3& position, bool inCombat) const;
+    bool shouldThink(Entity entity, AiLod lod);
+
+    // Stats for the last tick
+    u32 getThinkCount() const { return thinks_; }
+    u32 getDeferredCount() const { return deferred_; }
+    size_t getTrackedCount() const { return lastThink_.size(); }
+
+private:
+    u64 periodTicks(AiLod lod) const;
+    void prune(EntityManager& entityManager);
+
+    AiLodSettings settings_;
+    f32 deltaTime_ = 1.0f / 30.0f;
+    i64 tick_ = 0;
+    u32 nextBucket_ = 0;
+
+    std::unordered_map<Entity, i64> lastThink_;   // Tick of the last think per agent
+    Vector<Vec3> heroPositions_;
+
+    std::chrono::steady_clock::time_point tickStart_;
+    u32 thinks_ = 0;
+    u32 deferred_ = 0;
+};
+
+} // namespace WorldEditor
@@ -6,14 +6,17 @@ namespace WorldEditor {
 AnimationSystem::AnimationSystem(EntityManager& entityManager)
     : entityManager_(entityManager) {}
 
+void AnimationSystem::declareAccess(SystemAccess& access) const {
+    access.read<TransformComponent>()
+          .write<AnimationComponent>();
+}
+
 void AnimationSystem::update(f32 deltaTime) {
-    auto& registry = entityManager_.getRegistry();
-    
-    auto view = registry.view<AnimationComponent, TransformComponent>();
-    for (auto entity : view) {
-        auto& anim = view.get<AnimationComponent>(entity);
-        updateAnimation(entity, anim, deltaTime);
-    }
+    // Each entity only touches its own AnimationComponent, so this loop may run on job threads
+    entityManager_.parallelForEach<AnimationComponent, TransformComponent>(
+        [this, deltaTime](Entity entity, AnimationComponent& anim, TransformComponent&) {
+            updateAnimation(entity, anim, deltaTime);
+        });
 }
 
 void AnimationSystem::updateAnimation(Entity entity, AnimationComponent& anim, f32 deltaTime) {
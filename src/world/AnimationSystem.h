@@ -50,6 +50,7 @@ public:
     
     void update(f32 deltaTime) override;
     String getName() const override { return "AnimationSystem"; }
+    void declareAccess(SystemAccess& access) const override;
     
     // Play animation
     void playAnimation(Entity entity, AnimationType type, bool loop = true);
@@ -137,33 +137,16 @@ Vec3 CollisionSystem::checkMovementCollision(Entity entity, const Vec3& desiredP
     }
     
     const auto& col = entityManager_.getComponent<CollisionComponent>(entity);
-    const auto& trans = entityManager_.getComponent<TransformComponent>(entity);
     
     // Use entity's collision radius if radius not specified
     f32 checkRadius = (radius > 0.0f) ? radius : getCollisionRadius(col);
     
-    // Check collisions with all other entities
     Vec3 adjustedPosition = desiredPosition;
     auto& reg = entityManager_.getRegistry();
-    auto collisionView = reg.view<CollisionComponent, TransformComponent>();
     
-    for (auto otherEntity : collisionView) {
-        if (otherEntity == entity) {
-            continue;
-        }
-        
-        const auto& otherCol = collisionView.get<CollisionComponent>(otherEntity);
-        const auto& otherTrans = collisionView.get<TransformComponent>(otherEntity);
-        
-        // Skip triggers and non-blocking objects
-        if (otherCol.isTrigger || !otherCol.blocksMovement) {
-            continue;
-        }
-        
-        // Skip static objects if this entity is also static
-        if (col.isStatic && otherCol.isStatic) {
-            continue;
-        }
+    auto pushAway = [&](Entity otherEntity) {
+        const auto& otherCol = reg.get<CollisionComponent>(otherEntity);
+        const auto& otherTrans = reg.get<TransformComponent>(otherEntity);
         
         Vec3 otherCenter = getCollisionCenter(otherCol, otherTrans);
         f32 otherRadius = getCollisionRadius(otherCol);
@@ -179,50 +162,73 @@ Vec3 CollisionSystem::checkMovementCollision(Entity entity, const Vec3& desiredP
                 adjustedPosition += direction * overlap;
             }
         }
+    };
+    
+    // Static blockers from the broadphase (skipped if this entity is also static)
+    if (!col.isStatic) {
+        getStaticColliders().forEachCandidate(desiredPosition, checkRadius, [&](Entity otherEntity) {
+            if (otherEntity != entity && reg.valid(otherEntity)) {
+                pushAway(otherEntity);
+            }
+            return false;
+        });
     }
     
+    // Dynamic blockers (units) from the per-tick spatial grid
+    SpatialFilter filter;
+    filter.typeMask = SpatialType::All;
+    filter.ignore = entity;
+    filter.useExtents = true;
+    
+    entityManager_.getSpatialGrid().forEachInRadius(desiredPosition, checkRadius, filter, [&](Entity otherEntity, f32) {
+        const auto* otherCol = reg.try_get<CollisionComponent>(otherEntity);
+        // Skip non-colliders, triggers, non-blocking and static objects (handled above)
+        if (!otherCol || otherCol->isTrigger || !otherCol->blocksMovement || otherCol->isStatic) {
+            return;
+        }
+        pushAway(otherEntity);
+    });
+    
     return adjustedPosition;
 }
 
 Vector<Entity> CollisionSystem::getCollidingEntities(const Vec3& position, f32 radius) const {
     Vector<Entity> result;
-    auto& reg = entityManager_.getRegistry();
-    auto collisionView = reg.view<CollisionComponent, TransformComponent>();
     
-    for (auto entity : collisionView) {
+    // Grid broadphase over every indexed collider, exact sphere test on candidates
+    SpatialFilter filter;
+    filter.typeMask = SpatialType::All;
+    filter.useExtents = true;
+    
+    entityManager_.getSpatialGrid().forEachInRadius(position, radius, filter, [&](Entity entity, f32) {
         if (checkSphereCollision(entity, position, radius)) {
             result.push_back(entity);
         }
-    }
+    });
     
     return result;
 }
 
 bool CollisionSystem::hasBlockingCollisionAt(const Vec3& position, f32 radius, Entity ignoreEntity) const {
-    auto& reg = entityManager_.getRegistry();
-    auto collisionView = reg.view<CollisionComponent, TransformComponent>();
-
-    for (auto entity : collisionView) {
-        if (entity == ignoreEntity) {
-            continue;
-        }
+    // IMPORTANT: for path checks we only consider static blockers.
+    // Dynamic units (creeps) should not make other units "path around" each other.
+    // The broadphase only holds static, blocking, non-trigger colliders.
+    return getStaticColliders().forEachCandidate(position, radius, [&](Entity entity) {
+        return entity != ignoreEntity && checkSphereCollision(entity, position, radius);
+    });
+}
 
-        const auto& col = collisionView.get<CollisionComponent>(entity);
-        if (col.isTrigger || !col.blocksMovement) {
-            continue;
-        }
-        // IMPORTANT: for path checks we only consider static blockers.
-        // Dynamic units (creeps) should not make other units "path around" each other.
-        if (!col.isStatic) {
-            continue;
-        }
+void CollisionSystem::rebuildStaticColliders() {
+    staticColliders_.build(entityManager_.getRegistry());
+    staticCollidersRevision_ = entityManager_.getStaticColliderRevision();
+}
 
-        if (checkSphereCollision(entity, position, radius)) {
-            return true;
-        }
+const StaticColliderGrid& CollisionSystem::getStaticColliders() const {
+    if (staticCollidersRevision_ != entityManager_.getStaticColliderRevision()) {
+        staticColliders_.build(entityManager_.getRegistry());
+        staticCollidersRevision_ = entityManager_.getStaticColliderRevision();
     }
-
-    return false;
+    return staticColliders_;
 }
 
 bool CollisionSystem::checkBoxBoxCollision(const CollisionComponent& col1, const TransformComponent& trans1,
@@ -262,19 +268,7 @@ Vec3 CollisionSystem::getCollisionCenter(const CollisionComponent& col, const Tr
 }
 
 f32 CollisionSystem::getCollisionRadius(const CollisionComponent& col) const {
-    switch (col.shape) {
-        case CollisionShape::Sphere:
-            return col.radius;
-        case CollisionShape::Capsule:
-            return col.capsuleRadius;
-        case CollisionShape::Box: {
-            // Use largest dimension as radius approximation
-            Vec3 halfSize = col.boxSize * 0.5f;
-            return std::max({halfSize.x, halfSize.y, halfSize.z});
-        }
-        default:
-            return 0.5f;
-    }
+    return col.getBoundingRadius();
 }
 
 } // namespace WorldEditor
@@ -3,6 +3,7 @@
 #include "core/Types.h"
 #include "System.h"
 #include "Components.h"
+#include "StaticColliderGrid.h"
 
 namespace WorldEditor {
 
@@ -17,6 +18,7 @@ public:
 
     void update(f32 deltaTime) override {}
     String getName() const override { return "CollisionSystem"; }
+    void declareAccess(SystemAccess& /*access*/) const override {} // Query-only, update() does nothing
 
     // Check if two entities collide
     bool checkCollision(Entity entity1, Entity entity2) const;
@@ -40,9 +42,19 @@ public:
     // Avoids allocations and returns early on first hit.
     bool hasBlockingCollisionAt(const Vec3& position, f32 radius, Entity ignoreEntity = INVALID_ENTITY) const;
 
+    // Rebuild the static-collider broadphase now (e.g. right after a map load).
+    // Otherwise it is rebuilt lazily on the first query after the static collider revision changes.
+    void rebuildStaticColliders();
+
 private:
     EntityManager& entityManager_;
     
+    // Static blockers broadphase. Lazily refreshed from const queries, so it is mutable;
+    // queries must run on the simulation thread.
+    mutable StaticColliderGrid staticColliders_;
+    mutable u64 staticCollidersRevision_ = ~0ull;
+    const StaticColliderGrid& getStaticColliders() const;
+    
     // Helper methods
     bool checkBoxBoxCollision(const CollisionComponent& col1, const TransformComponent& trans1,
                              const CollisionComponent& col2, const TransformComponent& trans2) const;
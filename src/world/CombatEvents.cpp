@@ -0,0 +1,228 @@
+#include "CombatEvents.h"
+#include "EntityManager.h"
+#include "HeroSystem.h"
+#include "core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WorldEditor {
+
+namespace {
+
+// Heroes have a flat 25% base magic resistance
+constexpr f32 kHeroMagicMultiplier = 0.75f;
+
+} // namespace
+
+void CombatEventBuffer::damage(Entity source, Entity target, f32 amount, DamageType type, u32 sortKey) {
+    record({EventType::Damage, type, sortKey, source, target, amount});
+}
+
+void CombatEventBuffer::heal(Entity source, Entity target, f32 amount, u32 sortKey) {
+    record({EventType::Heal, DamageType::Pure, sortKey, source, target, amount});
+}
+
+void CombatEventBuffer::record(const Event& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.push_back(event);
+}
+
+f32 CombatEventBuffer::armorMultiplier(f32 armor) {
+    return 1.0f - (0.06f * armor) / (1.0f + 0.06f * std::abs(armor));
+}
+
+size_t CombatEventBuffer::resolve(EntityManager& entityManager) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (events_.empty()) {
+            return 0;
+        }
+        resolving_.swap(events_);
+    }
+
+    PROFILE_SCOPE("CombatEventBuffer::resolve");
+    std::stable_sort(resolving_.begin(), resolving_.end(), [](const Event& a, const Event& b) {
+        return a.sortKey < b.sortKey;
+    });
+
+    size_t applied = 0;
+    for (const Event& event : resolving_) {
+        if (!entityManager.isValid(event.target)) {
+            continue;
+        }
+        const bool ok = event.type == EventType::Damage
+            ? applyDamage(entityManager, event)
+            : applyHeal(entityManager, event);
+        applied += ok ? 1 : 0;
+    }
+
+    resolving_.clear();
+    return applied;
+}
+
+bool CombatEventBuffer::applyDamage(EntityManager& entityManager, const Event& event) {
+    Registry& registry = entityManager.getRegistry();
+
+    KillEvent kill;
+    kill.killer = event.source;
+    kill.victim = event.target;
+    i32 victimLevel = 1;
+
+    if (auto* hero = registry.try_get<HeroComponent>(event.target)) {
+        if (hero->state == HeroState::Dead || hero->isInvulnerable()) {
+            return false;
+        }
+
+        f32 amount = event.amount;
+        if (event.damageType == DamageType::Physical) {
+            amount *= armorMultiplier(HeroSystem::calculateArmor(*hero));
+        } else if (event.damageType == DamageType::Magical) {
+            amount *= kHeroMagicMultiplier;
+        }
+
+        hero->currentHealth -= amount;
+        if (hero->currentHealth > 0.0f) {
+            return true;
+        }
+
+        hero->currentHealth = 0.0f;
+        hero->state = HeroState::Dead;
+        hero->deaths++;
+        hero->respawnTimer = HeroSystem::calculateRespawnTime(hero->level);
+
+        // Clear movement and targeting
+        hero->movePath.clear();
+        hero->targetEntity = INVALID_ENTITY;
+        hero->currentCastingAbility = -1;
+
+        // Hide mesh when dead
+        if (auto* mesh = registry.try_get<MeshComponent>(event.target)) {
+            mesh->visible = false;
+        }
+
+        kill.victimType = CombatTargetType::Hero;
+        victimLevel = hero->level;
+    } else if (auto* creep = registry.try_get<CreepComponent>(event.target)) {
+        if (creep->state == CreepState::Dead) {
+            return false;
+        }
+
+        f32 amount = event.amount;
+        if (event.damageType == DamageType::Physical) {
+            amount *= armorMultiplier(creep->armor);
+        }
+
+        creep->currentHealth -= amount;
+        if (creep->currentHealth > 0.0f) {
+            return true;
+        }
+
+        creep->currentHealth = 0.0f;
+        creep->state = CreepState::Dead;
+        creep->deathTime = 0.0f;
+
+        kill.victimType = CombatTargetType::Creep;
+    } else if (auto* health = registry.try_get<HealthComponent>(event.target)) {
+        if (health->isDead) {
+            return false;
+        }
+
+        f32 amount = event.amount;
+        if (event.damageType == DamageType::Physical) {
+            amount *= armorMultiplier(health->armor);
+        } else if (event.damageType == DamageType::Magical) {
+            amount *= 1.0f - health->magicResistance;
+        }
+
+        health->currentHealth -= amount;
+        if (health->currentHealth > 0.0f) {
+            return true;
+        }
+
+        health->currentHealth = 0.0f;
+        health->isDead = true;
+
+        kill.victimType = CombatTargetType::Building;
+    } else {
+        return false;
+    }
+
+    creditKill(entityManager, kill, victimLevel);
+    kills_.push_back(kill);
+    return true;
+}
+
+bool CombatEventBuffer::applyHeal(EntityManager& entityManager, const Event& event) {
+    Registry& registry = entityManager.getRegistry();
+
+    if (auto* hero = registry.try_get<HeroComponent>(event.target)) {
+        if (hero->state == HeroState::Dead) {
+            return false;
+        }
+        hero->currentHealth = std::min(hero->maxHealth, hero->currentHealth + event.amount);
+    } else if (auto* creep = registry.try_get<CreepComponent>(event.target)) {
+        if (creep->state == CreepState::Dead) {
+            return false;
+        }
+        creep->currentHealth = std::min(creep->maxHealth, creep->currentHealth + event.amount);
+    } else if (auto* health = registry.try_get<HealthComponent>(event.target)) {
+        if (health->isDead) {
+            return false;
+        }
+        health->currentHealth = std::min(health->maxHealth, health->currentHealth + event.amount);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void CombatEventBuffer::creditKill(EntityManager& entityManager, KillEvent& kill, i32 victimLevel) {
+    if (kill.killer == INVALID_ENTITY || !entityManager.isValid(kill.killer)) {
+        return;
+    }
+    auto* killer = entityManager.getRegistry().try_get<HeroComponent>(kill.killer);
+    if (!killer) {
+        return;
+    }
+    kill.killerIsHero = true;
+
+    switch (kill.victimType) {
+        case CombatTargetType::Hero:
+            killer->kills++;
+            kill.gold = 200 + victimLevel * 10;
+            kill.experience = 100.0f + static_cast<f32>(victimLevel) * 20.0f;
+            break;
+        case CombatTargetType::Creep:
+            killer->lastHits++;
+            kill.lastHit = true;
+            kill.gold = 40;
+            kill.experience = 40.0f;
+            break;
+        case CombatTargetType::Building:
+            break;
+    }
+
+    // Level-ups are applied by HeroSystem on its next update
+    killer->gold += kill.gold;
+    if (killer->level < kMaxHeroLevel) {
+        killer->experience += kill.experience;
+    }
+}
+
+void CombatEventBuffer::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+    kills_.clear();
+}
+
+bool CombatEventBuffer::empty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.empty();
+}
+
+size_t CombatEventBuffer::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+}
+
+} // namespace WorldEditor
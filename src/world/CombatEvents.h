@@ -0,0 +1,91 @@
+#pragma once
+
+#include "core/Types.h"
+#include <mutex>
+
+namespace WorldEditor {
+
+class EntityManager;
+
+// Heroes stop gaining levels here, whichever path pays the experience
+constexpr i32 kMaxHeroLevel = 30;
+
+enum class DamageType : u8 {
+    Physical,   // Reduced by armor
+    Magical,    // Reduced by magic resistance
+    Pure        // Applied as is (damage over time)
+};
+
+enum class CombatTargetType : u8 {
+    Hero,
+    Creep,
+    Building
+};
+
+// One kill produced by a resolve pass, with the rewards already paid to the killer
+struct KillEvent {
+    Entity killer = INVALID_ENTITY;     // Source of the killing blow, may be INVALID_ENTITY
+    Entity victim = INVALID_ENTITY;
+    CombatTargetType victimType = CombatTargetType::Creep;
+    bool killerIsHero = false;
+    bool lastHit = false;               // A hero killed a creep
+    i32 gold = 0;
+    f32 experience = 0.0f;
+};
+
+// Per-tick combat stage. Systems record damage and heals while iterating instead of
+// mutating health; the world resolves the whole batch at sync points (before deferred
+// entity commands are flushed) in one pass: invulnerability, armor / magic resistance,
+// deaths, and kill credit with gold and experience for heroes.
+//
+// Recording is thread-safe. Events are resolved in a stable order by sortKey, then in
+// recording order, which decides who lands the killing blow; producers running
+// concurrently must use distinct sort keys (same contract as EntityCommandBuffer).
+class CombatEventBuffer {
+public:
+    // source may be INVALID_ENTITY (no kill credit)
+    void damage(Entity source, Entity target, f32 amount, DamageType type, u32 sortKey = 0);
+    void heal(Entity source, Entity target, f32 amount, u32 sortKey = 0);
+
+    // Apply everything recorded so far. Events on dead or destroyed targets are dropped.
+    // Returns the number of events applied.
+    size_t resolve(EntityManager& entityManager);
+
+    // Kills resolved since the last clearKills(); the world clears them at tick start
+    const Vector<KillEvent>& getKills() const { return kills_; }
+    void clearKills() { kills_.clear(); }
+
+    void clear();
+    bool empty() const;
+    size_t size() const;
+
+    // Dota-style armor multiplier, 1 - 0.06a / (1 + 0.06|a|)
+    static f32 armorMultiplier(f32 armor);
+
+private:
+    enum class EventType : u8 {
+        Damage,
+        Heal
+    };
+
+    struct Event {
+        EventType type;
+        DamageType damageType;
+        u32 sortKey;
+        Entity source;
+        Entity target;
+        f32 amount;
+    };
+
+    void record(const Event& event);
+    bool applyDamage(EntityManager& entityManager, const Event& event);
+    bool applyHeal(EntityManager& entityManager, const Event& event);
+    void creditKill(EntityManager& entityManager, KillEvent& kill, i32 victimLevel);
+
+    mutable std::mutex mutex_;
+    Vector<Event> events_;
+    Vector<Event> resolving_;       // Reused between resolves
+    Vector<KillEvent> kills_;
+};
+
+} // namespace WorldEditor
@@ -145,6 +145,7 @@ struct ObjectComponent {
 // Runtime-only tower state (not serialized).
 struct TowerRuntimeComponent {
     f32 attackCooldown = 0.0f;
+    Entity lastTarget = INVALID_ENTITY;  // Target of the last shot, cleared when nothing is in range
 };
 
 // Navigation mesh component
@@ -234,6 +235,10 @@ enum class CreepState : u8 {
     Dead = 3
 };
 
+// Handle into the shared LanePathTable (EntityManager::getLanePaths)
+using LanePathId = u8;
+constexpr LanePathId INVALID_LANE_PATH = 0xFF;
+
 struct CreepComponent {
     // Basic stats
     f32 maxHealth = 550.0f;
@@ -255,8 +260,8 @@ struct CreepComponent {
     Entity targetEntity = INVALID_ENTITY; // Current attack target
     Vec3 targetPosition = Vec3(0.0f); // Movement target (current waypoint)
     Vec3 laneDirection = Vec3(1.0f, 0.0f, 1.0f); // Direction along lane (fallback)
+    LanePathId pathId = INVALID_LANE_PATH; // Shared lane path to follow
     i32 currentWaypointIndex = 0; // Current waypoint index in path
-    Vector<Vec3> path; // Path of waypoints to follow
     
     // Timing
     f32 attackCooldown = 0.0f;
@@ -264,11 +269,15 @@ struct CreepComponent {
     f32 deathTime = 0.0f; // Time when creep died (for cleanup delay)
     f32 deathDelay = 2.0f; // Time before removing dead creep (seconds)
 
-    // Perf: throttle expensive per-tick queries
-    f32 targetSearchCooldown = 0.0f; // Seconds until next full target scan
-    f32 pathCheckCooldown = 0.0f;    // Seconds until next path-clear check
-    bool lastPathClear = true;       // Cached result from last path check
-    f32 waypointStuckTime = 0.0f;    // Time stuck at current waypoint (to detect circling)
+    // Waypoint fallback (no flow field): time stuck at the current waypoint, to detect circling
+    f32 waypointStuckTime = 0.0f;
+
+    // Crowd separation: bounded neighbour list, refreshed by CrowdSteering
+    static constexpr i32 MAX_CROWD_NEIGHBORS = 8;
+    Entity crowdNeighbors[MAX_CROWD_NEIGHBORS] = {};
+    i32 crowdNeighborCount = 0;
+    f32 crowdRefreshCooldown = 0.0f; // Seconds until the neighbour list is rebuilt
+    bool crowdNeighborsBuilt = false;
     
     // Spawn info
     Entity spawnPoint = INVALID_ENTITY; // CreepSpawn entity that spawned this creep
@@ -278,26 +287,6 @@ struct CreepComponent {
     CreepComponent(i32 team, CreepLane laneType) : teamId(team), lane(laneType) {}
 };
 
-// Runtime-only projectile for ranged creep attacks (not serialized).
-struct ProjectileComponent {
-    Entity attacker = INVALID_ENTITY;
-    Entity target = INVALID_ENTITY;
-    i32 teamId = 0;
-    bool active = false;
-    bool isTower = false; // distinguish tower projectiles for pooling/material
-
-    // Movement
-    f32 speed = 80.0f;    // world units per second
-    f32 hitRadius = 1.0f; // how close is considered a hit
-
-    // Damage payload (applied on hit)
-    f32 baseDamage = 0.0f;
-
-    // Lifetime
-    f32 life = 0.0f;
-    f32 maxLife = 5.0f;
-};
-
 // Health component for towers, buildings, and other structures
 struct HealthComponent {
     f32 maxHealth = 1000.0f;
@@ -376,6 +365,23 @@ struct CollisionComponent {
         return aabb;
     }
     
+    // Radius of the sphere used for approximate overlap tests (center = position + offset)
+    f32 getBoundingRadius() const {
+        switch (shape) {
+            case CollisionShape::Sphere:
+                return radius;
+            case CollisionShape::Capsule:
+                return capsuleRadius;
+            case CollisionShape::Box: {
+                // Use largest dimension as radius approximation
+                Vec3 halfSize = boxSize * 0.5f;
+                return std::max({halfSize.x, halfSize.y, halfSize.z});
+            }
+            default:
+                return 0.5f;
+        }
+    }
+    
     // Helper to check if point is inside
     bool containsPoint(const Vec3& point, const Vec3& position) const {
         Vec3 localPoint = point - (position + offset);
@@ -428,19 +434,21 @@ struct MeshComponent {
     ComPtr<ID3D12Resource> indexBufferUpload;  // For initialization
     D3D12_VERTEX_BUFFER_VIEW vertexBufferView;
     D3D12_INDEX_BUFFER_VIEW indexBufferView;
-    bool gpuBuffersCreated = false;
-    // When CPU-side mesh data changes, mark this true so renderer can upload into existing buffers (or recreate if size differs).
-    bool gpuUploadNeeded = false;
 
     // Constant buffers for shader parameters
     ComPtr<ID3D12Resource> perObjectConstantBuffer;
     ComPtr<ID3D12Resource> perObjectConstantBufferUpload;
-    bool gpuConstantBuffersCreated = false;
 
     // Static renderer reference for safe resource cleanup
     static class DirectXRenderer* s_renderer;
 #endif
 
+    // Renderer bookkeeping; plain flags so simulation code can set them in headless builds
+    bool gpuBuffersCreated = false;
+    // When CPU-side mesh data changes, mark this true so renderer can upload into existing buffers (or recreate if size differs).
+    bool gpuUploadNeeded = false;
+    bool gpuConstantBuffersCreated = false;
+
     // Material reference
     Entity materialEntity = INVALID_ENTITY;
 
@@ -480,9 +488,9 @@ struct MaterialComponent {
     // DirectX resources (created by renderer)
     ComPtr<ID3D12Resource> constantBuffer;
     ComPtr<ID3D12Resource> constantBufferUpload;
-    bool gpuBufferCreated = false;
     // Texture resources would go here
 #endif
+    bool gpuBufferCreated = false;
 
     String name;
 
@@ -9,6 +9,12 @@ CreepSpawnSystem::CreepSpawnSystem(EntityManager& entityManager)
     generateWaves();
 }
 
+void CreepSpawnSystem::declareAccess(SystemAccess& access) const {
+    access.changesStructure()
+          .read<ObjectComponent, TransformComponent>()
+          .before("CreepSystem");
+}
+
 void CreepSpawnSystem::update(f32 deltaTime) {
     if (!gameActive_) {
         return;
@@ -27,6 +33,13 @@ void CreepSpawnSystem::startGame() {
     for (auto& wave : waves_) {
         wave.spawned = false;
     }
+    
+    // Grow creep and projectile storages once instead of during the first waves
+    if (auto* world = entityManager_.getWorld()) {
+        if (auto* creepSystem = static_cast<CreepSystem*>(world->getSystem("CreepSystem"))) {
+            creepSystem->prewarm(kPrewarmCreeps, kPrewarmProjectiles);
+        }
+    }
 }
 
 void CreepSpawnSystem::pauseGame() {
@@ -135,23 +148,15 @@ void CreepSpawnSystem::spawnCreepsForLane(CreepLane lane, i32 meleeCount, i32 ra
             continue;
         }
         
-        // Spawn melee creeps
-        for (i32 i = 0; i < meleeCount; ++i) {
-            CreepType type = isMegaWave(currentWaveIndex_) ? CreepType::MegaMelee : CreepType::Melee;
-            creepSystem->spawnCreep(spawnPoint, type, teamId, lane);
-        }
-        
-        // Spawn ranged creeps
-        for (i32 i = 0; i < rangedCount; ++i) {
-            CreepType type = isMegaWave(currentWaveIndex_) ? CreepType::MegaRanged : CreepType::Ranged;
-            creepSystem->spawnCreep(spawnPoint, type, teamId, lane);
-        }
-        
-        // Spawn siege creeps
-        for (i32 i = 0; i < siegeCount; ++i) {
-            CreepType type = isMegaWave(currentWaveIndex_) ? CreepType::MegaSiege : CreepType::Siege;
-            creepSystem->spawnCreep(spawnPoint, type, teamId, lane);
-        }
+        // One batch per creep type; formation slots run on across the whole wave
+        const bool mega = isMegaWave(currentWaveIndex_);
+        i32 formationIndex = 0;
+        formationIndex += creepSystem->spawnCreeps(spawnPoint, mega ? CreepType::MegaMelee : CreepType::Melee,
+                                                   teamId, lane, meleeCount, formationIndex);
+        formationIndex += creepSystem->spawnCreeps(spawnPoint, mega ? CreepType::MegaRanged : CreepType::Ranged,
+                                                   teamId, lane, rangedCount, formationIndex);
+        creepSystem->spawnCreeps(spawnPoint, mega ? CreepType::MegaSiege : CreepType::Siege,
+                                 teamId, lane, siegeCount, formationIndex);
     }
 }
 
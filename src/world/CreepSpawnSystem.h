@@ -14,6 +14,7 @@ public:
 
     void update(f32 deltaTime) override;
     String getName() const override { return "CreepSpawnSystem"; }
+    void declareAccess(SystemAccess& access) const override;
 
     // Spawn wave configuration
     struct CreepWave {
@@ -52,6 +53,10 @@ private:
     static constexpr f32 FIRST_WAVE_DELAY = 0.0f;   // First wave spawns immediately
     static constexpr f32 CREEP_SPAWN_DELAY = 0.5f;  // Delay between individual creeps in wave
     
+    // Storage reserved at game start (a few waves on all lanes)
+    static constexpr size_t kPrewarmCreeps = 128;
+    static constexpr size_t kPrewarmProjectiles = 64;
+    
     // Spawn management
     void updateWaveSpawning(f32 deltaTime);
     void spawnWave(const CreepWave& wave);
@@ -8,11 +8,32 @@
 namespace WorldEditor {
 
 CreepSystem::CreepSystem(EntityManager& entityManager) 
-    : entityManager_(entityManager) {
+    : entityManager_(entityManager)
+    , crowd_(entityManager) {
+    // Lane creeps far from every hero only need to notice enemies about once a second
+    AiLodSettings lod;
+    lod.highInterval = 0.1f;
+    lod.mediumInterval = 0.5f;
+    lod.lowInterval = 1.0f;
+    aiLod_.setSettings(lod);
+    
+    for (auto& teams : creepPrefabs_) {
+        teams[0] = teams[1] = INVALID_PREFAB;
+    }
+}
+
+void CreepSystem::declareAccess(SystemAccess& access) const {
+    // Fires projectiles and destroys dead creeps; may rebuild the nav grid and flow fields
+    access.changesStructure()
+          .read<ObjectComponent, HealthComponent, HeroComponent, TerrainComponent, CollisionComponent>()
+          .write<CreepComponent, TransformComponent>()
+          .after("CreepSpawnSystem");
 }
 
 void CreepSystem::update(f32 deltaTime) {
     auto& registry = entityManager_.getRegistry();
+    aiLod_.beginTick(entityManager_, deltaTime);
+    flowFields_ = &entityManager_.getLaneFlowFields();
     
     // Update all creeps
     auto view = registry.view<CreepComponent, TransformComponent>();
@@ -25,15 +46,11 @@ void CreepSystem::update(f32 deltaTime) {
     
     // Cleanup dead creeps
     cleanupDeadCreeps(deltaTime);
-    
-    lastFullUpdate_ += deltaTime;
 }
 
 void CreepSystem::updateCreepAI(Entity entity, CreepComponent& creep, TransformComponent& transform, f32 deltaTime) {
     // Update cooldowns
     creep.attackCooldown = std::max(0.0f, creep.attackCooldown - deltaTime);
-    creep.targetSearchCooldown = std::max(0.0f, creep.targetSearchCooldown - deltaTime);
-    creep.pathCheckCooldown = std::max(0.0f, creep.pathCheckCooldown - deltaTime);
     
     // Skip if dead
     if (creep.state == CreepState::Dead) {
@@ -70,14 +87,13 @@ void CreepSystem::updateCreepAI(Entity entity, CreepComponent& creep, TransformC
         case CreepState::Moving:
             updateCreepMovement(entity, creep, transform, deltaTime);
             
-            // Look for enemies to attack (throttled)
-            if (creep.targetSearchCooldown <= 0.0f) {
+            // Look for enemies to attack (time-sliced by LOD; just-fought creeps re-acquire fast)
+            if (aiLod_.shouldThink(entity, aiLod_.classify(transform.position, creep.attackCooldown > 0.0f))) {
                 Entity enemy = findNearestEnemy(entity, creep, transform.position);
                 if (enemy != INVALID_ENTITY) {
                     creep.targetEntity = enemy;
                     creep.state = CreepState::Attacking;
                 }
-                creep.targetSearchCooldown = 0.5f; // Search every 0.5 seconds
             }
             break;
             
@@ -87,7 +103,7 @@ void CreepSystem::updateCreepAI(Entity entity, CreepComponent& creep, TransformC
             
         case CreepState::Idle:
             // Look for enemies or resume movement
-            if (creep.targetSearchCooldown <= 0.0f) {
+            if (aiLod_.shouldThink(entity, aiLod_.classify(transform.position, creep.attackCooldown > 0.0f))) {
                 Entity enemy = findNearestEnemy(entity, creep, transform.position);
                 if (enemy != INVALID_ENTITY) {
                     creep.targetEntity = enemy;
@@ -95,7 +111,6 @@ void CreepSystem::updateCreepAI(Entity entity, CreepComponent& creep, TransformC
                 } else {
                     creep.state = CreepState::Moving;
                 }
-                creep.targetSearchCooldown = 0.5f;
             }
             break;
             
@@ -106,8 +121,27 @@ void CreepSystem::updateCreepAI(Entity entity, CreepComponent& creep, TransformC
 }
 
 void CreepSystem::updateCreepMovement(Entity entity, CreepComponent& creep, TransformComponent& transform, f32 deltaTime) {
+    // Lane flow field: one lookup, spacing comes from separation alone
+    Vec3 flow;
+    if (flowFields_ && flowFields_->sample(creep.pathId, transform.position, flow)) {
+        Vec3 separation = crowd_.computeSeparation(entity, creep, transform.position, deltaTime);
+        Vec3 moveDir = flow + separation * 0.5f;
+        if (glm::length(moveDir) > 0.001f) {
+            transform.position += glm::normalize(moveDir) * creep.moveSpeed * deltaTime;
+        }
+        
+        f32 yaw = std::atan2(flow.x, flow.z);
+        transform.rotation = glm::angleAxis(yaw, Vec3(0, 1, 0));
+        
+        // Keep the waypoint index in step, so the fallback below picks up where the field left off
+        advancePassedWaypoints(creep, entityManager_.getLanePaths().getPath(creep.pathId), transform.position);
+        return;
+    }
+    
+    // No field here (no terrain, blocked tile, at the objective): follow the waypoints
     // Get next waypoint position
-    Vec3 targetPos = getNextWaypointPosition(creep, transform.position);
+    const Vector<Vec3>& path = entityManager_.getLanePaths().getPath(creep.pathId);
+    Vec3 targetPos = getNextWaypointPosition(creep, path, transform.position);
     
     // Check distance to actual waypoint (not formation target)
     Vec3 toWaypoint = targetPos - transform.position;
@@ -117,13 +151,13 @@ void CreepSystem::updateCreepMovement(Entity entity, CreepComponent& creep, Tran
     const f32 waypointReachDistance = 3.0f; // Increased threshold to prevent circling
     if (distanceToWaypoint < waypointReachDistance) {
         // Reached waypoint, advance to next
-        if (creep.currentWaypointIndex < static_cast<i32>(creep.path.size()) - 1) {
+        if (creep.currentWaypointIndex < static_cast<i32>(path.size()) - 1) {
             creep.currentWaypointIndex++;
             // Reset stuck timer when advancing
             creep.waypointStuckTime = 0.0f;
         }
         // If at last waypoint, continue moving towards it
-        targetPos = getNextWaypointPosition(creep, transform.position);
+        targetPos = getNextWaypointPosition(creep, path, transform.position);
         toWaypoint = targetPos - transform.position;
         distanceToWaypoint = glm::length(toWaypoint);
     }
@@ -134,10 +168,10 @@ void CreepSystem::updateCreepMovement(Entity entity, CreepComponent& creep, Tran
         creep.waypointStuckTime += deltaTime;
         if (creep.waypointStuckTime > stuckThreshold) {
             // Force advance to next waypoint if stuck too long
-            if (creep.currentWaypointIndex < static_cast<i32>(creep.path.size()) - 1) {
+            if (creep.currentWaypointIndex < static_cast<i32>(path.size()) - 1) {
                 creep.currentWaypointIndex++;
                 creep.waypointStuckTime = 0.0f;
-                targetPos = getNextWaypointPosition(creep, transform.position);
+                targetPos = getNextWaypointPosition(creep, path, transform.position);
                 toWaypoint = targetPos - transform.position;
                 distanceToWaypoint = glm::length(toWaypoint);
             }
@@ -169,35 +203,8 @@ void CreepSystem::updateCreepMovement(Entity entity, CreepComponent& creep, Tran
     // Apply formation offset to target
     Vec3 formationTarget = targetPos + perpDir * lateralOffset * formationScale;
     
-    // Separation from nearby creeps (avoid clumping)
-    Vec3 separation(0.0f);
-    i32 nearbyCount = 0;
-    const f32 separationRadius = 3.0f;
-    const f32 separationStrength = 2.0f;
-    
-    auto& registry = entityManager_.getRegistry();
-    auto view = registry.view<CreepComponent, TransformComponent>();
-    for (auto other : view) {
-        if (other == entity) continue;
-        
-        auto& otherCreep = view.get<CreepComponent>(other);
-        auto& otherTransform = view.get<TransformComponent>(other);
-        
-        if (otherCreep.state == CreepState::Dead) continue;
-        
-        Vec3 diff = transform.position - otherTransform.position;
-        f32 dist = glm::length(diff);
-        
-        if (dist > 0.1f && dist < separationRadius) {
-            // Push away from nearby creeps
-            separation += glm::normalize(diff) * (1.0f - dist / separationRadius);
-            nearbyCount++;
-        }
-    }
-    
-    if (nearbyCount > 0) {
-        separation = separation / static_cast<f32>(nearbyCount) * separationStrength;
-    }
+    // Separation from nearby creeps (avoid clumping), bounded neighbour list
+    Vec3 separation = crowd_.computeSeparation(entity, creep, transform.position, deltaTime);
     
     // Move towards target with separation
     Vec3 direction = formationTarget - transform.position;
@@ -250,34 +257,17 @@ void CreepSystem::updateCreepCombat(Entity entity, CreepComponent& creep, Transf
         if (creep.attackCooldown <= 0.0f) {
             // For ranged creeps, create projectile
             if (creep.type == CreepType::Ranged || creep.type == CreepType::LargeRanged || creep.type == CreepType::MegaRanged) {
-                // Create projectile entity
-                Entity projectile = entityManager_.createEntity("Projectile");
-                auto& projComp = entityManager_.addComponent<ProjectileComponent>(projectile);
-                auto& projTransform = entityManager_.addComponent<TransformComponent>(projectile);
-                
-                projComp.attacker = entity;
-                projComp.target = creep.targetEntity;
-                projComp.teamId = creep.teamId;
-                projComp.baseDamage = creep.damage;
-                projComp.active = true;
-                projComp.isTower = false;
-                
-                projTransform.position = transform.position + Vec3(0, 1, 0); // Slightly above creep
-                
-                // Add simple mesh for projectile visualization
-                auto& mesh = entityManager_.addComponent<MeshComponent>(projectile, "Projectile");
-                MeshGenerators::GenerateSphere(mesh, 0.1f, 8);
-                mesh.gpuUploadNeeded = true;
-                
-                // Add material
-                Entity materialEntity = entityManager_.createEntity("ProjectileMaterial");
-                auto& material = entityManager_.addComponent<MaterialComponent>(materialEntity, "ProjectileMaterial");
-                material.baseColor = Vec3(1.0f, 0.8f, 0.2f); // Yellow projectile
-                material.emissiveColor = Vec3(0.2f, 0.1f, 0.0f);
-                mesh.materialEntity = materialEntity;
+                ProjectileSpawn spawn;
+                spawn.attacker = entity;
+                spawn.target = creep.targetEntity;
+                spawn.teamId = creep.teamId;
+                spawn.damage = creep.damage;
+                spawn.position = transform.position + Vec3(0, 1, 0); // Slightly above creep
+                spawn.visual = getProjectilePrefab();
+                entityManager_.getProjectiles().spawn(spawn);
             } else {
-                // Melee attack - deal damage directly
-                dealDamage(entity, creep.targetEntity, creep.damage);
+                // Melee attack - damage lands at the next sync point
+                entityManager_.getCombatEvents().damage(entity, creep.targetEntity, creep.damage, DamageType::Physical);
             }
             
             creep.attackCooldown = 1.0f / creep.attackSpeed;
@@ -355,197 +345,201 @@ Entity CreepSystem::findNearestEnemy(Entity creepEntity, const CreepComponent& c
 }
 
 Entity CreepSystem::findNearestEnemyCreep(const Vec3& position, i32 teamId, f32 searchRadius) {
+    const auto& grid = entityManager_.getSpatialGrid();
     auto& registry = entityManager_.getRegistry();
-    auto view = registry.view<CreepComponent, TransformComponent>();
     
-    Entity nearest = INVALID_ENTITY;
-    f32 nearestDistance = searchRadius;
-    
-    for (auto entity : view) {
-        auto& creep = view.get<CreepComponent>(entity);
-        auto& transform = view.get<TransformComponent>(entity);
-        
-        // Skip same team or dead creeps
-        if (creep.teamId == teamId || creep.state == CreepState::Dead) {
-            continue;
-        }
-        
-        f32 distance = glm::length(transform.position - position);
-        if (distance < nearestDistance) {
-            nearest = entity;
-            nearestDistance = distance;
-        }
-    }
+    const auto& visibility = entityManager_.getVisibility();
     
-    return nearest;
+    return grid.findNearest(position, searchRadius, SpatialFilter::enemiesOf(teamId, SpatialType::Creep),
+        [&](Entity entity) {
+            // Skip dead creeps and creeps in the fog
+            return registry.get<CreepComponent>(entity).state != CreepState::Dead &&
+                   visibility.isVisibleTo(teamId, entity);
+        });
 }
 
 Entity CreepSystem::findNearestEnemyTower(const Vec3& position, i32 teamId, f32 searchRadius) {
+    const auto& grid = entityManager_.getSpatialGrid();
     auto& registry = entityManager_.getRegistry();
-    auto view = registry.view<ObjectComponent, TransformComponent>();
     
-    Entity nearest = INVALID_ENTITY;
-    f32 nearestDistance = searchRadius;
-    
-    for (auto entity : view) {
-        auto& obj = view.get<ObjectComponent>(entity);
-        auto& transform = view.get<TransformComponent>(entity);
-        
-        // Skip non-towers or same team
-        if (obj.type != ObjectType::Tower || obj.teamId == teamId || obj.teamId == 0) {
-            continue;
-        }
-        
-        // Check if tower is alive
-        if (entityManager_.hasComponent<HealthComponent>(entity)) {
-            auto& health = entityManager_.getComponent<HealthComponent>(entity);
-            if (health.isDead) {
-                continue;
+    return grid.findNearest(position, searchRadius, SpatialFilter::enemiesOf(teamId, SpatialType::Tower),
+        [&](Entity entity) {
+            // Skip neutral towers
+            if (registry.get<ObjectComponent>(entity).teamId == 0) {
+                return false;
             }
-        }
-        
-        f32 distance = glm::length(transform.position - position);
-        if (distance < nearestDistance) {
-            nearest = entity;
-            nearestDistance = distance;
-        }
-    }
-    
-    return nearest;
+            // Check if tower is alive
+            const auto* health = registry.try_get<HealthComponent>(entity);
+            return !health || !health->isDead;
+        });
 }
 
 Entity CreepSystem::findNearestEnemyHero(const Vec3& position, i32 teamId, f32 searchRadius) {
+    const auto& grid = entityManager_.getSpatialGrid();
     auto& registry = entityManager_.getRegistry();
-    auto view = registry.view<HeroComponent, TransformComponent>();
     
-    Entity nearest = INVALID_ENTITY;
-    f32 nearestDistance = searchRadius;
+    const auto& visibility = entityManager_.getVisibility();
     
-    for (auto entity : view) {
-        auto& hero = view.get<HeroComponent>(entity);
-        auto& transform = view.get<TransformComponent>(entity);
-        
-        // Skip same team or dead heroes
-        if (hero.teamId == teamId || hero.state == HeroState::Dead) {
-            continue;
-        }
-        
-        // Skip invisible heroes
-        if (hero.isInvisible()) {
-            continue;
-        }
-        
-        f32 distance = glm::length(transform.position - position);
-        if (distance < nearestDistance) {
-            nearest = entity;
-            nearestDistance = distance;
-        }
-    }
-    
-    return nearest;
+    return grid.findNearest(position, searchRadius, SpatialFilter::enemiesOf(teamId, SpatialType::Hero),
+        [&](Entity entity) {
+            // Skip dead and invisible heroes, and heroes in the fog
+            const auto& hero = registry.get<HeroComponent>(entity);
+            return hero.state != HeroState::Dead && !hero.isInvisible() && visibility.isVisibleTo(teamId, entity);
+        });
 }
 
-Vec3 CreepSystem::getNextWaypointPosition(const CreepComponent& creep, const Vec3& currentPos) const {
-    if (creep.path.empty()) {
+Vec3 CreepSystem::getNextWaypointPosition(const CreepComponent& creep, const Vector<Vec3>& path, const Vec3& currentPos) const {
+    if (path.empty()) {
         // Fallback: move along lane direction
         return currentPos + creep.laneDirection * 10.0f;
     }
     
-    if (creep.currentWaypointIndex >= static_cast<i32>(creep.path.size())) {
-        // Reached end of path
-        return creep.path.back();
+    if (creep.currentWaypointIndex >= static_cast<i32>(path.size())) {
+        // Reached end of path (or the path got shorter after a waypoint edit)
+        return path.back();
     }
     
-    return creep.path[creep.currentWaypointIndex];
+    return path[creep.currentWaypointIndex];
 }
 
-void CreepSystem::dealDamage(Entity attacker, Entity target, f32 damage) {
-    // Deal damage to creep
-    if (entityManager_.hasComponent<CreepComponent>(target)) {
-        auto& targetCreep = entityManager_.getComponent<CreepComponent>(target);
-        targetCreep.currentHealth -= damage;
-        
-        if (targetCreep.currentHealth <= 0.0f) {
-            targetCreep.currentHealth = 0.0f;
-            targetCreep.state = CreepState::Dead;
-            targetCreep.deathTime = 0.0f;
-        }
-    }
-    
-    // Deal damage to hero
-    if (entityManager_.hasComponent<HeroComponent>(target)) {
-        auto& targetHero = entityManager_.getComponent<HeroComponent>(target);
-        
-        // Check invulnerability
-        if (targetHero.isInvulnerable()) {
-            return;
-        }
-        
-        // Apply armor reduction (physical damage)
-        f32 armor = targetHero.armor;
-        f32 armorReduction = 1.0f - (0.06f * armor) / (1.0f + 0.06f * std::abs(armor));
-        f32 actualDamage = damage * armorReduction;
-        
-        targetHero.currentHealth -= actualDamage;
-        
-        if (targetHero.currentHealth <= 0.0f) {
-            targetHero.currentHealth = 0.0f;
-            targetHero.state = HeroState::Dead;
-            targetHero.deaths++;
-            // Calculate respawn time based on level
-            targetHero.respawnTimer = static_cast<f32>(targetHero.level) * 2.5f;
-        }
-    }
-    
-    // Deal damage to tower/building
-    if (entityManager_.hasComponent<HealthComponent>(target)) {
-        auto& health = entityManager_.getComponent<HealthComponent>(target);
-        f32 actualDamage = damage; // TODO: Apply armor reduction
-        health.currentHealth -= actualDamage;
-        
-        if (health.currentHealth <= 0.0f) {
-            health.currentHealth = 0.0f;
-            health.isDead = true;
+void CreepSystem::advancePassedWaypoints(CreepComponent& creep, const Vector<Vec3>& path, const Vec3& currentPos) const {
+    // A waypoint counts as passed once the creep is within reach of it or past it along
+    // the next leg of the lane (ground plane only)
+    const f32 waypointReachDistance = 3.0f;
+    while (creep.currentWaypointIndex < static_cast<i32>(path.size()) - 1) {
+        const Vec3& current = path[creep.currentWaypointIndex];
+        const Vec3& next = path[creep.currentWaypointIndex + 1];
+        const Vec3 fromWaypoint(currentPos.x - current.x, 0.0f, currentPos.z - current.z);
+        const Vec3 nextLeg(next.x - current.x, 0.0f, next.z - current.z);
+        if (glm::length(fromWaypoint) >= waypointReachDistance && glm::dot(fromWaypoint, nextLeg) <= 0.0f) {
+            break;
         }
+        creep.currentWaypointIndex++;
+        creep.waypointStuckTime = 0.0f;
     }
 }
 
 void CreepSystem::cleanupDeadCreeps(f32 deltaTime) {
     auto& registry = entityManager_.getRegistry();
     auto view = registry.view<CreepComponent>();
-    
-    Vector<Entity> toDestroy;
+    auto& commands = entityManager_.getCommandBuffer();
     
     for (auto entity : view) {
         auto& creep = view.get<CreepComponent>(entity);
         
         if (creep.state == CreepState::Dead && creep.deathTime >= creep.deathDelay) {
-            toDestroy.push_back(entity);
+            commands.destroy(entity);
         }
     }
-    
-    for (Entity entity : toDestroy) {
-        entityManager_.destroyEntity(entity);
-    }
 }
 
 Entity CreepSystem::spawnCreep(Entity spawnPoint, CreepType type, i32 teamId, CreepLane lane) {
-    if (!entityManager_.isValid(spawnPoint)) {
+    if (spawnCreeps(spawnPoint, type, teamId, lane, 1) == 0) {
         return INVALID_ENTITY;
     }
+    return spawnScratch_[0];
+}
+
+i32 CreepSystem::spawnCreeps(Entity spawnPoint, CreepType type, i32 teamId, CreepLane lane,
+                             i32 count, i32 firstFormationIndex) {
+    if (count <= 0 || !entityManager_.isValid(spawnPoint)) {
+        return 0;
+    }
     
     if (!entityManager_.hasComponent<TransformComponent>(spawnPoint)) {
-        return INVALID_ENTITY;
+        return 0;
     }
     
-    auto& spawnTransform = entityManager_.getComponent<TransformComponent>(spawnPoint);
+    const Vec3 spawnPosition = entityManager_.getComponent<TransformComponent>(spawnPoint).position;
+    auto& registry = entityManager_.getRegistry();
     
-    // Create creep entity
-    Entity creep = entityManager_.createEntity("Creep");
-    auto& creepComp = entityManager_.addComponent<CreepComponent>(creep, teamId, lane);
-    auto& transform = entityManager_.addComponent<TransformComponent>(creep);
+    // Count existing creeps of same team/lane near the spawn point to continue their formation
+    i32 creepIndex = firstFormationIndex;
+    if (creepIndex < 0) {
+        creepIndex = 0;
+        auto view = registry.view<CreepComponent, TransformComponent>();
+        for (auto entity : view) {
+            auto& c = view.get<CreepComponent>(entity);
+            auto& t = view.get<TransformComponent>(entity);
+            if (c.teamId == teamId && c.lane == lane && c.state != CreepState::Dead) {
+                f32 dist = glm::length(t.position - spawnPosition);
+                if (dist < 15.0f) {
+                    creepIndex++;
+                }
+            }
+        }
+    }
+    
+    // Whole group in one go: entities first, then one storage insert per component
+    spawnScratch_.resize(static_cast<size_t>(count));
+    if (!entityManager_.getPrefabs().instantiate(getCreepPrefab(type, teamId), spawnScratch_.data(), spawnScratch_.size())) {
+        return 0;
+    }
+    
+    const LanePathId pathId = LanePathTable::idFor(lane, teamId);
+    for (Entity creep : spawnScratch_) {
+        auto& creepComp = registry.get<CreepComponent>(creep);
+        auto& transform = registry.get<TransformComponent>(creep);
+        creepComp.lane = lane;
+        creepComp.spawnPoint = spawnPoint;
+        
+        // Calculate formation offset (line formation perpendicular to lane direction)
+        Vec3 laneDir = creepComp.laneDirection;
+        if (glm::length(laneDir) < 0.1f) {
+            laneDir = Vec3(1, 0, 0); // Default direction
+        }
+        Vec3 perpDir = glm::normalize(Vec3(-laneDir.z, 0, laneDir.x)); // Perpendicular to lane
+        
+        // Formation: spread creeps in a line with some depth (scaled for 16000 map)
+        f32 spacing = 80.0f;  // Space between creeps (~80 units)
+        i32 row = creepIndex / 3;  // 3 creeps per row
+        i32 col = creepIndex % 3;
+        
+        // Offset from center (-1, 0, 1 for columns)
+        f32 lateralOffset = (col - 1) * spacing;
+        f32 depthOffset = row * spacing * 1.5f;  // Rows behind each other
+        
+        // Add small random variation to avoid perfect grid
+        f32 randX = ((rand() % 100) / 100.0f - 0.5f) * 20.0f;
+        f32 randZ = ((rand() % 100) / 100.0f - 0.5f) * 20.0f;
+        
+        Vec3 formationOffset = perpDir * lateralOffset - laneDir * depthOffset + Vec3(randX, 0, randZ);
+        
+        // Set spawn position with formation offset
+        transform.position = spawnPosition + formationOffset;
+        
+        // Follow the shared lane path
+        creepComp.pathId = pathId;
+        creepComp.currentWaypointIndex = 0;
+        
+        // Store formation index for maintaining formation during movement
+        creepComp.formationIndex = creepIndex++;
+    }
+    
+    return count;
+}
+
+void CreepSystem::prewarm(size_t creepCount, size_t projectileCount) {
+    auto& prefabs = entityManager_.getPrefabs();
+    // Storages are shared between creep types, so one reservation covers all of them
+    prefabs.reserve(getCreepPrefab(CreepType::Melee, 1), creepCount);
+    entityManager_.getProjectiles().reserve(projectileCount);
+}
+
+PrefabId CreepSystem::getCreepPrefab(CreepType type, i32 teamId) {
+    const size_t typeIndex = static_cast<size_t>(type);
+    const size_t teamIndex = teamId == 1 ? 0 : 1;
+    if (typeIndex >= kCreepTypeCount) {
+        return INVALID_PREFAB;
+    }
+    
+    PrefabId& id = creepPrefabs_[typeIndex][teamIndex];
+    if (id != INVALID_PREFAB) {
+        return id;
+    }
     
     // Set creep type and stats (scaled for 16000x16000 map)
+    CreepComponent creepComp(teamId, CreepLane::Middle);
     creepComp.type = type;
     switch (type) {
         case CreepType::Melee:
@@ -569,63 +563,11 @@ Entity CreepSystem::spawnCreep(Entity spawnPoint, CreepType type, i32 teamId, Cr
         default:
             break;
     }
-    
     creepComp.currentHealth = creepComp.maxHealth;
-    creepComp.spawnPoint = spawnPoint;
-    
-    // Count existing creeps of same team/lane to determine formation position
-    i32 creepIndex = 0;
-    {
-        auto& registry = entityManager_.getRegistry();
-        auto view = registry.view<CreepComponent, TransformComponent>();
-        for (auto entity : view) {
-            auto& c = view.get<CreepComponent>(entity);
-            auto& t = view.get<TransformComponent>(entity);
-            if (c.teamId == teamId && c.lane == lane && c.state != CreepState::Dead) {
-                // Count creeps near spawn point
-                f32 dist = glm::length(t.position - spawnTransform.position);
-                if (dist < 15.0f) {
-                    creepIndex++;
-                }
-            }
-        }
-    }
-    
-    // Calculate formation offset (line formation perpendicular to lane direction)
-    Vec3 laneDir = creepComp.laneDirection;
-    if (glm::length(laneDir) < 0.1f) {
-        laneDir = Vec3(1, 0, 0); // Default direction
-    }
-    Vec3 perpDir = glm::normalize(Vec3(-laneDir.z, 0, laneDir.x)); // Perpendicular to lane
-    
-    // Formation: spread creeps in a line with some depth (scaled for 16000 map)
-    f32 spacing = 80.0f;  // Space between creeps (~80 units)
-    i32 row = creepIndex / 3;  // 3 creeps per row
-    i32 col = creepIndex % 3;
-    
-    // Offset from center (-1, 0, 1 for columns)
-    f32 lateralOffset = (col - 1) * spacing;
-    f32 depthOffset = row * spacing * 1.5f;  // Rows behind each other
-    
-    // Add small random variation to avoid perfect grid
-    f32 randX = ((rand() % 100) / 100.0f - 0.5f) * 20.0f;
-    f32 randZ = ((rand() % 100) / 100.0f - 0.5f) * 20.0f;
-    
-    Vec3 formationOffset = perpDir * lateralOffset - laneDir * depthOffset + Vec3(randX, 0, randZ);
-    
-    // Set spawn position with formation offset
-    transform.position = spawnTransform.position + formationOffset;
-    
-    // Get lane waypoints for pathfinding
-    creepComp.path = getLaneWaypoints(lane, teamId);
-    creepComp.currentWaypointIndex = 0;
-    
-    // Store formation index for maintaining formation during movement
-    creepComp.formationIndex = creepIndex;
     
     // Create mesh based on type (sized for 16000x16000 map)
     // Creeps: ~30-50 units radius, ~60-100 units height
-    auto& mesh = entityManager_.addComponent<MeshComponent>(creep, "CreepMesh");
+    MeshComponent mesh("CreepMesh");
     switch (type) {
         case CreepType::Melee:
             MeshGenerators::GenerateCylinder(mesh, 35.0f, 70.0f, 12);
@@ -642,89 +584,52 @@ Entity CreepSystem::spawnCreep(Entity spawnPoint, CreepType type, i32 teamId, Cr
     }
     mesh.gpuUploadNeeded = true;
     
-    // Create material
-    Entity materialEntity = entityManager_.createEntity("CreepMaterial");
-    auto& material = entityManager_.addComponent<MaterialComponent>(materialEntity, "CreepMaterial");
-    
     // Team colors
+    MaterialComponent material("CreepMaterial");
     if (teamId == 1) {
         material.baseColor = Vec3(0.2f, 0.8f, 0.2f); // Green for Radiant
     } else {
         material.baseColor = Vec3(0.8f, 0.2f, 0.2f); // Red for Dire
     }
     
-    mesh.materialEntity = materialEntity;
-    
-    // Add collision
-    auto& collision = entityManager_.addComponent<CollisionComponent>(creep, CollisionShape::Capsule);
+    CollisionComponent collision(CollisionShape::Capsule);
     collision.capsuleRadius = 0.8f;
     collision.capsuleHeight = 1.5f;
     collision.blocksMovement = true;
     
-    return creep;
+    // Each (type, team) pair is its own prefab; the entity name stays "Creep"
+    Prefab prefab("Creep_" + std::to_string(typeIndex) + "_" + std::to_string(teamIndex));
+    prefab.withEntityName("Creep")
+          .with(creepComp)
+          .with(TransformComponent())
+          .with(std::move(mesh))
+          .with(collision)
+          .withMaterial(material);
+    id = entityManager_.getPrefabs().add(std::move(prefab));
+    return id;
 }
 
-Vector<Vec3> CreepSystem::getLaneWaypoints(CreepLane lane, i32 teamId) const {
-    Vector<Vec3> waypoints;
-    
-    // Get waypoints from placed waypoint objects
-    auto& registry = entityManager_.getRegistry();
-    auto view = registry.view<ObjectComponent, TransformComponent>();
-    
-    Vector<std::pair<i32, Vec3>> orderedWaypoints;
-    
-    for (auto entity : view) {
-        auto& obj = view.get<ObjectComponent>(entity);
-        auto& transform = view.get<TransformComponent>(entity);
-        
-        if (obj.type == ObjectType::Waypoint) {
-            // Check if waypoint matches lane and team
-            if (obj.waypointLane == static_cast<i32>(lane) || obj.waypointLane == -1) {
-                // For now, use all waypoints regardless of team
-                // In full implementation, would filter by team direction
-                orderedWaypoints.push_back({obj.waypointOrder, transform.position});
-            }
-        }
+PrefabId CreepSystem::getProjectilePrefab() {
+    if (projectilePrefab_ != INVALID_PREFAB) {
+        return projectilePrefab_;
     }
     
-    // Sort by order
-    std::sort(orderedWaypoints.begin(), orderedWaypoints.end(),
-              [](const auto& a, const auto& b) { return a.first < b.first; });
-    
-    // Extract positions
-    for (const auto& wp : orderedWaypoints) {
-        waypoints.push_back(wp.second);
-    }
-    
-    // Fallback: create simple lane path if no waypoints found
-    if (waypoints.empty()) {
-        Vec3 start, end;
-        switch (lane) {
-            case CreepLane::Top:
-                start = teamId == 1 ? Vec3(50, 0, 250) : Vec3(250, 0, 50);
-                end = teamId == 1 ? Vec3(250, 0, 50) : Vec3(50, 0, 250);
-                break;
-            case CreepLane::Middle:
-                start = teamId == 1 ? Vec3(50, 0, 50) : Vec3(250, 0, 250);
-                end = teamId == 1 ? Vec3(250, 0, 250) : Vec3(50, 0, 50);
-                break;
-            case CreepLane::Bottom:
-                start = teamId == 1 ? Vec3(250, 0, 50) : Vec3(50, 0, 250);
-                end = teamId == 1 ? Vec3(50, 0, 250) : Vec3(250, 0, 50);
-                break;
-        }
-        
-        waypoints.push_back(start);
-        waypoints.push_back(Vec3((start.x + end.x) * 0.5f, 0, (start.z + end.z) * 0.5f));
-        waypoints.push_back(end);
-    }
+    // Add simple mesh for projectile visualization
+    MeshComponent mesh("Projectile");
+    MeshGenerators::GenerateSphere(mesh, 0.1f, 8);
+    mesh.gpuUploadNeeded = true;
     
-    return waypoints;
-}
-
-bool CreepSystem::hasLineOfSight(const Vec3& from, const Vec3& to) const {
-    // Simple implementation - in full version would raycast against terrain/obstacles
-    return true;
+    MaterialComponent material("ProjectileMaterial");
+    material.baseColor = Vec3(1.0f, 0.8f, 0.2f); // Yellow projectile
+    material.emissiveColor = Vec3(0.2f, 0.1f, 0.0f);
+    
+    Prefab prefab("CreepProjectile");
+    prefab.withEntityName("Projectile")
+          .with(TransformComponent())
+          .with(std::move(mesh))
+          .withMaterial(material);
+    projectilePrefab_ = entityManager_.getPrefabs().add(std::move(prefab));
+    return projectilePrefab_;
 }
 
 bool CreepSystem::isInAttackRange(const Vec3& attackerPos, const Vec3& targetPos, f32 range) const {
@@ -3,6 +3,8 @@
 #include "System.h"
 #include "Components.h"
 #include "EntityManager.h"
+#include "CrowdSteering.h"
+#include "AiLodScheduler.h"
 #include "core/Types.h"
 
 namespace WorldEditor {
@@ -16,6 +18,7 @@ public:
 
     void update(f32 deltaTime) override;
     String getName() const override { return "CreepSystem"; }
+    void declareAccess(SystemAccess& access) const override;
     
     // Set world reference
     void setWorld(World* world) { world_ = world; }
@@ -23,12 +26,35 @@ public:
     // Spawn creep at spawn point
     Entity spawnCreep(Entity spawnPoint, CreepType type, i32 teamId, CreepLane lane);
     
-    // Get lane waypoints for pathfinding
-    Vector<Vec3> getLaneWaypoints(CreepLane lane, i32 teamId) const;
+    // Spawn a group of one creep type from its prefab in a single batch. Formation slots
+    // start at firstFormationIndex, or after the creeps already at the spawn point if < 0.
+    // Returns the number of creeps spawned.
+    i32 spawnCreeps(Entity spawnPoint, CreepType type, i32 teamId, CreepLane lane,
+                    i32 count, i32 firstFormationIndex = -1);
+    
+    // Reserve component storage ahead of the first waves
+    void prewarm(size_t creepCount, size_t projectileCount);
+    
+    // Crowd separation tuning (neighbour count, refresh rate)
+    CrowdSteering& getCrowdSteering() { return crowd_; }
+    
+    // Target search cadence by distance to heroes, optional per-tick budget
+    AiLodScheduler& getAiLod() { return aiLod_; }
 
 private:
     EntityManager& entityManager_;
     World* world_ = nullptr;
+    CrowdSteering crowd_;
+    AiLodScheduler aiLod_;
+    const LaneFlowFields* flowFields_ = nullptr;    // Fetched at the start of each update
+    
+    // Spawn templates, built on first use
+    static constexpr size_t kCreepTypeCount = 9;
+    PrefabId getCreepPrefab(CreepType type, i32 teamId);
+    PrefabId getProjectilePrefab();
+    PrefabId creepPrefabs_[kCreepTypeCount][2];     // [type][Radiant, Dire]
+    PrefabId projectilePrefab_ = INVALID_PREFAB;
+    Vector<Entity> spawnScratch_;
     
     // Creep AI behavior
     void updateCreepAI(Entity entity, CreepComponent& creep, TransformComponent& transform, f32 deltaTime);
@@ -42,19 +68,14 @@ private:
     Entity findNearestEnemyHero(const Vec3& position, i32 teamId, f32 searchRadius);
     
     // Pathfinding helpers
-    bool hasLineOfSight(const Vec3& from, const Vec3& to) const;
-    Vec3 getNextWaypointPosition(const CreepComponent& creep, const Vec3& currentPos) const;
+    Vec3 getNextWaypointPosition(const CreepComponent& creep, const Vector<Vec3>& path, const Vec3& currentPos) const;
+    void advancePassedWaypoints(CreepComponent& creep, const Vector<Vec3>& path, const Vec3& currentPos) const;
     
     // Combat helpers
     bool isInAttackRange(const Vec3& attackerPos, const Vec3& targetPos, f32 range) const;
-    void dealDamage(Entity attacker, Entity target, f32 damage);
     
     // Spawn management
     void cleanupDeadCreeps(f32 deltaTime);
-    
-    // Performance optimization
-    f32 lastFullUpdate_ = 0.0f;
-    static constexpr f32 FULL_UPDATE_INTERVAL = 0.1f; // 10 Hz for expensive operations
 };
 
 } // namespace WorldEditor
\ No newline at end of file
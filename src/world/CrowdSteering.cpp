@@ -0,0 +1,86 @@
+#include "CrowdSteering.h"
+#include "EntityManager.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+namespace {
+
+// A wave spawns in one tick; spreading the second rebuild over this many slices of the
+// refresh interval keeps the whole wave from rebuilding its lists in the same tick
+constexpr u32 kRefreshPhases = 8;
+
+} // namespace
+
+CrowdSteering::CrowdSteering(EntityManager& entityManager)
+    : entityManager_(entityManager) {
+}
+
+void CrowdSteering::setSettings(const CrowdSettings& settings) {
+    settings_ = settings;
+    settings_.maxNeighbors = std::clamp(settings_.maxNeighbors, 0, CreepComponent::MAX_CROWD_NEIGHBORS);
+    settings_.neighborQueryScale = std::max(settings_.neighborQueryScale, 1.0f);
+}
+
+Vec3 CrowdSteering::computeSeparation(Entity entity, CreepComponent& creep, const Vec3& position, f32 deltaTime) {
+    creep.crowdRefreshCooldown -= deltaTime;
+    if (creep.crowdRefreshCooldown <= 0.0f) {
+        refreshNeighbors(entity, creep, position);
+        creep.crowdRefreshCooldown = settings_.neighborRefreshInterval;
+        if (!creep.crowdNeighborsBuilt) {
+            const u32 phase = static_cast<u32>(entity) % kRefreshPhases + 1;
+            creep.crowdRefreshCooldown *= static_cast<f32>(phase) / static_cast<f32>(kRefreshPhases);
+            creep.crowdNeighborsBuilt = true;
+        }
+    }
+
+    auto& registry = entityManager_.getRegistry();
+    const f32 radius = settings_.separationRadius;
+
+    Vec3 separation(0.0f);
+    i32 nearbyCount = 0;
+
+    for (i32 i = 0; i < creep.crowdNeighborCount; ++i) {
+        Entity other = creep.crowdNeighbors[i];
+        if (!registry.valid(other)) {
+            continue;
+        }
+
+        const auto* otherCreep = registry.try_get<CreepComponent>(other);
+        const auto* otherTransform = registry.try_get<TransformComponent>(other);
+        if (!otherCreep || !otherTransform || otherCreep->state == CreepState::Dead) {
+            continue;
+        }
+
+        Vec3 diff = position - otherTransform->position;
+        f32 dist = glm::length(diff);
+
+        if (dist > 0.1f && dist < radius) {
+            // Push away from nearby creeps
+            separation += (diff / dist) * (1.0f - dist / radius);
+            nearbyCount++;
+        }
+    }
+
+    if (nearbyCount > 0) {
+        separation = separation / static_cast<f32>(nearbyCount) * settings_.separationStrength;
+    }
+    return separation;
+}
+
+void CrowdSteering::refreshNeighbors(Entity entity, CreepComponent& creep, const Vec3& position) {
+    SpatialFilter filter;
+    filter.typeMask = SpatialType::Creep;   // Both teams: separation ignores allegiance
+    filter.ignore = entity;
+
+    const f32 queryRadius = settings_.separationRadius * settings_.neighborQueryScale;
+    entityManager_.getSpatialGrid().queryKNearest(position, queryRadius,
+                                                  static_cast<size_t>(settings_.maxNeighbors), filter, scratch_);
+
+    creep.crowdNeighborCount = 0;
+    for (const auto& hit : scratch_) {
+        creep.crowdNeighbors[creep.crowdNeighborCount++] = hit.entity;
+    }
+}
+
+} // namespace WorldEditor
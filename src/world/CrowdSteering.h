@@ -0,0 +1,43 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+#include "SpatialGrid.h"
+
+namespace WorldEditor {
+
+class EntityManager;
+
+struct CrowdSettings {
+    f32 separationRadius = 3.0f;        // Creeps closer than this push each other apart
+    f32 separationStrength = 2.0f;
+    i32 maxNeighbors = 6;               // K closest creeps kept per agent (<= MAX_CROWD_NEIGHBORS)
+    f32 neighborQueryScale = 2.0f;      // Query radius = separationRadius * scale, covers drift between refreshes
+    f32 neighborRefreshInterval = 0.2f; // Seconds between neighbour list rebuilds (0 = every tick)
+};
+
+// Creep crowd separation with bounded per-agent neighbour lists.
+// Each creep keeps the K closest creeps within the separation radius (queried from the
+// SpatialGrid) and only rebuilds that list every neighborRefreshInterval seconds; the first
+// rebuild after spawning is staggered by entity id so a wave does not refresh in one tick.
+// The per-tick separation force reads live positions of those neighbours, so cost is
+// O(N * K) instead of O(N^2).
+class CrowdSteering {
+public:
+    explicit CrowdSteering(EntityManager& entityManager);
+
+    void setSettings(const CrowdSettings& settings);
+    const CrowdSettings& getSettings() const { return settings_; }
+
+    // Separation vector for a moving creep (already scaled by separationStrength)
+    Vec3 computeSeparation(Entity entity, CreepComponent& creep, const Vec3& position, f32 deltaTime);
+
+private:
+    void refreshNeighbors(Entity entity, CreepComponent& creep, const Vec3& position);
+
+    EntityManager& entityManager_;
+    CrowdSettings settings_;
+    Vector<SpatialHit> scratch_;
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,94 @@
+#include "EntityCommandBuffer.h"
+#include "EntityManager.h"
+#include "core/Profiler.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+namespace {
+
+// Initializers that keep spawning more entities would otherwise never finish
+constexpr u32 kMaxFlushPasses = 8;
+
+} // namespace
+
+void EntityCommandBuffer::create(const String& name, CreateFunc init, u32 sortKey) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_.push_back({CommandType::Create, sortKey, INVALID_ENTITY, name, std::move(init), nullptr});
+}
+
+void EntityCommandBuffer::destroy(Entity entity, u32 sortKey) {
+    record(CommandType::Destroy, sortKey, entity, String(), nullptr);
+}
+
+void EntityCommandBuffer::record(CommandType type, u32 sortKey, Entity entity, String name, ApplyFunc apply) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_.push_back({type, sortKey, entity, std::move(name), nullptr, std::move(apply)});
+}
+
+size_t EntityCommandBuffer::flush(EntityManager& entityManager) {
+    PROFILE_SCOPE("EntityCommandBuffer::flush");
+    size_t applied = 0;
+
+    for (u32 pass = 0; pass < kMaxFlushPasses; ++pass) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (commands_.empty()) {
+                return applied;
+            }
+            flushing_.swap(commands_);
+        }
+
+        std::stable_sort(flushing_.begin(), flushing_.end(), [](const Command& a, const Command& b) {
+            return a.sortKey < b.sortKey;
+        });
+
+        Registry& registry = entityManager.getRegistry();
+        for (Command& command : flushing_) {
+            switch (command.type) {
+                case CommandType::Create: {
+                    Entity entity = entityManager.createEntity(command.name);
+                    if (command.init) {
+                        command.init(entity);
+                    }
+                    break;
+                }
+                case CommandType::Destroy:
+                    entityManager.destroyEntity(command.entity);
+                    break;
+                case CommandType::AddComponent:
+                case CommandType::RemoveComponent:
+                    if (entityManager.isValid(command.entity)) {
+                        command.apply(registry, command.entity);
+                    }
+                    break;
+            }
+        }
+
+        applied += flushing_.size();
+        flushing_.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!commands_.empty()) {
+        LOG_WARN("EntityCommandBuffer: {} command(s) deferred to the next flush (recursive spawns)", commands_.size());
+    }
+    return applied;
+}
+
+void EntityCommandBuffer::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_.clear();
+}
+
+bool EntityCommandBuffer::empty() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return commands_.empty();
+}
+
+size_t EntityCommandBuffer::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return commands_.size();
+}
+
+} // namespace WorldEditor
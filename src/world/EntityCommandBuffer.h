@@ -0,0 +1,81 @@
+#pragma once
+
+#include "core/Types.h"
+#include <functional>
+#include <mutex>
+
+namespace WorldEditor {
+
+class EntityManager;
+
+// Records structural changes (create, destroy, add/remove component) during system
+// updates and applies them later at a sync point, so systems never invalidate the
+// views they are iterating.
+//
+// Recording is thread-safe. Flush order is deterministic: commands are stably sorted by
+// sortKey, and within one key they keep recording order. Producers running concurrently
+// (e.g. parallelFor chunks) must therefore use distinct sort keys, such as their chunk
+// index; single-threaded systems can keep the default key 0.
+class EntityCommandBuffer {
+public:
+    using CreateFunc = std::function<void(Entity)>;
+
+    // init(entity) runs during flush, right after the entity is created
+    void create(const String& name, CreateFunc init, u32 sortKey = 0);
+
+    // Destroying an entity that is already gone (or destroyed twice) is a no-op
+    void destroy(Entity entity, u32 sortKey = 0);
+
+    // Emplaces or replaces at flush; skipped if the entity was destroyed meanwhile.
+    // Component must be copyable (it is stored until the flush).
+    template<typename Component>
+    void addComponent(Entity entity, Component component, u32 sortKey = 0) {
+        record(CommandType::AddComponent, sortKey, entity, String(),
+            [component = std::move(component)](Registry& registry, Entity target) {
+                registry.emplace_or_replace<Component>(target, component);
+            });
+    }
+
+    template<typename Component>
+    void removeComponent(Entity entity, u32 sortKey = 0) {
+        record(CommandType::RemoveComponent, sortKey, entity, String(),
+            [](Registry& registry, Entity target) {
+                registry.remove<Component>(target);
+            });
+    }
+
+    // Apply everything recorded so far. Commands recorded by create() initializers are
+    // applied in the same call. Returns the number of commands applied.
+    size_t flush(EntityManager& entityManager);
+
+    void clear();
+    bool empty() const;
+    size_t size() const;
+
+private:
+    enum class CommandType : u8 {
+        Create,
+        Destroy,
+        AddComponent,
+        RemoveComponent
+    };
+
+    using ApplyFunc = std::function<void(Registry&, Entity)>;
+
+    struct Command {
+        CommandType type;
+        u32 sortKey;
+        Entity entity;
+        String name;        // Create only
+        CreateFunc init;    // Create only
+        ApplyFunc apply;    // Add/RemoveComponent only
+    };
+
+    void record(CommandType type, u32 sortKey, Entity entity, String name, ApplyFunc apply);
+
+    mutable std::mutex mutex_;
+    Vector<Command> commands_;
+    Vector<Command> flushing_;      // Reused between flushes
+};
+
+} // namespace WorldEditor
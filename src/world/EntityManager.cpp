@@ -4,10 +4,30 @@
 namespace WorldEditor {
 
 EntityManager::EntityManager() {
+    // Only static colliders matter, so emplace them with isStatic already set
+    registry_.on_construct<CollisionComponent>().connect<&EntityManager::onCollisionChanged>(*this);
+    registry_.on_update<CollisionComponent>().connect<&EntityManager::onCollisionChanged>(*this);
+    registry_.on_destroy<CollisionComponent>().connect<&EntityManager::onCollisionChanged>(*this);
+    // Same for waypoints: the object type is set after emplace
+    registry_.on_construct<ObjectComponent>().connect<&EntityManager::markLanePathsDirty>(*this);
+    registry_.on_update<ObjectComponent>().connect<&EntityManager::markLanePathsDirty>(*this);
+    registry_.on_destroy<ObjectComponent>().connect<&EntityManager::onObjectDestroyed>(*this);
+    registry_.on_construct<TerrainComponent>().connect<&EntityManager::markNavGridDirty>(*this);
+    registry_.on_update<TerrainComponent>().connect<&EntityManager::markNavGridDirty>(*this);
+    registry_.on_destroy<TerrainComponent>().connect<&EntityManager::markNavGridDirty>(*this);
     LOG_INFO("EntityManager initialized");
 }
 
 EntityManager::~EntityManager() {
+    registry_.on_construct<CollisionComponent>().disconnect(*this);
+    registry_.on_update<CollisionComponent>().disconnect(*this);
+    registry_.on_destroy<CollisionComponent>().disconnect(*this);
+    registry_.on_construct<ObjectComponent>().disconnect(*this);
+    registry_.on_update<ObjectComponent>().disconnect(*this);
+    registry_.on_destroy<ObjectComponent>().disconnect(*this);
+    registry_.on_construct<TerrainComponent>().disconnect(*this);
+    registry_.on_update<TerrainComponent>().disconnect(*this);
+    registry_.on_destroy<TerrainComponent>().disconnect(*this);
     LOG_INFO("EntityManager destroyed");
 }
 
@@ -37,7 +57,28 @@ size_t EntityManager::getEntityCount() const {
 }
 
 void EntityManager::clear() {
+    commands_.clear();
+    combat_.clear();
+    projectiles_.clear();
+    spatialGrid_.clear();
+    visibility_.clear();
     registry_.clear();
+    markStaticCollidersDirty();
+    markLanePathsDirty();
+    markNavGridDirty();
+}
+
+void EntityManager::onCollisionChanged(Registry& registry, Entity entity) {
+    // Dynamic colliders (creeps, heroes) spawn and die constantly; only static ones matter
+    if (registry.get<CollisionComponent>(entity).isStatic) {
+        markStaticCollidersDirty();
+    }
+}
+
+void EntityManager::onObjectDestroyed(Registry& registry, Entity entity) {
+    if (registry.get<ObjectComponent>(entity).type == ObjectType::Waypoint) {
+        markLanePathsDirty();
+    }
 }
 
 Vector<Entity> EntityManager::getEntitiesWithName(const String& name) const {
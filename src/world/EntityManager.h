@@ -1,7 +1,18 @@
 #pragma once
 
 #include "core/Types.h"
+#include "core/JobSystem.h"
 #include "Components.h"
+#include "SpatialGrid.h"
+#include "EntityCommandBuffer.h"
+#include "CombatEvents.h"
+#include "LanePaths.h"
+#include "NavGrid.h"
+#include "LaneFlowFields.h"
+#include "Visibility.h"
+#include "Prefabs.h"
+#include "ProjectilePool.h"
+#include <algorithm>
 
 namespace WorldEditor {
 
@@ -73,6 +84,60 @@ public:
         }
     }
 
+    // Parallel iteration over a view. The view is snapshotted into an entity list and split
+    // into chunks of `grain`; func(entity, components&...) runs on job threads, so it may only
+    // touch the components of the entity it was given and must not create/destroy entities or
+    // add/remove components. Runs serially when no job system is attached.
+    template<typename... Components, typename Func>
+    void parallelForEach(Func func, u32 grain = 256) {
+        auto view = registry_.view<Components...>();
+        if (!jobSystem_ || jobSystem_->getWorkerCount() == 0) {
+            for (auto entity : view) {
+                func(entity, view.template get<Components>(entity)...);
+            }
+            return;
+        }
+
+        Vector<Entity> entities(view.begin(), view.end());
+        jobSystem_->parallelFor(static_cast<u32>(entities.size()), grain, [&](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i) {
+                func(entities[i], view.template get<Components>(entities[i])...);
+            }
+        });
+    }
+
+    // Deterministic reduction over a view: map(entity, components&...) -> T per entity,
+    // combine(T, T) -> T, folded per chunk and then in view order. The result does not
+    // depend on the worker count, so it is safe to feed back into the simulation.
+    template<typename... Components, typename T, typename MapFunc, typename CombineFunc>
+    T parallelReduce(T identity, MapFunc map, CombineFunc combine, u32 grain = 256) {
+        grain = std::max(grain, 1u);
+        auto view = registry_.view<Components...>();
+        Vector<Entity> entities(view.begin(), view.end());
+        auto mapRange = [&](u32 begin, u32 end) {
+            T partial = identity;
+            for (u32 i = begin; i < end; ++i) {
+                partial = combine(partial, map(entities[i], view.template get<Components>(entities[i])...));
+            }
+            return partial;
+        };
+
+        const u32 count = static_cast<u32>(entities.size());
+        if (!jobSystem_) {
+            // Same chunking as the job path so both give identical float results
+            T result = identity;
+            for (u32 begin = 0; begin < count; begin += grain) {
+                result = combine(result, mapRange(begin, std::min(begin + grain, count)));
+            }
+            return result;
+        }
+        return jobSystem_->parallelReduce(count, grain, identity, mapRange, combine);
+    }
+
+    // Optional, owned by the host (DedicatedServer, benchmarks); null means serial
+    void setJobSystem(JobSystem* jobSystem) { jobSystem_ = jobSystem; }
+    JobSystem* getJobSystem() const { return jobSystem_; }
+
     // Utility functions
     size_t getEntityCount() const;
     Vector<Entity> getEntitiesWithName(const String& name) const;
@@ -82,8 +147,97 @@ public:
     Registry& getRegistry() { return registry_; }
     const Registry& getRegistry() const { return registry_; }
 
+    // Static collider revision: bumped whenever a static collider is added, removed or
+    // moved, so broadphase structures know when to rebuild. Adding, patching or removing a
+    // static CollisionComponent is tracked automatically (emplace it with isStatic already
+    // set); editor code that moves static objects must call mark.
+    void markStaticCollidersDirty() { ++staticColliderRevision_; }
+    u64 getStaticColliderRevision() const { return staticColliderRevision_; }
+
+    // Creep lane paths, rebuilt on first use after the lane path revision changes.
+    // ObjectComponent add/remove is tracked automatically; editor code that moves or
+    // edits waypoints must call mark. Rebuilds happen on the calling thread, so fetch
+    // the table before fanning work out to jobs.
+    void markLanePathsDirty() { ++lanePathRevision_; }
+    const LanePathTable& getLanePaths() {
+        if (lanePathsBuiltRevision_ != lanePathRevision_) {
+            lanePaths_.build(registry_);
+            lanePathsBuiltRevision_ = lanePathRevision_;
+        }
+        return lanePaths_;
+    }
+
+    // Walkability grid for hero pathing, rebuilt on first use after the terrain or a
+    // static collider changed. TerrainComponent add/remove is tracked automatically;
+    // terrain editing must call mark. Same threading rule as the lane paths.
+    void markNavGridDirty() { ++navGridRevision_; }
+    const NavGrid& getNavGrid() {
+        if (navGridBuiltRevision_ != navGridRevision_ || navGridColliderRevision_ != staticColliderRevision_) {
+            navGrid_.build(registry_);
+            navGridBuiltRevision_ = navGridRevision_;
+            navGridColliderRevision_ = staticColliderRevision_;
+        }
+        return navGrid_;
+    }
+
+    // Creep flow fields for every lane; brings the nav grid and lane paths up to date,
+    // then recomputes what changed (everything, or the lanes whose objective fell).
+    // Call once per tick on the updating thread, before sampling from jobs.
+    const LaneFlowFields& getLaneFlowFields() {
+        const NavGrid& grid = getNavGrid();
+        laneFlowFields_.update(registry_, grid, getLanePaths(), lanePathRevision_);
+        return laneFlowFields_;
+    }
+
+    // Per-team fog of war, brought up to date once per server tick (after the spatial
+    // grid); terrain edits are picked up through the nav grid revision
+    VisibilityGrid& getVisibility() { return visibility_; }
+    const VisibilityGrid& getVisibility() const { return visibility_; }
+    size_t updateVisibility() { return visibility_.update(registry_, navGridRevision_); }
+
+    // Deferred structural changes; systems record here while iterating views and the
+    // world applies them at sync points (after each scheduler stage)
+    EntityCommandBuffer& getCommandBuffer() { return commands_; }
+    size_t flushCommands() { return commands_.flush(*this); }
+
+    // Deferred damage and heals, resolved in one batch at the same sync points
+    CombatEventBuffer& getCombatEvents() { return combat_; }
+    const CombatEventBuffer& getCombatEvents() const { return combat_; }
+    size_t resolveCombat() { return combat_.resolve(*this); }
+
+    // Spawn templates registered by the creep, projectile and particle systems
+    PrefabLibrary& getPrefabs() { return prefabs_; }
+
+    // Creep and tower attacks in flight, advanced by ProjectileSystem
+    ProjectilePool& getProjectiles() { return projectiles_; }
+    const ProjectilePool& getProjectiles() const { return projectiles_; }
+
+    // Shared proximity index, rebuilt once per simulation tick
+    SpatialGrid& getSpatialGrid() { return spatialGrid_; }
+    const SpatialGrid& getSpatialGrid() const { return spatialGrid_; }
+    void rebuildSpatialGrid() { spatialGrid_.rebuild(registry_); }
+
 private:
+    void onCollisionChanged(Registry& registry, Entity entity);
+    void onObjectDestroyed(Registry& registry, Entity entity);
+
     Registry registry_;
+    SpatialGrid spatialGrid_;
+    EntityCommandBuffer commands_;
+    CombatEventBuffer combat_;
+    PrefabLibrary prefabs_{*this};
+    ProjectilePool projectiles_{*this};
+    u64 staticColliderRevision_ = 0;
+    LanePathTable lanePaths_;
+    u64 lanePathRevision_ = 0;
+    u64 lanePathsBuiltRevision_ = ~0ull;
+    NavGrid navGrid_;
+    u64 navGridRevision_ = 0;
+    u64 navGridBuiltRevision_ = ~0ull;
+    u64 navGridColliderRevision_ = 0;
+    LaneFlowFields laneFlowFields_;
+    VisibilityGrid visibility_;
+    JobSystem* jobSystem_ = nullptr;
     World* world_ = nullptr;
 };
 
@@ -0,0 +1,402 @@
+#include "GameData.h"
+
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace WorldEditor {
+
+using json = nlohmann::json;
+
+namespace {
+
+constexpr int kGameDataVersion = 1;
+constexpr const char* kGameDataPath = "resources/data/game_data.json";
+
+// Element tag -> cast color and default hit/area particles
+struct ElementInfo {
+    const char* name;
+    Vec4 color;
+    AbilityVisual hitVisual;
+    AbilityVisual areaVisual;
+};
+
+const ElementInfo kElements[] = {
+    { "arcane",    Vec4(0.4f, 0.6f, 1.0f, 1.0f),  AbilityVisual::Attack,    AbilityVisual::Explosion },
+    { "fire",      Vec4(1.0f, 0.5f, 0.1f, 1.0f),  AbilityVisual::Fire,      AbilityVisual::FireExplosion },
+    { "ice",       Vec4(0.6f, 0.9f, 1.0f, 1.0f),  AbilityVisual::Ice,       AbilityVisual::Ice },
+    { "poison",    Vec4(0.3f, 0.8f, 0.2f, 1.0f),  AbilityVisual::Poison,    AbilityVisual::Explosion },
+    { "lightning", Vec4(0.7f, 0.8f, 1.0f, 1.0f),  AbilityVisual::Lightning, AbilityVisual::LightningStrikes },
+    { "shadow",    Vec4(0.4f, 0.2f, 0.6f, 1.0f),  AbilityVisual::Attack,    AbilityVisual::Explosion },
+    { "holy",      Vec4(1.0f, 0.95f, 0.7f, 1.0f), AbilityVisual::Attack,    AbilityVisual::Explosion },
+};
+
+template<typename Enum>
+struct EnumName {
+    const char* name;
+    Enum value;
+};
+
+const EnumName<AbilityTargetType> kTargetTypes[] = {
+    { "none", AbilityTargetType::NoTarget },
+    { "point", AbilityTargetType::PointTarget },
+    { "unit", AbilityTargetType::UnitTarget },
+    { "vector", AbilityTargetType::VectorTarget },
+    { "passive", AbilityTargetType::Passive },
+};
+
+const EnumName<AbilityEffect> kAbilityEffects[] = {
+    { "none", AbilityEffect::None },
+    { "target_nuke", AbilityEffect::TargetNuke },
+    { "area_nuke", AbilityEffect::AreaNuke },
+    { "self_buff", AbilityEffect::SelfBuff },
+    { "nova", AbilityEffect::Nova },
+    { "passive", AbilityEffect::Passive },
+};
+
+const EnumName<AbilityVisual> kVisuals[] = {
+    { "none", AbilityVisual::None },
+    { "attack", AbilityVisual::Attack },
+    { "fire", AbilityVisual::Fire },
+    { "ice", AbilityVisual::Ice },
+    { "poison", AbilityVisual::Poison },
+    { "lightning", AbilityVisual::Lightning },
+    { "explosion", AbilityVisual::Explosion },
+    { "fire_explosion", AbilityVisual::FireExplosion },
+    { "lightning_strikes", AbilityVisual::LightningStrikes },
+    { "shield", AbilityVisual::Shield },
+    { "aura", AbilityVisual::Aura },
+};
+
+const EnumName<ItemEffect> kItemEffects[] = {
+    { "none", ItemEffect::None },
+    { "heal_over_time", ItemEffect::HealOverTime },
+    { "mana_over_time", ItemEffect::ManaOverTime },
+    { "blink", ItemEffect::Blink },
+};
+
+const EnumName<HeroAttribute> kAttributes[] = {
+    { "strength", HeroAttribute::Strength },
+    { "agility", HeroAttribute::Agility },
+    { "intelligence", HeroAttribute::Intelligence },
+};
+
+template<typename Enum, size_t N>
+bool parseEnum(const EnumName<Enum> (&names)[N], const String& text, Enum& out) {
+    for (const auto& entry : names) {
+        if (text == entry.name) {
+            out = entry.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Optional enum field; false (with an error) only if present and unknown
+template<typename Enum, size_t N>
+bool readEnum(const json& j, const char* field, const EnumName<Enum> (&names)[N], Enum& out,
+              const String& owner, String* outError) {
+    if (!j.contains(field)) {
+        return true;
+    }
+    const String text = j[field].get<String>();
+    if (!parseEnum(names, text, out)) {
+        if (outError) *outError = "Unknown " + String(field) + " '" + text + "' in '" + owner + "'";
+        return false;
+    }
+    return true;
+}
+
+// Behavior implied by the targeting fields when the data does not name one
+AbilityEffect defaultEffect(const AbilityData& data) {
+    switch (data.targetType) {
+        case AbilityTargetType::UnitTarget: return AbilityEffect::TargetNuke;
+        case AbilityTargetType::PointTarget: return data.radius > 0.0f ? AbilityEffect::AreaNuke : AbilityEffect::None;
+        case AbilityTargetType::NoTarget: return data.duration > 0.0f ? AbilityEffect::SelfBuff : AbilityEffect::Nova;
+        case AbilityTargetType::Passive: return AbilityEffect::Passive;
+        default: return AbilityEffect::None;
+    }
+}
+
+bool parseAbility(const String& key, const json& j, AbilityData& data, String* outError) {
+    data.name = j.value("name", key);
+    data.description = j.value("description", "");
+    if (!readEnum(j, "target", kTargetTypes, data.targetType, key, outError)) return false;
+
+    data.manaCost = j.value("mana_cost", data.manaCost);
+    data.cooldown = j.value("cooldown", data.cooldown);
+    data.castRange = j.value("cast_range", data.castRange);
+    data.castPoint = j.value("cast_point", data.castPoint);
+    data.castBackswing = j.value("cast_backswing", data.castBackswing);
+    data.damage = j.value("damage", data.damage);
+    data.duration = j.value("duration", data.duration);
+    data.radius = j.value("radius", data.radius);
+    data.maxLevel = j.value("max_level", data.maxLevel);
+
+    const String hotkey = j.value("hotkey", "");
+    if (!hotkey.empty()) {
+        data.hotkey = hotkey[0];
+    }
+
+    data.effect = defaultEffect(data);
+    if (!readEnum(j, "effect", kAbilityEffects, data.effect, key, outError)) return false;
+
+    const String element = j.value("element", "arcane");
+    const ElementInfo* info = nullptr;
+    for (const auto& candidate : kElements) {
+        if (element == candidate.name) {
+            info = &candidate;
+            break;
+        }
+    }
+    if (!info) {
+        if (outError) *outError = "Unknown element '" + element + "' in '" + key + "'";
+        return false;
+    }
+    data.color = info->color;
+    data.hitVisual = info->hitVisual;
+    data.areaVisual = info->areaVisual;
+
+    if (!readEnum(j, "hit_visual", kVisuals, data.hitVisual, key, outError)) return false;
+    if (!readEnum(j, "area_visual", kVisuals, data.areaVisual, key, outError)) return false;
+    if (!readEnum(j, "buff_visual", kVisuals, data.buffVisual, key, outError)) return false;
+    return true;
+}
+
+bool parseItem(const String& key, const json& j, ItemData& data, String* outError) {
+    data.name = j.value("name", key);
+    data.description = j.value("description", "");
+    data.goldCost = j.value("gold_cost", data.goldCost);
+
+    data.bonusStrength = j.value("strength", data.bonusStrength);
+    data.bonusAgility = j.value("agility", data.bonusAgility);
+    data.bonusIntelligence = j.value("intelligence", data.bonusIntelligence);
+    data.bonusDamage = j.value("damage", data.bonusDamage);
+    data.bonusArmor = j.value("armor", data.bonusArmor);
+    data.bonusAttackSpeed = j.value("attack_speed", data.bonusAttackSpeed);
+    data.bonusMoveSpeed = j.value("move_speed", data.bonusMoveSpeed);
+    data.bonusHealth = j.value("health", data.bonusHealth);
+    data.bonusMana = j.value("mana", data.bonusMana);
+    data.bonusHealthRegen = j.value("health_regen", data.bonusHealthRegen);
+    data.bonusManaRegen = j.value("mana_regen", data.bonusManaRegen);
+
+    data.isConsumable = j.value("consumable", data.isConsumable);
+    data.maxStack = j.value("max_stack", data.maxStack);
+    data.isStackable = data.maxStack > 1;
+
+    if (j.contains("active")) {
+        const json& active = j["active"];
+        data.hasActive = true;
+        if (!readEnum(active, "effect", kItemEffects, data.activeEffect, key, outError)) return false;
+        data.activeCooldown = active.value("cooldown", data.activeCooldown);
+        data.activeManaCost = active.value("mana_cost", data.activeManaCost);
+        data.activeValue = active.value("value", data.activeValue);
+        data.activeDuration = active.value("duration", data.activeDuration);
+        data.activeRange = active.value("range", data.activeRange);
+    }
+    return true;
+}
+
+std::filesystem::path resolveDataPath() {
+    // Same search as the UI style sheets: the process may run from build/bin/<Config>
+    // while the data lives in <repo>/resources or the copied build/resources
+    const std::filesystem::path relative(kGameDataPath);
+    std::error_code ec;
+    std::filesystem::path base = std::filesystem::current_path(ec);
+    if (ec) {
+        return relative;
+    }
+
+    for (int depth = 0; depth <= 8; ++depth) {
+        std::filesystem::path candidate = base / relative;
+        if (std::filesystem::exists(candidate, ec) && !ec) {
+            return candidate;
+        }
+        std::filesystem::path parent = base.parent_path();
+        if (parent == base) break;
+        base = parent;
+    }
+    return relative;
+}
+
+} // namespace
+
+GameDataRegistry::GameDataRegistry() {
+    clear();
+}
+
+void GameDataRegistry::clear() {
+    abilities_.assign(1, AbilityData{});
+    items_.assign(1, ItemData{});
+    heroes_.clear();
+    abilityIds_.clear();
+    itemIds_.clear();
+    heroIndex_.clear();
+    fallbackHero_ = 0;
+}
+
+bool GameDataRegistry::loadFromFile(const String& path, String* outError) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        if (outError) *outError = "Failed to open file for reading";
+        clear();
+        return false;
+    }
+
+    std::stringstream text;
+    text << f.rdbuf();
+    return loadFromString(text.str(), outError);
+}
+
+bool GameDataRegistry::loadFromString(const String& text, String* outError) {
+    clear();
+
+    try {
+        const json root = json::parse(text);
+
+        const int version = root.value("version", 0);
+        if (version != kGameDataVersion) {
+            if (outError) *outError = "Unsupported game data version";
+            return false;
+        }
+
+        if (root.contains("abilities")) {
+            for (const auto& [key, entry] : root["abilities"].items()) {
+                AbilityData data;
+                if (!parseAbility(key, entry, data, outError)) {
+                    clear();
+                    return false;
+                }
+                data.id = static_cast<u16>(abilities_.size());
+                abilityIds_[key] = data.id;
+                abilities_.push_back(std::move(data));
+            }
+        }
+
+        if (root.contains("items")) {
+            for (const auto& [key, entry] : root["items"].items()) {
+                ItemData data;
+                if (!parseItem(key, entry, data, outError)) {
+                    clear();
+                    return false;
+                }
+                data.id = static_cast<u16>(items_.size());
+                itemIds_[key] = data.id;
+                items_.push_back(std::move(data));
+            }
+        }
+
+        if (root.contains("heroes")) {
+            for (const auto& [key, entry] : root["heroes"].items()) {
+                HeroDefinition def;
+                def.name = key;
+                if (!readEnum(entry, "primary", kAttributes, def.primaryAttribute, key, outError)) {
+                    clear();
+                    return false;
+                }
+                def.baseStrength = entry.value("strength", def.baseStrength);
+                def.baseAgility = entry.value("agility", def.baseAgility);
+                def.baseIntelligence = entry.value("intelligence", def.baseIntelligence);
+                def.strengthGain = entry.value("strength_gain", def.strengthGain);
+                def.agilityGain = entry.value("agility_gain", def.agilityGain);
+                def.intelligenceGain = entry.value("intelligence_gain", def.intelligenceGain);
+                def.attackRange = entry.value("attack_range", def.attackRange);
+                def.moveSpeed = entry.value("move_speed", def.moveSpeed);
+
+                if (entry.contains("abilities")) {
+                    size_t slot = 0;
+                    for (const auto& abilityKey : entry["abilities"]) {
+                        const String name = abilityKey.get<String>();
+                        const u16 id = findAbility(name);
+                        if (id == 0 || slot >= 4) {
+                            if (outError) {
+                                *outError = id == 0 ? "Unknown ability '" + name + "' in hero '" + key + "'"
+                                                    : "Hero '" + key + "' has more than 4 abilities";
+                            }
+                            clear();
+                            return false;
+                        }
+                        def.abilities[slot++] = id;
+                    }
+                }
+
+                heroIndex_[key] = heroes_.size();
+                heroes_.push_back(std::move(def));
+            }
+        }
+
+        if (root.contains("hero_aliases")) {
+            for (const auto& [alias, target] : root["hero_aliases"].items()) {
+                const String heroName = target.get<String>();
+                auto it = heroIndex_.find(heroName);
+                if (it == heroIndex_.end()) {
+                    if (outError) *outError = "Alias '" + alias + "' names unknown hero '" + heroName + "'";
+                    clear();
+                    return false;
+                }
+                heroIndex_[alias] = it->second;
+            }
+        }
+
+        if (root.contains("fallback_hero")) {
+            auto it = heroIndex_.find(root["fallback_hero"].get<String>());
+            if (it == heroIndex_.end()) {
+                if (outError) *outError = "Unknown fallback hero";
+                clear();
+                return false;
+            }
+            fallbackHero_ = it->second;
+        }
+    } catch (const std::exception& e) {
+        if (outError) *outError = e.what();
+        clear();
+        return false;
+    }
+
+    return true;
+}
+
+const GameDataRegistry& GameDataRegistry::shared() {
+    static const GameDataRegistry registry = [] {
+        GameDataRegistry loaded;
+        const std::filesystem::path path = resolveDataPath();
+        String error;
+        if (loaded.loadFromFile(path.u8string(), &error)) {
+            LOG_INFO("Loaded game data from '{}': {} abilities, {} items, {} heroes",
+                     path.u8string(), loaded.getAbilityCount(), loaded.getItemCount(), loaded.getHeroCount());
+        } else {
+            LOG_ERROR("Failed to load game data '{}': {}", path.u8string(), error);
+        }
+        return loaded;
+    }();
+    return registry;
+}
+
+const AbilityData* GameDataRegistry::getAbility(u16 id) const {
+    return (id > 0 && id < abilities_.size()) ? &abilities_[id] : nullptr;
+}
+
+const ItemData* GameDataRegistry::getItem(u16 id) const {
+    return (id > 0 && id < items_.size()) ? &items_[id] : nullptr;
+}
+
+u16 GameDataRegistry::findAbility(const String& key) const {
+    auto it = abilityIds_.find(key);
+    return it != abilityIds_.end() ? it->second : 0;
+}
+
+u16 GameDataRegistry::findItem(const String& key) const {
+    auto it = itemIds_.find(key);
+    return it != itemIds_.end() ? it->second : 0;
+}
+
+const HeroDefinition* GameDataRegistry::findHero(const String& nameOrAlias) const {
+    if (heroes_.empty()) {
+        return nullptr;
+    }
+    auto it = heroIndex_.find(nameOrAlias);
+    return &heroes_[it != heroIndex_.end() ? it->second : fallbackHero_];
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "HeroSystem.h"
+#include "core/Types.h"
+#include <unordered_map>
+
+namespace WorldEditor {
+
+// Hero template: base stats and the four ability slots (Q, W, E, R)
+struct HeroDefinition {
+    String name;
+    HeroAttribute primaryAttribute = HeroAttribute::Strength;
+    f32 baseStrength = 20.0f;
+    f32 baseAgility = 20.0f;
+    f32 baseIntelligence = 20.0f;
+    f32 strengthGain = 2.5f;
+    f32 agilityGain = 2.0f;
+    f32 intelligenceGain = 1.5f;
+    f32 attackRange = 5.0f;
+    f32 moveSpeed = 0.0f;           // 0 = keep the HeroSystem default
+    u16 abilities[4] = {};          // Ability ids, 0 = empty slot
+};
+
+// Ability, item and hero tables loaded once from resources/data/game_data.json.
+// Entries are addressed by u16 id (index into the table, 0 is reserved for "none");
+// string keys are only used while loading and by setup code. Effects, visuals and
+// colors are resolved to enums at load time, so casts and item uses never look at names.
+class GameDataRegistry {
+public:
+    GameDataRegistry();
+
+    // Replaces all tables. On failure the registry is left empty.
+    bool loadFromFile(const String& path, String* outError = nullptr);
+    bool loadFromString(const String& text, String* outError = nullptr);
+    void clear();
+
+    // Process-wide tables, loaded on first use (searches upward from the working
+    // directory for resources/data/game_data.json, like the UI style sheets)
+    static const GameDataRegistry& shared();
+
+    // Lookups by id return nullptr for 0 / out of range ids
+    const AbilityData* getAbility(u16 id) const;
+    const ItemData* getItem(u16 id) const;
+    u16 findAbility(const String& key) const;
+    u16 findItem(const String& key) const;
+
+    // Hero by name or alias ("Axe" -> Warrior); unknown names get the fallback hero
+    const HeroDefinition* findHero(const String& nameOrAlias) const;
+
+    size_t getAbilityCount() const { return abilities_.size() - 1; }
+    size_t getItemCount() const { return items_.size() - 1; }
+    size_t getHeroCount() const { return heroes_.size(); }
+
+private:
+    Vector<AbilityData> abilities_;     // [0] is the empty entry
+    Vector<ItemData> items_;            // [0] is the empty entry
+    Vector<HeroDefinition> heroes_;
+    std::unordered_map<String, u16> abilityIds_;
+    std::unordered_map<String, u16> itemIds_;
+    std::unordered_map<String, size_t> heroIndex_;  // Names and aliases
+    size_t fallbackHero_ = 0;
+};
+
+} // namespace WorldEditor
@@ -1,4 +1,6 @@
 #include "HeroSystem.h"
+#include "CombatEvents.h"
+#include "GameData.h"
 #include "World.h"
 #include "MeshGenerators.h"
 #include "ParticleSystem.h"
@@ -8,12 +10,32 @@
 namespace WorldEditor {
 
 HeroSystem::HeroSystem(EntityManager& entityManager) 
-    : entityManager_(entityManager) {
+    : entityManager_(entityManager)
+    , gameData_(&GameDataRegistry::shared()) {
+}
+
+void HeroSystem::declareAccess(SystemAccess& access) const {
+    // Spawns projectiles/effects and respawns heroes; may rebuild the nav grid
+    access.changesStructure()
+          .read<ObjectComponent, CreepComponent, HealthComponent, TerrainComponent, CollisionComponent>()
+          .write<HeroComponent, TransformComponent>();
 }
 
 void HeroSystem::update(f32 deltaTime) {
     auto& registry = entityManager_.getRegistry();
     
+    // Paths searched this tick replace the straight-line placeholders
+    pathfinder_.update(entityManager_.getNavGrid(), pathResults_);
+    for (auto& result : pathResults_) {
+        auto* hero = registry.valid(result.agent) ? registry.try_get<HeroComponent>(result.agent) : nullptr;
+        if (!hero || hero->state == HeroState::Dead || hero->movePath.empty() || hero->movePath.back() != result.goal) {
+            continue;
+        }
+        hero->movePath = std::move(result.waypoints);
+        hero->currentPathIndex = 0;
+    }
+    pathResults_.clear();
+    
     auto view = registry.view<HeroComponent, TransformComponent>();
     for (auto entity : view) {
         auto& hero = view.get<HeroComponent>(entity);
@@ -28,6 +50,11 @@ void HeroSystem::update(f32 deltaTime) {
         // Update buffs/debuffs
         updateBuffs(entity, hero, deltaTime);
         
+        // Experience from kills resolved since the last update
+        while (hero.experience >= hero.experienceToNextLevel && hero.level < kMaxHeroLevel) {
+            levelUp(entity);
+        }
+        
         // Handle respawn
         if (hero.state == HeroState::Dead) {
             handleRespawn(entity, hero, deltaTime);
@@ -35,16 +62,8 @@ void HeroSystem::update(f32 deltaTime) {
         }
         
         // Regeneration (affected by buffs)
-        f32 hpRegen = hero.healthRegen;
-        f32 mpRegen = hero.manaRegen;
-        
-        for (const auto& buff : hero.buffs) {
-            if (buff.type == BuffType::Regeneration) {
-                hpRegen += buff.value;
-            } else if (buff.type == BuffType::ManaRegen) {
-                mpRegen += buff.value;
-            }
-        }
+        f32 hpRegen = hero.healthRegen + hero.modifiers.getTotals().healthRegen;
+        f32 mpRegen = hero.manaRegen + hero.modifiers.getTotals().manaRegen;
         
         hero.currentHealth = std::min(hero.maxHealth, hero.currentHealth + hpRegen * deltaTime);
         hero.currentMana = std::min(hero.maxMana, hero.currentMana + mpRegen * deltaTime);
@@ -372,6 +391,7 @@ void HeroSystem::updateHeroMovement(Entity entity, HeroComponent& hero, Transfor
     
     if (hero.movePath.empty() || hero.currentPathIndex >= static_cast<i32>(hero.movePath.size())) {
         hero.state = HeroState::Idle;
+        hero.hasMoveOrder = false;
         return;
     }
     
@@ -384,8 +404,10 @@ void HeroSystem::updateHeroMovement(Entity entity, HeroComponent& hero, Transfor
         // Reached waypoint
         hero.currentPathIndex++;
         if (hero.currentPathIndex >= static_cast<i32>(hero.movePath.size())) {
+            // Arrived: the same goal clicked again is a new order
             hero.state = HeroState::Idle;
             hero.movePath.clear();
+            hero.hasMoveOrder = false;
         }
         return;
     }
@@ -520,22 +542,14 @@ void HeroSystem::recalculateStats(HeroComponent& hero) {
         bonusManaRegen += item.data.bonusManaRegen;
     }
     
-    // Add buff bonuses
-    for (const auto& buff : hero.buffs) {
-        if (buff.remainingTime <= 0.0f) continue;
-        
-        switch (buff.type) {
-            case BuffType::Strength_Bonus: bonusStr += buff.value; break;
-            case BuffType::Agility_Bonus: bonusAgi += buff.value; break;
-            case BuffType::Intelligence_Bonus: bonusInt += buff.value; break;
-            case BuffType::DamageBonus: bonusDmg += buff.value; break;
-            case BuffType::ArmorBonus: bonusArmor += buff.value; break;
-            case BuffType::ArmorReduction: bonusArmor -= buff.value; break;
-            case BuffType::AttackSpeedBonus: bonusAS += buff.value; break;
-            case BuffType::AttackSpeedSlow: bonusAS -= buff.value; break;
-            default: break;
-        }
-    }
+    // Add buff bonuses (summed by the modifier set whenever it changes)
+    const ModifierTotals& buffs = hero.modifiers.getTotals();
+    bonusStr += buffs.strength;
+    bonusAgi += buffs.agility;
+    bonusInt += buffs.intelligence;
+    bonusDmg += buffs.damage;
+    bonusArmor += buffs.armor;
+    bonusAS += buffs.attackSpeed;
     
     hero.strength += bonusStr;
     hero.agility += bonusAgi;
@@ -582,42 +596,18 @@ void HeroSystem::recalculateStats(HeroComponent& hero) {
     }
 }
 
+// Buff bonuses are already folded into the stats by recalculateStats()
 f32 HeroSystem::calculateDamage(const HeroComponent& hero) const {
-    f32 damage = hero.damage;
-    
-    // Add damage buffs
-    for (const auto& buff : hero.buffs) {
-        if (buff.type == BuffType::DamageBonus && buff.remainingTime > 0.0f) {
-            damage += buff.value;
-        }
-    }
-    
-    return damage;
+    return hero.damage;
 }
 
-f32 HeroSystem::calculateArmor(const HeroComponent& hero) const {
-    f32 armor = hero.armor;
-    
-    for (const auto& buff : hero.buffs) {
-        if (buff.remainingTime <= 0.0f) continue;
-        if (buff.type == BuffType::ArmorBonus) armor += buff.value;
-        if (buff.type == BuffType::ArmorReduction) armor -= buff.value;
-    }
-    
-    return armor;
+f32 HeroSystem::calculateArmor(const HeroComponent& hero) {
+    return hero.armor;
 }
 
 f32 HeroSystem::calculateAttackSpeed(const HeroComponent& hero) const {
-    f32 attackSpeed = hero.attackSpeed;
-    
-    for (const auto& buff : hero.buffs) {
-        if (buff.remainingTime <= 0.0f) continue;
-        if (buff.type == BuffType::AttackSpeedBonus) attackSpeed += buff.value;
-        if (buff.type == BuffType::AttackSpeedSlow) attackSpeed -= buff.value;
-    }
-    
     // Clamp attack speed (20 min, 700 max like Dota)
-    return std::clamp(attackSpeed, 20.0f, 700.0f);
+    return std::clamp(hero.attackSpeed, 20.0f, 700.0f);
 }
 
 f32 HeroSystem::calculateMoveSpeed(const HeroComponent& hero) const {
@@ -631,25 +621,12 @@ f32 HeroSystem::calculateMoveSpeed(const HeroComponent& hero) const {
         }
     }
     
-    // Apply buff modifiers
-    f32 slowPercent = 0.0f;
-    f32 hasteBonus = 0.0f;
+    // Apply haste (flat bonus, strongest only)
+    const ModifierTotals& buffs = hero.modifiers.getTotals();
+    moveSpeed += buffs.haste;
     
-    for (const auto& buff : hero.buffs) {
-        if (buff.remainingTime <= 0.0f) continue;
-        
-        if (buff.type == BuffType::Haste) {
-            hasteBonus = std::max(hasteBonus, buff.value);
-        } else if (buff.type == BuffType::Slow) {
-            slowPercent = std::max(slowPercent, buff.value);
-        }
-    }
-    
-    // Apply haste (flat bonus)
-    moveSpeed += hasteBonus;
-    
-    // Apply slow (percentage reduction)
-    moveSpeed *= (1.0f - slowPercent / 100.0f);
+    // Apply slow (percentage reduction, strongest only)
+    moveSpeed *= (1.0f - buffs.slowPercent / 100.0f);
     
     // Clamp move speed (100 min, 550 max like Dota)
     return std::clamp(moveSpeed, 100.0f, 550.0f);
@@ -674,39 +651,10 @@ Entity HeroSystem::createHero(const String& heroName, i32 teamId, const Vec3& po
     heroComp.currentHealth = heroComp.maxHealth;
     heroComp.currentMana = heroComp.maxMana;
     
-    // Setup default abilities (placeholder) - hotkeys: 1, 2, 3, F
-    heroComp.abilities[0].data.name = "Fireball";
-    heroComp.abilities[0].data.hotkey = '1';
-    heroComp.abilities[0].data.manaCost = 100.0f;
-    heroComp.abilities[0].data.cooldown = 10.0f;
-    heroComp.abilities[0].data.damage = 150.0f;
-    heroComp.abilities[0].data.castRange = 600.0f;  // Range for targeting (Dota scale)
-    heroComp.abilities[0].data.targetType = AbilityTargetType::UnitTarget;
-    heroComp.abilities[0].level = 1;  // Start with ability learned
-    
-    heroComp.abilities[1].data.name = "Ice Storm";
-    heroComp.abilities[1].data.hotkey = '2';
-    heroComp.abilities[1].data.manaCost = 80.0f;
-    heroComp.abilities[1].data.cooldown = 12.0f;
-    heroComp.abilities[1].data.damage = 100.0f;
-    heroComp.abilities[1].data.radius = 300.0f;    // AoE radius (Dota scale)
-    heroComp.abilities[1].data.castRange = 700.0f; // Range for targeting
-    heroComp.abilities[1].data.targetType = AbilityTargetType::PointTarget;
-    heroComp.abilities[1].level = 1;  // Start with ability learned
-    
-    heroComp.abilities[2].data.name = "Passive Aura";
-    heroComp.abilities[2].data.hotkey = '3';
-    heroComp.abilities[2].data.targetType = AbilityTargetType::Passive;
-    heroComp.abilities[2].level = 1;  // Start with ability learned
-    
-    heroComp.abilities[3].data.name = "Lightning Ultimate";
-    heroComp.abilities[3].data.hotkey = 'F';
-    heroComp.abilities[3].data.manaCost = 200.0f;
-    heroComp.abilities[3].data.cooldown = 60.0f;
-    heroComp.abilities[3].data.damage = 500.0f;
-    heroComp.abilities[3].data.castRange = 800.0f; // Range for targeting
-    heroComp.abilities[3].data.targetType = AbilityTargetType::UnitTarget;
-    heroComp.abilities[3].level = 1;  // Start with ability learned
+    // Ability kits come from the hero definition (createHeroByType); Q, W, E, R start learned
+    for (i32 i = 0; i < 4; ++i) {
+        heroComp.abilities[i].level = 1;
+    }
     
     // Create hero mesh (humanoid shape) - sized for 16000x16000 map
     // Hero: ~50 units radius, ~120 units height (visible but not huge)
@@ -756,9 +704,7 @@ void HeroSystem::issueCommand(Entity hero, const HeroCommand& command) {
             
         case HeroCommand::Type::AttackMove:
             // Move to position, attack enemies on the way
-            heroComp.movePath.clear();
-            heroComp.movePath.push_back(command.targetPosition);
-            heroComp.currentPathIndex = 0;
+            setMovePath(hero, heroComp, command.targetPosition, true);
             heroComp.state = HeroState::Moving;
             // TODO: Implement attack-move logic
             break;
@@ -797,15 +743,26 @@ void HeroSystem::moveToPosition(Entity hero, const Vec3& position) {
         return;
     }
     
-    // Simple direct path for now
-    // TODO: Implement proper pathfinding
-    heroComp.movePath.clear();
-    heroComp.movePath.push_back(position);
-    heroComp.currentPathIndex = 0;
+    setMovePath(hero, heroComp, position);
     heroComp.targetEntity = INVALID_ENTITY;
     heroComp.state = HeroState::Moving;
 }
 
+void HeroSystem::setMovePath(Entity hero, HeroComponent& heroComp, const Vec3& goal, bool attackMove) {
+    const Vec3 start = entityManager_.hasComponent<TransformComponent>(hero)
+        ? entityManager_.getComponent<TransformComponent>(hero).position
+        : goal;
+    
+    // While a queued search runs the hero heads straight for the goal
+    if (!pathfinder_.request(entityManager_.getNavGrid(), hero, start, goal, heroComp.movePath)) {
+        heroComp.movePath.assign(1, goal);
+    }
+    heroComp.currentPathIndex = 0;
+    heroComp.moveOrderGoal = goal;
+    heroComp.moveOrderAttackMove = attackMove;
+    heroComp.hasMoveOrder = true;
+}
+
 void HeroSystem::attackTarget(Entity hero, Entity target) {
     if (!entityManager_.hasComponent<HeroComponent>(hero)) {
         return;
@@ -820,6 +777,7 @@ void HeroSystem::attackTarget(Entity hero, Entity target) {
     
     heroComp.targetEntity = target;
     heroComp.movePath.clear();
+    heroComp.hasMoveOrder = false;
     heroComp.state = HeroState::Attacking;
 }
 
@@ -839,6 +797,7 @@ void HeroSystem::castAbility(Entity hero, i32 abilityIndex, const Vec3& targetPo
     heroComp.castTimer = ability.data.castPoint;
     heroComp.targetPosition = targetPos;
     heroComp.targetEntity = targetEntity;
+    heroComp.hasMoveOrder = false;
     heroComp.state = HeroState::CastingAbility;
 }
 
@@ -848,7 +807,9 @@ void HeroSystem::stopHero(Entity hero) {
     }
     
     auto& heroComp = entityManager_.getComponent<HeroComponent>(hero);
+    pathfinder_.cancel(hero);
     heroComp.movePath.clear();
+    heroComp.hasMoveOrder = false;
     heroComp.targetEntity = INVALID_ENTITY;
     heroComp.currentCastingAbility = -1;
     heroComp.state = HeroState::Idle;
@@ -938,7 +899,7 @@ void HeroSystem::giveExperience(Entity hero, f32 amount) {
     
     heroComp.experience += amount;
     
-    while (heroComp.experience >= heroComp.experienceToNextLevel && heroComp.level < 30) {
+    while (heroComp.experience >= heroComp.experienceToNextLevel && heroComp.level < kMaxHeroLevel) {
         levelUp(hero);
     }
 }
@@ -966,152 +927,48 @@ void HeroSystem::levelUp(Entity hero) {
 }
 
 Entity HeroSystem::findAttackTarget(const Vec3& position, i32 teamId, f32 range) {
-    Entity nearest = INVALID_ENTITY;
-    f32 nearestDist = range;
-    
     auto& registry = entityManager_.getRegistry();
+    const auto& grid = entityManager_.getSpatialGrid();
     
-    // Check enemy heroes
-    auto heroView = registry.view<HeroComponent, TransformComponent>();
-    for (auto entity : heroView) {
-        const auto& hero = heroView.get<HeroComponent>(entity);
-        const auto& transform = heroView.get<TransformComponent>(entity);
-        
-        if (hero.teamId == teamId || hero.state == HeroState::Dead) {
-            continue;
-        }
-        
-        f32 dist = glm::length(transform.position - position);
-        if (dist < nearestDist) {
-            nearest = entity;
-            nearestDist = dist;
-        }
-    }
-    
-    // Check enemy creeps
-    auto creepView = registry.view<CreepComponent, TransformComponent>();
-    for (auto entity : creepView) {
-        const auto& creep = creepView.get<CreepComponent>(entity);
-        const auto& transform = creepView.get<TransformComponent>(entity);
-        
-        if (creep.teamId == teamId || creep.state == CreepState::Dead) {
-            continue;
-        }
-        
-        f32 dist = glm::length(transform.position - position);
-        if (dist < nearestDist) {
-            nearest = entity;
-            nearestDist = dist;
-        }
-    }
-    
-    return nearest;
+    // Nearest enemy hero or creep that is still alive
+    return grid.findNearest(position, range, SpatialFilter::enemiesOf(teamId, SpatialType::Hero | SpatialType::Creep),
+        [&](Entity entity) {
+            if (const auto* hero = registry.try_get<HeroComponent>(entity)) {
+                return hero->state != HeroState::Dead;
+            }
+            if (const auto* creep = registry.try_get<CreepComponent>(entity)) {
+                return creep->state != CreepState::Dead;
+            }
+            return false;
+        });
 }
 
 void HeroSystem::dealDamage(Entity attacker, Entity target, f32 damage, bool isMagical) {
-    // Check invulnerability
-    if (entityManager_.hasComponent<HeroComponent>(target)) {
-        auto& targetHero = entityManager_.getComponent<HeroComponent>(target);
-        if (targetHero.isInvulnerable()) {
-            return;
-        }
-    }
-    
-    // Deal damage to hero
-    if (entityManager_.hasComponent<HeroComponent>(target)) {
-        auto& targetHero = entityManager_.getComponent<HeroComponent>(target);
-        
-        f32 actualDamage = damage;
-        
-        if (!isMagical) {
-            // Physical damage - apply armor reduction
-            f32 armor = calculateArmor(targetHero);
-            f32 armorReduction = 1.0f - (0.06f * armor) / (1.0f + 0.06f * std::abs(armor));
-            actualDamage = damage * armorReduction;
-        } else {
-            // Magical damage - 25% base magic resistance
-            actualDamage = damage * 0.75f;
-        }
-        
-        targetHero.currentHealth -= actualDamage;
-        
-        if (targetHero.currentHealth <= 0.0f) {
-            targetHero.currentHealth = 0.0f;
-            targetHero.state = HeroState::Dead;
-            targetHero.deaths++;
-            targetHero.respawnTimer = calculateRespawnTime(targetHero.level);
-            
-            // Clear movement and targeting
-            targetHero.movePath.clear();
-            targetHero.targetEntity = INVALID_ENTITY;
-            targetHero.currentCastingAbility = -1;
-            
-            // Hide mesh when dead
-            if (entityManager_.hasComponent<MeshComponent>(target)) {
-                auto& mesh = entityManager_.getComponent<MeshComponent>(target);
-                mesh.visible = false;
-            }
-            
-            // Give kill credit
-            if (entityManager_.hasComponent<HeroComponent>(attacker)) {
-                auto& attackerHero = entityManager_.getComponent<HeroComponent>(attacker);
-                attackerHero.kills++;
-                giveExperience(attacker, 100.0f + targetHero.level * 20.0f);
-                giveGold(attacker, 200 + targetHero.level * 10);
-            }
-        }
-    }
-    
-    // Deal damage to creep
-    if (entityManager_.hasComponent<CreepComponent>(target)) {
-        auto& targetCreep = entityManager_.getComponent<CreepComponent>(target);
-        targetCreep.currentHealth -= damage;
-        
-        if (targetCreep.currentHealth <= 0.0f) {
-            targetCreep.currentHealth = 0.0f;
-            targetCreep.state = CreepState::Dead;
-            targetCreep.deathTime = 0.0f;
-            
-            // Give experience and gold to killer
-            if (entityManager_.hasComponent<HeroComponent>(attacker)) {
-                auto& attackerHero = entityManager_.getComponent<HeroComponent>(attacker);
-                attackerHero.lastHits++;
-                giveExperience(attacker, 40.0f);
-                giveGold(attacker, 40);
-            }
-        }
-    }
+    // Armor, invulnerability, death and kill credit are resolved at the next sync point
+    entityManager_.getCombatEvents().damage(attacker, target, damage,
+                                            isMagical ? DamageType::Magical : DamageType::Physical);
 }
 
 void HeroSystem::dealAreaDamage(Entity attacker, const Vec3& center, f32 radius, f32 damage, i32 teamId, bool isMagical) {
     auto& registry = entityManager_.getRegistry();
+    const auto& grid = entityManager_.getSpatialGrid();
     
-    // Damage enemy creeps in area
-    auto creepView = registry.view<CreepComponent, TransformComponent>();
-    for (auto entity : creepView) {
-        auto& creep = creepView.get<CreepComponent>(entity);
-        auto& transform = creepView.get<TransformComponent>(entity);
-        
-        if (creep.teamId == teamId || creep.state == CreepState::Dead) continue;
-        
-        f32 dist = glm::length(transform.position - center);
-        if (dist <= radius) {
-            dealDamage(attacker, entity, damage, isMagical);
-        }
-    }
+    // Damage is deferred, so every target alive at cast time gets hit
+    Vector<SpatialHit> targets;
+    grid.queryRadius(center, radius, SpatialFilter::enemiesOf(teamId, SpatialType::Creep | SpatialType::Hero), targets);
     
-    // Damage enemy heroes in area
-    auto heroView = registry.view<HeroComponent, TransformComponent>();
-    for (auto entity : heroView) {
-        auto& hero = heroView.get<HeroComponent>(entity);
-        auto& transform = heroView.get<TransformComponent>(entity);
-        
-        if (hero.teamId == teamId || hero.state == HeroState::Dead) continue;
+    for (const auto& hit : targets) {
+        if (!registry.valid(hit.entity)) continue;
         
-        f32 dist = glm::length(transform.position - center);
-        if (dist <= radius) {
-            dealDamage(attacker, entity, damage, isMagical);
+        if (const auto* creep = registry.try_get<CreepComponent>(hit.entity)) {
+            if (creep->state == CreepState::Dead) continue;
+        } else if (const auto* hero = registry.try_get<HeroComponent>(hit.entity)) {
+            if (hero->state == HeroState::Dead) continue;
+        } else {
+            continue;
         }
+        
+        dealDamage(attacker, hit.entity, damage, isMagical);
     }
 }
 
@@ -1126,21 +983,7 @@ void HeroSystem::executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i3
         particleSys = dynamic_cast<ParticleSystem*>(world_->getSystem("ParticleSystem"));
     }
     
-    // Determine effect color based on ability damage type
-    Vec4 effectColor = Vec4(0.4f, 0.6f, 1.0f, 1.0f);  // Default blue magic
-    if (ability.data.name.find("Fire") != String::npos || ability.data.name.find("Flame") != String::npos) {
-        effectColor = Vec4(1.0f, 0.5f, 0.1f, 1.0f);  // Orange fire
-    } else if (ability.data.name.find("Ice") != String::npos || ability.data.name.find("Frost") != String::npos) {
-        effectColor = Vec4(0.6f, 0.9f, 1.0f, 1.0f);  // Ice blue
-    } else if (ability.data.name.find("Poison") != String::npos || ability.data.name.find("Venom") != String::npos) {
-        effectColor = Vec4(0.3f, 0.8f, 0.2f, 1.0f);  // Toxic green
-    } else if (ability.data.name.find("Lightning") != String::npos || ability.data.name.find("Storm") != String::npos) {
-        effectColor = Vec4(0.7f, 0.8f, 1.0f, 1.0f);  // Electric blue
-    } else if (ability.data.name.find("Shadow") != String::npos || ability.data.name.find("Dark") != String::npos) {
-        effectColor = Vec4(0.4f, 0.2f, 0.6f, 1.0f);  // Purple dark
-    } else if (ability.data.name.find("Holy") != String::npos || ability.data.name.find("Light") != String::npos) {
-        effectColor = Vec4(1.0f, 0.95f, 0.7f, 1.0f);  // Golden light
-    }
+    const Vec4 effectColor = ability.data.color;
     
     // Use player-selected target if available, otherwise find nearest enemy
     Entity selectedTarget = hero.targetEntity;
@@ -1188,9 +1031,9 @@ void HeroSystem::executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i3
         particleSys->spawnCastEffect(transform.position + Vec3(0, 2, 0), effectColor);
     }
     
-    // Execute ability based on type
-    switch (ability.data.targetType) {
-        case AbilityTargetType::UnitTarget:
+    // Execute ability based on its resolved effect
+    switch (ability.data.effect) {
+        case AbilityEffect::TargetNuke:
             // Damage selected/nearest enemy
             if (selectedTarget != INVALID_ENTITY && entityManager_.hasComponent<TransformComponent>(selectedTarget)) {
                 Vec3 targetPos = entityManager_.getComponent<TransformComponent>(selectedTarget).position;
@@ -1208,19 +1051,27 @@ void HeroSystem::executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i3
                 
                 // Spawn hit effect on target based on damage type
                 if (particleSys && entityManager_.hasComponent<TransformComponent>(selectedTarget)) {
-                    if (ability.data.name.find("Lightning") != String::npos) {
-                        particleSys->spawnLightningEffect(
-                            transform.position + Vec3(0, 5, 0),
-                            targetPos + Vec3(0, 1, 0)
-                        );
-                    } else if (ability.data.name.find("Ice") != String::npos) {
-                        particleSys->spawnIceEffect(targetPos + Vec3(0, 1, 0));
-                    } else if (ability.data.name.find("Fire") != String::npos) {
-                        particleSys->spawnFireEffect(targetPos + Vec3(0, 0.5f, 0));
-                    } else if (ability.data.name.find("Poison") != String::npos) {
-                        particleSys->spawnPoisonEffect(targetPos + Vec3(0, 1, 0));
-                    } else {
-                        particleSys->spawnAttackEffect(targetPos + Vec3(0, 1.5f, 0), Vec3(0, 1, 0));
+                    switch (ability.data.hitVisual) {
+                        case AbilityVisual::Lightning:
+                            particleSys->spawnLightningEffect(
+                                transform.position + Vec3(0, 5, 0),
+                                targetPos + Vec3(0, 1, 0)
+                            );
+                            break;
+                        case AbilityVisual::Ice:
+                            particleSys->spawnIceEffect(targetPos + Vec3(0, 1, 0));
+                            break;
+                        case AbilityVisual::Fire:
+                            particleSys->spawnFireEffect(targetPos + Vec3(0, 0.5f, 0));
+                            break;
+                        case AbilityVisual::Poison:
+                            particleSys->spawnPoisonEffect(targetPos + Vec3(0, 1, 0));
+                            break;
+                        case AbilityVisual::None:
+                            break;
+                        default:
+                            particleSys->spawnAttackEffect(targetPos + Vec3(0, 1.5f, 0), Vec3(0, 1, 0));
+                            break;
                     }
                 }
                 
@@ -1229,7 +1080,7 @@ void HeroSystem::executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i3
                     auto& targetHero = entityManager_.getComponent<HeroComponent>(selectedTarget);
                     Buff stunBuff;
                     stunBuff.type = BuffType::Stun;
-                    stunBuff.name = ability.data.name;
+                    stunBuff.sourceAbility = static_cast<i8>(abilityIndex);
                     stunBuff.duration = ability.data.duration;
                     stunBuff.source = heroEntity;
                     applyBuff(selectedTarget, stunBuff);
@@ -1242,7 +1093,7 @@ void HeroSystem::executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i3
             }
             break;
             
-        case AbilityTargetType::PointTarget:
+        case AbilityEffect::AreaNuke:
             // AoE damage at target position or around hero
             if (radius > 0.0f) {
                 Vec3 targetPos = hero.targetPosition;
@@ -1259,73 +1110,80 @@ void HeroSystem::executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i3
                 
                 // Spawn explosion effect with type-specific visuals
                 if (particleSys) {
-                    if (ability.data.name.find("Fire") != String::npos || ability.data.name.find("Flame") != String::npos) {
-                        particleSys->spawnFireEffect(targetPos + Vec3(0, 0.5f, 0));
-                        particleSys->spawnExplosion(targetPos + Vec3(0, 0.5f, 0), radius);
-                    } else if (ability.data.name.find("Ice") != String::npos) {
-                        particleSys->spawnIceEffect(targetPos + Vec3(0, 0.5f, 0));
-                    } else if (ability.data.name.find("Lightning") != String::npos) {
-                        // Multiple lightning strikes in area
-                        for (i32 i = 0; i < 3; i++) {
-                            Vec3 strikePos = targetPos + Vec3(
-                                (rand() % 100 - 50) / 50.0f * radius,
-                                0,
-                                (rand() % 100 - 50) / 50.0f * radius
-                            );
-                            particleSys->spawnLightningEffect(strikePos + Vec3(0, 8, 0), strikePos);
-                        }
-                    } else {
-                        particleSys->spawnExplosion(targetPos + Vec3(0, 0.5f, 0), radius);
+                    switch (ability.data.areaVisual) {
+                        case AbilityVisual::FireExplosion:
+                            particleSys->spawnFireEffect(targetPos + Vec3(0, 0.5f, 0));
+                            particleSys->spawnExplosion(targetPos + Vec3(0, 0.5f, 0), radius);
+                            break;
+                        case AbilityVisual::Ice:
+                            particleSys->spawnIceEffect(targetPos + Vec3(0, 0.5f, 0));
+                            break;
+                        case AbilityVisual::LightningStrikes:
+                            // Multiple lightning strikes in area
+                            for (i32 i = 0; i < 3; i++) {
+                                Vec3 strikePos = targetPos + Vec3(
+                                    (rand() % 100 - 50) / 50.0f * radius,
+                                    0,
+                                    (rand() % 100 - 50) / 50.0f * radius
+                                );
+                                particleSys->spawnLightningEffect(strikePos + Vec3(0, 8, 0), strikePos);
+                            }
+                            break;
+                        case AbilityVisual::None:
+                            break;
+                        default:
+                            particleSys->spawnExplosion(targetPos + Vec3(0, 0.5f, 0), radius);
+                            break;
                     }
                 }
             }
             break;
             
-        case AbilityTargetType::NoTarget:
-            // Self-buff or instant effect
-            if (ability.data.duration > 0.0f) {
-                // Apply buff to self (like Berserker Rage)
-                Buff selfBuff;
-                selfBuff.type = BuffType::DamageBonus;
-                selfBuff.name = ability.data.name;
-                selfBuff.value = damage * 0.5f; // Bonus damage
-                selfBuff.duration = ability.data.duration;
-                selfBuff.source = heroEntity;
-                applyBuff(heroEntity, selfBuff);
-                
-                // Buff effect on self - shield or aura based on ability
-                if (particleSys) {
-                    if (ability.data.name.find("Shield") != String::npos || ability.data.name.find("Barrier") != String::npos) {
-                        particleSys->spawnShieldEffect(heroEntity);
-                    } else {
-                        particleSys->spawnAuraEffect(heroEntity, effectColor);
-                        particleSys->createEffect(ParticleEffectType::Buff, transform.position + Vec3(0, 1, 0), ability.data.duration);
-                    }
-                }
-                
-                // Also add attack speed buff
-                Buff asBuff;
-                asBuff.type = BuffType::AttackSpeedBonus;
-                asBuff.name = ability.data.name;
-                asBuff.value = 100.0f; // +100 attack speed
-                asBuff.duration = ability.data.duration;
-                asBuff.source = heroEntity;
-                applyBuff(heroEntity, asBuff);
-            } else {
-                // Instant AoE around hero
-                if (particleSys) {
-                    particleSys->spawnAoEIndicator(transform.position, ability.data.castRange, effectColor);
-                }
-                dealAreaDamage(heroEntity, transform.position, ability.data.castRange, damage, hero.teamId, true);
-                
-                // Explosion around hero
-                if (particleSys) {
-                    particleSys->spawnExplosion(transform.position + Vec3(0, 1, 0), ability.data.castRange);
+        case AbilityEffect::SelfBuff: {
+            // Apply buff to self (like Berserker Rage)
+            Buff selfBuff;
+            selfBuff.type = BuffType::DamageBonus;
+            selfBuff.sourceAbility = static_cast<i8>(abilityIndex);
+            selfBuff.value = damage * 0.5f; // Bonus damage
+            selfBuff.duration = ability.data.duration;
+            selfBuff.source = heroEntity;
+            applyBuff(heroEntity, selfBuff);
+            
+            // Buff effect on self - shield or aura based on ability
+            if (particleSys && ability.data.buffVisual != AbilityVisual::None) {
+                if (ability.data.buffVisual == AbilityVisual::Shield) {
+                    particleSys->spawnShieldEffect(heroEntity);
+                } else {
+                    particleSys->spawnAuraEffect(heroEntity, effectColor);
+                    particleSys->createEffect(ParticleEffectType::Buff, transform.position + Vec3(0, 1, 0), ability.data.duration);
                 }
             }
+            
+            // Also add attack speed buff
+            Buff asBuff;
+            asBuff.type = BuffType::AttackSpeedBonus;
+            asBuff.sourceAbility = static_cast<i8>(abilityIndex);
+            asBuff.value = 100.0f; // +100 attack speed
+            asBuff.duration = ability.data.duration;
+            asBuff.source = heroEntity;
+            applyBuff(heroEntity, asBuff);
             break;
+        }
+            
+        case AbilityEffect::Nova:
+            // Instant AoE around hero
+            if (particleSys) {
+                particleSys->spawnAoEIndicator(transform.position, ability.data.castRange, effectColor);
+            }
+            dealAreaDamage(heroEntity, transform.position, ability.data.castRange, damage, hero.teamId, true);
             
-        case AbilityTargetType::Passive:
+            // Explosion around hero
+            if (particleSys) {
+                particleSys->spawnExplosion(transform.position + Vec3(0, 1, 0), ability.data.castRange);
+            }
+            break;
+            
+        case AbilityEffect::Passive:
             // Passive abilities don't have active effects but can show aura
             if (particleSys && ability.level > 0) {
                 particleSys->spawnAuraEffect(heroEntity, Vec4(0.8f, 0.8f, 0.8f, 0.4f));
@@ -1347,6 +1205,7 @@ void HeroSystem::handleRespawn(Entity entity, HeroComponent& hero, f32 deltaTime
         hero.currentMana = hero.maxMana;
         hero.targetEntity = INVALID_ENTITY;
         hero.movePath.clear();
+        hero.hasMoveOrder = false;
         
         // Move to respawn position
         if (entityManager_.hasComponent<TransformComponent>(entity)) {
@@ -1362,7 +1221,7 @@ void HeroSystem::handleRespawn(Entity entity, HeroComponent& hero, f32 deltaTime
     }
 }
 
-f32 HeroSystem::calculateRespawnTime(i32 level) const {
+f32 HeroSystem::calculateRespawnTime(i32 level) {
     // Dota 2 formula: level * 2.5 seconds (simplified)
     return static_cast<f32>(level) * 2.5f;
 }
@@ -1370,45 +1229,12 @@ f32 HeroSystem::calculateRespawnTime(i32 level) const {
 // ============ Buff System ============
 
 void HeroSystem::updateBuffs(Entity entity, HeroComponent& hero, f32 deltaTime) {
-    bool needsRecalc = false;
+    auto& combat = entityManager_.getCombatEvents();
+    const bool expired = hero.modifiers.update(deltaTime, [&](const Buff& buff) {
+        combat.damage(buff.source, entity, buff.value, DamageType::Pure);
+    });
     
-    for (auto it = hero.buffs.begin(); it != hero.buffs.end(); ) {
-        it->remainingTime -= deltaTime;
-        
-        // Handle DoT effects
-        if (it->type == BuffType::DamageOverTime && it->remainingTime > 0.0f) {
-            it->tickTimer -= deltaTime;
-            if (it->tickTimer <= 0.0f) {
-                hero.currentHealth -= it->value;
-                it->tickTimer = it->tickInterval;
-                
-                if (hero.currentHealth <= 0.0f) {
-                    hero.currentHealth = 0.0f;
-                    hero.state = HeroState::Dead;
-                    hero.respawnTimer = calculateRespawnTime(hero.level);
-                    hero.movePath.clear();
-                    hero.targetEntity = INVALID_ENTITY;
-                    hero.currentCastingAbility = -1;
-                    
-                    // Hide mesh
-                    if (entityManager_.hasComponent<MeshComponent>(entity)) {
-                        auto& mesh = entityManager_.getComponent<MeshComponent>(entity);
-                        mesh.visible = false;
-                    }
-                }
-            }
-        }
-        
-        // Remove expired buffs
-        if (it->remainingTime <= 0.0f) {
-            it = hero.buffs.erase(it);
-            needsRecalc = true;
-        } else {
-            ++it;
-        }
-    }
-    
-    if (needsRecalc) {
+    if (expired) {
         recalculateStats(hero);
     }
 }
@@ -1418,25 +1244,11 @@ void HeroSystem::applyBuff(Entity target, const Buff& buff) {
         return;
     }
     
+    // Same type and source refreshes the existing buff
     auto& hero = entityManager_.getComponent<HeroComponent>(target);
-    
-    // Check for existing buff of same type - refresh or stack
-    for (auto& existingBuff : hero.buffs) {
-        if (existingBuff.type == buff.type && existingBuff.source == buff.source) {
-            // Refresh duration
-            existingBuff.remainingTime = buff.duration;
-            existingBuff.value = std::max(existingBuff.value, buff.value);
-            return;
-        }
+    if (hero.modifiers.apply(buff)) {
+        recalculateStats(hero);
     }
-    
-    // Add new buff
-    Buff newBuff = buff;
-    newBuff.remainingTime = buff.duration;
-    newBuff.tickTimer = buff.tickInterval;
-    hero.buffs.push_back(newBuff);
-    
-    recalculateStats(hero);
 }
 
 void HeroSystem::removeBuff(Entity target, BuffType type) {
@@ -1445,14 +1257,9 @@ void HeroSystem::removeBuff(Entity target, BuffType type) {
     }
     
     auto& hero = entityManager_.getComponent<HeroComponent>(target);
-    
-    hero.buffs.erase(
-        std::remove_if(hero.buffs.begin(), hero.buffs.end(),
-            [type](const Buff& b) { return b.type == type; }),
-        hero.buffs.end()
-    );
-    
-    recalculateStats(hero);
+    if (hero.modifiers.remove(type) > 0) {
+        recalculateStats(hero);
+    }
 }
 
 void HeroSystem::purgeBuffs(Entity target, bool purgePositive, bool purgeNegative) {
@@ -1461,18 +1268,9 @@ void HeroSystem::purgeBuffs(Entity target, bool purgePositive, bool purgeNegativ
     }
     
     auto& hero = entityManager_.getComponent<HeroComponent>(target);
-    
-    hero.buffs.erase(
-        std::remove_if(hero.buffs.begin(), hero.buffs.end(),
-            [purgePositive, purgeNegative](const Buff& b) {
-                if (!b.isPurgeable) return false;
-                bool isNegative = static_cast<u8>(b.type) >= 50;
-                return (isNegative && purgeNegative) || (!isNegative && purgePositive);
-            }),
-        hero.buffs.end()
-    );
-    
-    recalculateStats(hero);
+    if (hero.modifiers.purge(purgePositive, purgeNegative) > 0) {
+        recalculateStats(hero);
+    }
 }
 
 // ============ Item System ============
@@ -1526,6 +1324,79 @@ bool HeroSystem::giveItem(Entity hero, const ItemData& itemData) {
     return false; // Inventory full
 }
 
+bool HeroSystem::giveItem(Entity hero, const String& itemKey) {
+    const ItemData* itemData = gameData_->getItem(gameData_->findItem(itemKey));
+    if (!itemData) {
+        LOG_WARN("Unknown item '{}'", itemKey);
+        return false;
+    }
+    return giveItem(hero, *itemData);
+}
+
+bool HeroSystem::useItem(Entity hero, ItemSlot slot, const Vec3& targetPos, Entity targetEntity) {
+    (void)targetEntity; // No unit-targeted item actives yet
+    
+    const i32 slotIndex = static_cast<i32>(slot);
+    if (slotIndex < 0 || slotIndex >= static_cast<i32>(ItemSlot::COUNT) ||
+        !entityManager_.hasComponent<HeroComponent>(hero)) {
+        return false;
+    }
+    
+    auto& heroComp = entityManager_.getComponent<HeroComponent>(hero);
+    Item& item = heroComp.inventory[slotIndex];
+    if (item.data.name.empty() || !item.data.hasActive || !item.isActive || item.currentCooldown > 0.0f) {
+        return false;
+    }
+    if (heroComp.state == HeroState::Dead || heroComp.isStunned() ||
+        heroComp.currentMana < item.data.activeManaCost) {
+        return false;
+    }
+    
+    switch (item.data.activeEffect) {
+        case ItemEffect::HealOverTime:
+        case ItemEffect::ManaOverTime: {
+            if (item.data.activeDuration <= 0.0f) {
+                return false;
+            }
+            Buff buff;
+            buff.type = item.data.activeEffect == ItemEffect::HealOverTime ? BuffType::Regeneration : BuffType::ManaRegen;
+            buff.value = item.data.activeValue / item.data.activeDuration;
+            buff.duration = item.data.activeDuration;
+            buff.source = hero;
+            applyBuff(hero, buff);
+            break;
+        }
+            
+        case ItemEffect::Blink: {
+            if (!entityManager_.hasComponent<TransformComponent>(hero)) {
+                return false;
+            }
+            auto& transform = entityManager_.getComponent<TransformComponent>(hero);
+            Vec3 offset = targetPos - transform.position;
+            offset.y = 0.0f;
+            const f32 distance = glm::length(offset);
+            if (distance > item.data.activeRange && distance > 0.0f) {
+                offset *= item.data.activeRange / distance;
+            }
+            transform.position += offset;
+            heroComp.movePath.clear();
+            break;
+        }
+            
+        default:
+            return false;
+    }
+    
+    heroComp.currentMana -= item.data.activeManaCost;
+    item.currentCooldown = item.data.activeCooldown;
+    
+    if (item.data.isConsumable && --item.charges <= 0) {
+        item = Item();
+        recalculateStats(heroComp);
+    }
+    return true;
+}
+
 void HeroSystem::dropItem(Entity hero, ItemSlot slot) {
     if (!entityManager_.hasComponent<HeroComponent>(hero)) {
         return;
@@ -1556,223 +1427,6 @@ void HeroSystem::swapItems(Entity hero, ItemSlot slot1, ItemSlot slot2) {
     recalculateStats(heroComp);
 }
 
-// ============ Predefined Items ============
-
-ItemData HeroSystem::createItem_IronBranch() {
-    ItemData item;
-    item.name = "Iron Branch";
-    item.description = "+1 to all attributes";
-    item.goldCost = 50;
-    item.bonusStrength = 1.0f;
-    item.bonusAgility = 1.0f;
-    item.bonusIntelligence = 1.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_Tango() {
-    ItemData item;
-    item.name = "Tango";
-    item.description = "Consume to restore HP";
-    item.goldCost = 90;
-    item.isConsumable = true;
-    item.isStackable = true;
-    item.maxStack = 3;
-    item.hasActive = true;
-    item.activeCooldown = 0.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_HealingSalve() {
-    ItemData item;
-    item.name = "Healing Salve";
-    item.description = "Restore 400 HP over 8 seconds";
-    item.goldCost = 110;
-    item.isConsumable = true;
-    item.hasActive = true;
-    item.activeCooldown = 0.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_ClarityPotion() {
-    ItemData item;
-    item.name = "Clarity";
-    item.description = "Restore 150 mana over 25 seconds";
-    item.goldCost = 50;
-    item.isConsumable = true;
-    item.hasActive = true;
-    item.activeCooldown = 0.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_BootsOfSpeed() {
-    ItemData item;
-    item.name = "Boots of Speed";
-    item.description = "+45 Movement Speed";
-    item.goldCost = 500;
-    item.bonusMoveSpeed = 45.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_PowerTreads() {
-    ItemData item;
-    item.name = "Power Treads";
-    item.description = "+45 MS, +25 AS, +10 selected attribute";
-    item.goldCost = 1400;
-    item.bonusMoveSpeed = 45.0f;
-    item.bonusAttackSpeed = 25.0f;
-    item.bonusStrength = 10.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_BladeMail() {
-    ItemData item;
-    item.name = "Blade Mail";
-    item.description = "+28 Damage, +6 Armor";
-    item.goldCost = 2100;
-    item.bonusDamage = 28.0f;
-    item.bonusArmor = 6.0f;
-    item.hasActive = true;
-    item.activeCooldown = 25.0f;
-    return item;
-}
-
-ItemData HeroSystem::createItem_Blink() {
-    ItemData item;
-    item.name = "Blink Dagger";
-    item.description = "Teleport to target point";
-    item.goldCost = 2250;
-    item.hasActive = true;
-    item.activeCooldown = 15.0f;
-    return item;
-}
-
-// ============ Hero Templates ============
-
-void HeroSystem::setupHero_Warrior(HeroComponent& hero) {
-    hero.heroName = "Warrior";
-    hero.primaryAttribute = HeroAttribute::Strength;
-    hero.baseStrength = 25.0f;
-    hero.baseAgility = 15.0f;
-    hero.baseIntelligence = 14.0f;
-    hero.strengthGain = 3.2f;
-    hero.agilityGain = 1.5f;
-    hero.intelligenceGain = 1.3f;
-    hero.attackRange = 5.0f;  // Melee
-    
-    hero.abilities[0].data.name = "Shield Bash";
-    hero.abilities[0].data.description = "Stuns target enemy";
-    hero.abilities[0].data.hotkey = '1';
-    hero.abilities[0].data.manaCost = 90.0f;
-    hero.abilities[0].data.cooldown = 12.0f;
-    hero.abilities[0].data.damage = 100.0f;
-    hero.abilities[0].data.duration = 2.0f;
-    hero.abilities[0].data.castRange = 150.0f;
-    hero.abilities[0].data.targetType = AbilityTargetType::UnitTarget;
-    
-    hero.abilities[1].data.name = "Charge";
-    hero.abilities[1].data.hotkey = '2';
-    hero.abilities[1].data.manaCost = 75.0f;
-    hero.abilities[1].data.cooldown = 14.0f;
-    hero.abilities[1].data.castRange = 800.0f;
-    hero.abilities[1].data.targetType = AbilityTargetType::PointTarget;
-    
-    hero.abilities[2].data.name = "Tough Skin";
-    hero.abilities[2].data.hotkey = '3';
-    hero.abilities[2].data.targetType = AbilityTargetType::Passive;
-    
-    hero.abilities[3].data.name = "Berserker Rage";
-    hero.abilities[3].data.hotkey = 'F';
-    hero.abilities[3].data.manaCost = 150.0f;
-    hero.abilities[3].data.cooldown = 80.0f;
-    hero.abilities[3].data.duration = 8.0f;
-    hero.abilities[3].data.targetType = AbilityTargetType::NoTarget;
-}
-
-void HeroSystem::setupHero_Mage(HeroComponent& hero) {
-    hero.heroName = "Mage";
-    hero.primaryAttribute = HeroAttribute::Intelligence;
-    hero.baseStrength = 16.0f;
-    hero.baseAgility = 15.0f;
-    hero.baseIntelligence = 27.0f;
-    hero.strengthGain = 1.7f;
-    hero.agilityGain = 1.6f;
-    hero.intelligenceGain = 3.4f;
-    hero.attackRange = 600.0f;
-    
-    hero.abilities[0].data.name = "Fireball";
-    hero.abilities[0].data.hotkey = '1';
-    hero.abilities[0].data.manaCost = 110.0f;
-    hero.abilities[0].data.cooldown = 8.0f;
-    hero.abilities[0].data.damage = 200.0f;
-    hero.abilities[0].data.castRange = 700.0f;
-    hero.abilities[0].data.targetType = AbilityTargetType::UnitTarget;
-    
-    hero.abilities[1].data.name = "Frost Nova";
-    hero.abilities[1].data.hotkey = '2';
-    hero.abilities[1].data.manaCost = 130.0f;
-    hero.abilities[1].data.cooldown = 10.0f;
-    hero.abilities[1].data.damage = 150.0f;
-    hero.abilities[1].data.radius = 300.0f;
-    hero.abilities[1].data.duration = 4.0f;
-    hero.abilities[1].data.castRange = 600.0f;
-    hero.abilities[1].data.targetType = AbilityTargetType::PointTarget;
-    
-    hero.abilities[2].data.name = "Blink";
-    hero.abilities[2].data.hotkey = '3';
-    hero.abilities[2].data.manaCost = 60.0f;
-    hero.abilities[2].data.cooldown = 12.0f;
-    hero.abilities[2].data.castRange = 1000.0f;
-    hero.abilities[2].data.targetType = AbilityTargetType::PointTarget;
-    
-    hero.abilities[3].data.name = "Meteor Storm";
-    hero.abilities[3].data.hotkey = 'F';
-    hero.abilities[3].data.manaCost = 300.0f;
-    hero.abilities[3].data.cooldown = 120.0f;
-    hero.abilities[3].data.damage = 600.0f;
-    hero.abilities[3].data.radius = 500.0f;
-    hero.abilities[3].data.castRange = 800.0f;
-    hero.abilities[3].data.targetType = AbilityTargetType::PointTarget;
-}
-
-void HeroSystem::setupHero_Assassin(HeroComponent& hero) {
-    hero.heroName = "Assassin";
-    hero.primaryAttribute = HeroAttribute::Agility;
-    hero.baseStrength = 18.0f;
-    hero.baseAgility = 26.0f;
-    hero.baseIntelligence = 14.0f;
-    hero.strengthGain = 2.0f;
-    hero.agilityGain = 3.0f;
-    hero.intelligenceGain = 1.4f;
-    hero.attackRange = 5.0f;  // Melee
-    hero.moveSpeed = 320.0f;
-    
-    hero.abilities[0].data.name = "Backstab";
-    hero.abilities[0].data.hotkey = '1';
-    hero.abilities[0].data.manaCost = 50.0f;
-    hero.abilities[0].data.cooldown = 6.0f;
-    hero.abilities[0].data.damage = 150.0f;
-    hero.abilities[0].data.castRange = 150.0f;
-    hero.abilities[0].data.targetType = AbilityTargetType::UnitTarget;
-    
-    hero.abilities[1].data.name = "Shadow Step";
-    hero.abilities[1].data.hotkey = '2';
-    hero.abilities[1].data.manaCost = 80.0f;
-    hero.abilities[1].data.cooldown = 10.0f;
-    hero.abilities[1].data.castRange = 700.0f;
-    hero.abilities[1].data.targetType = AbilityTargetType::UnitTarget;
-    
-    hero.abilities[2].data.name = "Blur";
-    hero.abilities[2].data.hotkey = '3';
-    hero.abilities[2].data.targetType = AbilityTargetType::Passive;
-    
-    hero.abilities[3].data.name = "Shadow Dance";
-    hero.abilities[3].data.hotkey = 'F';
-    hero.abilities[3].data.manaCost = 100.0f;
-    hero.abilities[3].data.cooldown = 60.0f;
-    hero.abilities[3].data.duration = 10.0f;
-    hero.abilities[3].data.targetType = AbilityTargetType::NoTarget;
-}
-
 Entity HeroSystem::createHeroByType(const String& heroType, i32 teamId, const Vec3& position) {
     Entity hero = createHero(heroType, teamId, position);
     
@@ -1782,51 +1436,37 @@ Entity HeroSystem::createHeroByType(const String& heroType, i32 teamId, const Ve
     
     auto& heroComp = entityManager_.getComponent<HeroComponent>(hero);
     
-    // Map Dota 2 hero names to base types
-    // Strength heroes -> Warrior
-    // Agility heroes -> Assassin  
-    // Intelligence heroes -> Mage
-    String baseType = heroType;
-    
-    // Strength heroes (Warrior type)
-    if (heroType == "Axe" || heroType == "Sven" || heroType == "Pudge" || 
-        heroType == "Tidehunter" || heroType == "Earthshaker" || heroType == "Tiny" ||
-        heroType == "Warrior") {
-        baseType = "Warrior";
-    }
-    // Agility heroes (Assassin type)
-    else if (heroType == "Juggernaut" || heroType == "Anti-Mage" || heroType == "Phantom Assassin" ||
-             heroType == "Drow Ranger" || heroType == "Sniper" || heroType == "Mirana" ||
-             heroType == "Assassin") {
-        baseType = "Assassin";
-    }
-    // Intelligence heroes (Mage type)
-    else if (heroType == "Invoker" || heroType == "Crystal Maiden" || heroType == "Lina" ||
-             heroType == "Lion" || heroType == "Shadow Fiend" || heroType == "Zeus" ||
-             heroType == "Mage") {
-        baseType = "Mage";
-    }
-    
-    if (baseType == "Warrior") {
-        setupHero_Warrior(heroComp);
-    } else if (baseType == "Mage") {
-        setupHero_Mage(heroComp);
-    } else if (baseType == "Assassin") {
-        setupHero_Assassin(heroComp);
+    // Dota 2 hero names map to base types through the data file's aliases;
+    // unknown names get the fallback hero
+    const HeroDefinition* def = gameData_->findHero(heroType);
+    if (def) {
+        heroComp.primaryAttribute = def->primaryAttribute;
+        heroComp.baseStrength = def->baseStrength;
+        heroComp.baseAgility = def->baseAgility;
+        heroComp.baseIntelligence = def->baseIntelligence;
+        heroComp.strengthGain = def->strengthGain;
+        heroComp.agilityGain = def->agilityGain;
+        heroComp.intelligenceGain = def->intelligenceGain;
+        heroComp.attackRange = def->attackRange;
+        if (def->moveSpeed > 0.0f) {
+            heroComp.moveSpeed = def->moveSpeed;
+        }
+        
+        for (i32 i = 0; i < 4; ++i) {
+            if (const AbilityData* ability = gameData_->getAbility(def->abilities[i])) {
+                heroComp.abilities[i].data = *ability;
+            }
+        }
     } else {
-        // Default to Warrior for unknown types
-        setupHero_Warrior(heroComp);
+        LOG_WARN("No hero definitions loaded, '{}' gets default stats", heroType);
     }
     
-    // Store the actual hero name for display
-    heroComp.heroName = heroType;
-    
     recalculateStats(heroComp);
     heroComp.currentHealth = heroComp.maxHealth;
     heroComp.currentMana = heroComp.maxMana;
     
     LOG_INFO("Created hero '{}' (base type: {}) for team {} at ({}, {}, {})", 
-             heroType, baseType, teamId, position.x, position.y, position.z);
+             heroType, def ? def->name : String("none"), teamId, position.x, position.y, position.z);
     
     return hero;
 }
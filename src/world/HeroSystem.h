@@ -3,11 +3,14 @@
 #include "System.h"
 #include "Components.h"
 #include "EntityManager.h"
+#include "Modifiers.h"
+#include "Pathfinder.h"
 #include "core/Types.h"
 
 namespace WorldEditor {
 
 class World;
+class GameDataRegistry;
 
 // Hero attributes (Dota-like)
 enum class HeroAttribute : u8 {
@@ -16,50 +19,6 @@ enum class HeroAttribute : u8 {
     Intelligence = 2 // Mana, mana regen, spell amp
 };
 
-// Buff/Debuff types
-enum class BuffType : u8 {
-    // Positive buffs
-    Haste = 0,          // Move speed bonus
-    Strength_Bonus,     // +Strength
-    Agility_Bonus,      // +Agility
-    Intelligence_Bonus, // +Intelligence
-    DamageBonus,        // +Damage
-    ArmorBonus,         // +Armor
-    AttackSpeedBonus,   // +Attack speed
-    Regeneration,       // HP regen
-    ManaRegen,          // Mana regen
-    Invisibility,       // Invisible
-    Invulnerable,       // Can't be damaged
-    
-    // Negative debuffs
-    Slow = 50,          // Move speed reduction
-    Stun,               // Can't act
-    Silence,            // Can't cast spells
-    Disarm,             // Can't attack
-    Root,               // Can't move
-    Break,              // Disable passives
-    Hex,                // Transformed, can't act
-    DamageOverTime,     // Taking damage over time
-    ArmorReduction,     // -Armor
-    AttackSpeedSlow     // -Attack speed
-};
-
-// Buff instance
-struct Buff {
-    BuffType type = BuffType::Haste;
-    String name = "Buff";
-    f32 value = 0.0f;           // Effect magnitude
-    f32 duration = 0.0f;        // Total duration
-    f32 remainingTime = 0.0f;   // Time left
-    Entity source = INVALID_ENTITY; // Who applied this buff
-    bool isPurgeable = true;    // Can be dispelled
-    bool isHidden = false;      // Don't show in UI
-    
-    // For DoT effects
-    f32 tickInterval = 1.0f;
-    f32 tickTimer = 0.0f;
-};
-
 // Item slot types
 enum class ItemSlot : u8 {
     Inventory1 = 0,
@@ -76,8 +35,17 @@ enum class ItemSlot : u8 {
     COUNT
 };
 
+// What an item's active does (resolved from the data file)
+enum class ItemEffect : u8 {
+    None = 0,
+    HealOverTime,   // activeValue HP over activeDuration
+    ManaOverTime,   // activeValue mana over activeDuration
+    Blink           // Teleport up to activeRange towards the target point
+};
+
 // Item data
 struct ItemData {
+    u16 id = 0;                 // Index in GameDataRegistry, 0 = not from the registry
     String name = "Item";
     String description = "";
     i32 goldCost = 0;
@@ -99,6 +67,10 @@ struct ItemData {
     bool hasActive = false;
     f32 activeCooldown = 0.0f;
     f32 activeManaCost = 0.0f;
+    ItemEffect activeEffect = ItemEffect::None;
+    f32 activeValue = 0.0f;
+    f32 activeDuration = 0.0f;
+    f32 activeRange = 0.0f;
     
     // Flags
     bool isConsumable = false;
@@ -133,8 +105,35 @@ enum class AbilityTargetType : u8 {
     Passive = 4         // Always active
 };
 
+// What a cast does. Resolved once when the data file is loaded, so the cast
+// path dispatches on it without looking at names.
+enum class AbilityEffect : u8 {
+    None = 0,       // No active effect (movement abilities, placeholders)
+    TargetNuke,     // Magic damage to one unit, stun for `duration` if set
+    AreaNuke,       // Magic damage in `radius` around the target point
+    SelfBuff,       // Bonus damage and attack speed for `duration`
+    Nova,           // Magic damage in `castRange` around the caster
+    Passive         // Aura visual only
+};
+
+// Particle effects picked by the cast path
+enum class AbilityVisual : u8 {
+    None = 0,
+    Attack,
+    Fire,
+    Ice,
+    Poison,
+    Lightning,
+    Explosion,
+    FireExplosion,      // Fire + explosion
+    LightningStrikes,   // Random strikes over the area
+    Shield,
+    Aura
+};
+
 // Ability data (data-driven)
 struct AbilityData {
+    u16 id = 0;                 // Index in GameDataRegistry, 0 = not from the registry
     String name = "Ability";
     String description = "";
     AbilityTargetType targetType = AbilityTargetType::NoTarget;
@@ -150,6 +149,13 @@ struct AbilityData {
     f32 duration = 0.0f;
     f32 radius = 0.0f;
     
+    // Behavior and visuals
+    AbilityEffect effect = AbilityEffect::None;
+    AbilityVisual hitVisual = AbilityVisual::Attack;        // TargetNuke
+    AbilityVisual areaVisual = AbilityVisual::Explosion;    // AreaNuke
+    AbilityVisual buffVisual = AbilityVisual::Aura;         // SelfBuff
+    Vec4 color = Vec4(0.4f, 0.6f, 1.0f, 1.0f);              // Cast/indicator color
+    
     // Hotkey (1, 2, 3, F for abilities)
     char hotkey = '1';
     i32 maxLevel = 4;
@@ -220,6 +226,9 @@ struct HeroComponent {
     // Movement
     Vector<Vec3> movePath;
     i32 currentPathIndex = 0;
+    Vec3 moveOrderGoal = Vec3(0.0f);  // Goal of the last move order (movePath may end short of it)
+    bool moveOrderAttackMove = false; // Kind of the last move order: attack-move or plain move
+    bool hasMoveOrder = false;        // Cleared on arrival, by any other order, stop or respawn
     
     // Respawn
     f32 respawnTimer = 0.0f;
@@ -228,8 +237,8 @@ struct HeroComponent {
     // Player control
     bool isPlayerControlled = false;
     
-    // Buffs/Debuffs
-    Vector<Buff> buffs;
+    // Buffs/Debuffs (change only through HeroSystem so stats follow)
+    ModifierSet modifiers;
     
     // Inventory
     Item inventory[static_cast<i32>(ItemSlot::COUNT)];
@@ -246,21 +255,14 @@ struct HeroComponent {
     HeroComponent(const String& name, i32 team) : heroName(name), teamId(team) {}
     
     // Helper methods
-    bool hasBuffType(BuffType type) const {
-        for (const auto& buff : buffs) {
-            if (buff.type == type && buff.remainingTime > 0.0f) {
-                return true;
-            }
-        }
-        return false;
-    }
-    
-    bool isStunned() const { return hasBuffType(BuffType::Stun) || hasBuffType(BuffType::Hex); }
-    bool isSilenced() const { return hasBuffType(BuffType::Silence) || hasBuffType(BuffType::Hex); }
-    bool isDisarmed() const { return hasBuffType(BuffType::Disarm) || hasBuffType(BuffType::Hex); }
-    bool isRooted() const { return hasBuffType(BuffType::Root); }
-    bool isInvisible() const { return hasBuffType(BuffType::Invisibility); }
-    bool isInvulnerable() const { return hasBuffType(BuffType::Invulnerable); }
+    bool hasBuffType(BuffType type) const { return modifiers.has(type); }
+    
+    bool isStunned() const { return modifiers.hasAny(ModifierSet::bit(BuffType::Stun) | ModifierSet::bit(BuffType::Hex)); }
+    bool isSilenced() const { return modifiers.hasAny(ModifierSet::bit(BuffType::Silence) | ModifierSet::bit(BuffType::Hex)); }
+    bool isDisarmed() const { return modifiers.hasAny(ModifierSet::bit(BuffType::Disarm) | ModifierSet::bit(BuffType::Hex)); }
+    bool isRooted() const { return modifiers.has(BuffType::Root); }
+    bool isInvisible() const { return modifiers.has(BuffType::Invisibility); }
+    bool isInvulnerable() const { return modifiers.has(BuffType::Invulnerable); }
 };
 
 // Input command for hero
@@ -288,9 +290,14 @@ public:
 
     void update(f32 deltaTime) override;
     String getName() const override { return "HeroSystem"; }
+    void declareAccess(SystemAccess& access) const override;
     
     void setWorld(World* world) { world_ = world; }
     
+    // Ability/item/hero tables (GameDataRegistry::shared() by default)
+    void setGameData(const GameDataRegistry* gameData) { gameData_ = gameData; }
+    const GameDataRegistry& getGameData() const { return *gameData_; }
+    
     // Hero creation
     Entity createHero(const String& heroName, i32 teamId, const Vec3& position);
     Entity createHeroByType(const String& heroType, i32 teamId, const Vec3& position);
@@ -315,6 +322,7 @@ public:
     
     // Item system
     bool giveItem(Entity hero, const ItemData& item);
+    bool giveItem(Entity hero, const String& itemKey);   // Registry key, e.g. "iron_branch"
     bool useItem(Entity hero, ItemSlot slot, const Vec3& targetPos, Entity targetEntity);
     void dropItem(Entity hero, ItemSlot slot);
     void swapItems(Entity hero, ItemSlot slot1, ItemSlot slot2);
@@ -324,30 +332,29 @@ public:
     void giveExperience(Entity hero, f32 amount);
     void levelUp(Entity hero);
     
+    // Combat formulas, shared with CombatEventBuffer
+    static f32 calculateArmor(const HeroComponent& hero);
+    static f32 calculateRespawnTime(i32 level);
+    
     // Get player-controlled hero
     Entity getPlayerHero() const { return playerHero_; }
     void setPlayerHero(Entity hero) { playerHero_ = hero; }
     
-    // Predefined items
-    static ItemData createItem_IronBranch();
-    static ItemData createItem_Tango();
-    static ItemData createItem_HealingSalve();
-    static ItemData createItem_ClarityPotion();
-    static ItemData createItem_BootsOfSpeed();
-    static ItemData createItem_PowerTreads();
-    static ItemData createItem_BladeMail();
-    static ItemData createItem_Blink();
-
 private:
     EntityManager& entityManager_;
     World* world_ = nullptr;
+    const GameDataRegistry* gameData_ = nullptr;
     Entity playerHero_ = INVALID_ENTITY;
+    Pathfinder pathfinder_;
+    Vector<PathResult> pathResults_;
     
     // Hero AI/behavior
     void updateHeroAI(Entity entity, HeroComponent& hero, TransformComponent& transform, f32 deltaTime);
     void updateEnemyHeroAI(Entity entity, HeroComponent& hero, TransformComponent& transform, f32 deltaTime);
     void tryUseAbilityAI(Entity entity, HeroComponent& hero, TransformComponent& transform, Entity targetEntity, const Vec3& targetPos);
     void updateHeroMovement(Entity entity, HeroComponent& hero, TransformComponent& transform, f32 deltaTime);
+    // Pathed (or, while the search is queued, straight) route to goal
+    void setMovePath(Entity hero, HeroComponent& heroComp, const Vec3& goal, bool attackMove = false);
     void updateHeroCombat(Entity entity, HeroComponent& hero, TransformComponent& transform, f32 deltaTime);
     void updateHeroAbilities(Entity entity, HeroComponent& hero, f32 deltaTime);
     void updateItemCooldowns(HeroComponent& hero, f32 deltaTime);
@@ -355,7 +362,6 @@ private:
     // Stats calculation
     void recalculateStats(HeroComponent& hero);
     f32 calculateDamage(const HeroComponent& hero) const;
-    f32 calculateArmor(const HeroComponent& hero) const;
     f32 calculateAttackSpeed(const HeroComponent& hero) const;
     f32 calculateMoveSpeed(const HeroComponent& hero) const;
     
@@ -367,20 +373,8 @@ private:
     // Ability effect execution
     void executeAbilityEffect(Entity heroEntity, HeroComponent& hero, i32 abilityIndex, TransformComponent& transform);
     
-    // Ability implementations
-    void executeAbility_Fireball(Entity hero, const Vec3& targetPos, Entity targetEntity);
-    void executeAbility_Blink(Entity hero, const Vec3& targetPos);
-    void executeAbility_Stun(Entity hero, Entity targetEntity);
-    void executeAbility_AreaNuke(Entity hero, const Vec3& targetPos);
-    
     // Respawn
     void handleRespawn(Entity entity, HeroComponent& hero, f32 deltaTime);
-    f32 calculateRespawnTime(i32 level) const;
-    
-    // Hero templates
-    void setupHero_Warrior(HeroComponent& hero);
-    void setupHero_Mage(HeroComponent& hero);
-    void setupHero_Assassin(HeroComponent& hero);
 };
 
 } // namespace WorldEditor
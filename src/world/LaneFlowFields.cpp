@@ -0,0 +1,240 @@
+#include "LaneFlowFields.h"
+#include <algorithm>
+#include <limits>
+
+namespace WorldEditor {
+
+namespace {
+
+constexpr f32 kDiagonalCost = 1.41421356f;
+constexpr f32 kOffLaneCost = 4.0f;     // Cost multiplier for tiles outside the corridor
+constexpr i32 kSeedSearchRadius = 4;   // Objectives usually stand on blocked tiles
+
+// Opposite directions are paired (n ^ 1)
+constexpr i32 kStepX[8] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+constexpr i32 kStepZ[8] = { 0, 0, 1, -1, 1, -1, -1, 1 };
+
+f32 distanceSqToSegment(const Vec3& point, const Vec3& a, const Vec3& b, f32& outT) {
+    const f32 abX = b.x - a.x;
+    const f32 abZ = b.z - a.z;
+    const f32 lengthSq = abX * abX + abZ * abZ;
+    outT = lengthSq > 0.0f ? std::clamp(((point.x - a.x) * abX + (point.z - a.z) * abZ) / lengthSq, 0.0f, 1.0f) : 0.0f;
+    const f32 dx = a.x + abX * outT - point.x;
+    const f32 dz = a.z + abZ * outT - point.z;
+    return dx * dx + dz * dz;
+}
+
+} // namespace
+
+size_t LaneFlowFields::update(const Registry& registry, const NavGrid& grid, const LanePathTable& paths, u64 lanePathRevision) {
+    const bool rebuildAll = grid_ != &grid || gridVersion_ != grid.getVersion() || lanePathRevision_ != lanePathRevision;
+    grid_ = &grid;
+    gridVersion_ = grid.getVersion();
+    lanePathRevision_ = lanePathRevision;
+
+    if (grid.empty()) {
+        if (rebuildAll) {
+            clear();
+        }
+        return 0;
+    }
+
+    size_t computed = 0;
+    for (size_t id = 0; id < LanePathTable::kPathCount; ++id) {
+        Field& field = fields_[id];
+        // Fields heading for the path end, or for a structure still standing, stay valid
+        if (!rebuildAll && (field.objective == INVALID_ENTITY || isStanding(registry, field.objective))) {
+            continue;
+        }
+
+        const Vector<Vec3>& path = paths.getPath(static_cast<LanePathId>(id));
+        if (rebuildAll) {
+            buildCorridor(path, field);
+        }
+        selectObjective(registry, path, id % LanePathTable::kTeamCount == 0 ? 1 : 2, field);
+        computeFlow(field, !path.empty());
+        ++computed;
+    }
+    return computed;
+}
+
+void LaneFlowFields::clear() {
+    for (auto& field : fields_) {
+        field = Field();
+    }
+}
+
+bool LaneFlowFields::sample(LanePathId id, const Vec3& position, Vec3& outDirection) const {
+    i32 x = 0;
+    i32 z = 0;
+    if (id >= LanePathTable::kPathCount || !grid_ || !grid_->worldToCell(position, x, z)) {
+        return false;
+    }
+    const Field& field = fields_[id];
+    if (field.flow.empty()) {
+        return false;
+    }
+
+    const u8 flow = field.flow[grid_->index(x, z)];
+    Vec3 direction;
+    if (flow == kNoFlow) {
+        return false;
+    } else if (flow == kAtObjective) {
+        direction = field.target - position;
+        direction.y = 0.0f;
+    } else {
+        direction = Vec3(static_cast<f32>(kStepX[flow]), 0.0f, static_cast<f32>(kStepZ[flow]));
+    }
+
+    const f32 length = glm::length(direction);
+    if (length < 0.001f) {
+        return false;
+    }
+    outDirection = direction / length;
+    return true;
+}
+
+u8 LaneFlowFields::getFlow(LanePathId id, i32 x, i32 z) const {
+    if (id >= LanePathTable::kPathCount || !grid_ || !grid_->isInside(x, z) || fields_[id].flow.empty()) {
+        return kNoFlow;
+    }
+    return fields_[id].flow[grid_->index(x, z)];
+}
+
+Vec2i LaneFlowFields::getStep(u8 flow) {
+    return flow < 8 ? Vec2i(kStepX[flow], kStepZ[flow]) : Vec2i(0, 0);
+}
+
+Entity LaneFlowFields::getObjective(LanePathId id) const {
+    return id < LanePathTable::kPathCount ? fields_[id].objective : INVALID_ENTITY;
+}
+
+void LaneFlowFields::buildCorridor(const Vector<Vec3>& path, Field& field) const {
+    const NavGrid& grid = *grid_;
+    field.corridor.assign(static_cast<size_t>(grid.getWidth()) * static_cast<size_t>(grid.getHeight()), 0);
+    if (path.empty()) {
+        return;
+    }
+
+    const f32 width = corridorWidth_ * grid.getCellSize();
+    const f32 widthSq = width * width;
+    for (i32 z = 0; z < grid.getHeight(); ++z) {
+        for (i32 x = 0; x < grid.getWidth(); ++x) {
+            const Vec3 center = grid.cellToWorld(x, z);
+            f32 t = 0.0f;
+            bool inside = distanceSqToSegment(center, path.front(), path.front(), t) <= widthSq;
+            for (size_t i = 1; i < path.size() && !inside; ++i) {
+                inside = distanceSqToSegment(center, path[i - 1], path[i], t) <= widthSq;
+            }
+            field.corridor[grid.index(x, z)] = inside ? 1 : 0;
+        }
+    }
+}
+
+void LaneFlowFields::selectObjective(const Registry& registry, const Vector<Vec3>& path, i32 teamId, Field& field) const {
+    field.objective = INVALID_ENTITY;
+    field.target = path.empty() ? Vec3(0.0f) : path.back();
+    if (path.empty()) {
+        return;
+    }
+
+    // The enemy structure in the corridor that comes first along the path
+    const f32 width = corridorWidth_ * grid_->getCellSize();
+    f32 bestProgress = std::numeric_limits<f32>::max();
+    auto view = registry.view<ObjectComponent, TransformComponent>();
+    for (auto entity : view) {
+        const auto& obj = view.get<ObjectComponent>(entity);
+        const bool structure = obj.type == ObjectType::Tower || obj.type == ObjectType::Building || obj.type == ObjectType::Base;
+        if (!structure || obj.teamId == 0 || obj.teamId == teamId || !isStanding(registry, entity)) {
+            continue;
+        }
+
+        const Vec3& position = view.get<TransformComponent>(entity).position;
+        f32 t = 0.0f;
+        f32 nearestSq = distanceSqToSegment(position, path.front(), path.front(), t);
+        f32 progress = 0.0f;
+        f32 travelled = 0.0f;
+        for (size_t i = 1; i < path.size(); ++i) {
+            const f32 distanceSq = distanceSqToSegment(position, path[i - 1], path[i], t);
+            const f32 segment = glm::length(path[i] - path[i - 1]);
+            if (distanceSq < nearestSq) {
+                nearestSq = distanceSq;
+                progress = travelled + segment * t;
+            }
+            travelled += segment;
+        }
+
+        if (nearestSq <= width * width && progress < bestProgress) {
+            bestProgress = progress;
+            field.objective = entity;
+            field.target = position;
+        }
+    }
+}
+
+void LaneFlowFields::computeFlow(Field& field, bool hasPath) {
+    const NavGrid& grid = *grid_;
+    const size_t cellCount = static_cast<size_t>(grid.getWidth()) * static_cast<size_t>(grid.getHeight());
+    field.flow.assign(cellCount, kNoFlow);
+
+    i32 seedX = 0;
+    i32 seedZ = 0;
+    if (!hasPath || !grid.worldToCell(field.target, seedX, seedZ) ||
+        !grid.findNearestWalkable(seedX, seedZ, kSeedSearchRadius, seedX, seedZ)) {
+        return;
+    }
+
+    cost_.assign(cellCount, std::numeric_limits<f32>::max());
+    open_.clear();
+    const u32 seed = grid.index(seedX, seedZ);
+    cost_[seed] = 0.0f;
+    field.flow[seed] = kAtObjective;
+    open_.push_back({ 0.0f, seed });
+
+    const i32 width = grid.getWidth();
+    while (!open_.empty()) {
+        std::pop_heap(open_.begin(), open_.end());
+        const OpenNode node = open_.back();
+        open_.pop_back();
+        if (node.cost > cost_[node.cell]) {
+            continue;
+        }
+
+        const i32 x = static_cast<i32>(node.cell) % width;
+        const i32 z = static_cast<i32>(node.cell) / width;
+        for (u8 n = 0; n < 8; ++n) {
+            const i32 dx = kStepX[n];
+            const i32 dz = kStepZ[n];
+            if (!grid.isWalkable(x + dx, z + dz)) {
+                continue;
+            }
+            // Same rule as the pathfinder: no cutting corners past blocked tiles
+            const bool diagonal = dx != 0 && dz != 0;
+            if (diagonal && (!grid.isWalkable(x + dx, z) || !grid.isWalkable(x, z + dz))) {
+                continue;
+            }
+
+            const u32 next = grid.index(x + dx, z + dz);
+            const f32 step = (diagonal ? kDiagonalCost : 1.0f) * (field.corridor[next] ? 1.0f : kOffLaneCost);
+            const f32 cost = node.cost + step;
+            if (cost >= cost_[next]) {
+                continue;
+            }
+            cost_[next] = cost;
+            field.flow[next] = static_cast<u8>(n ^ 1);     // Back toward the tile we came from
+            open_.push_back({ cost, next });
+            std::push_heap(open_.begin(), open_.end());
+        }
+    }
+}
+
+bool LaneFlowFields::isStanding(const Registry& registry, Entity entity) {
+    if (!registry.valid(entity)) {
+        return false;
+    }
+    // Structures without health (bases on older maps) never fall
+    const auto* health = registry.try_get<HealthComponent>(entity);
+    return !health || !health->isDead;
+}
+
+} // namespace WorldEditor
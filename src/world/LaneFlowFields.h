@@ -0,0 +1,76 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+#include "LanePaths.h"
+#include "NavGrid.h"
+
+namespace WorldEditor {
+
+// One flow field per (lane, team) over the NavGrid. Every walkable tile stores the step
+// toward the lane's next objective, so moving a creep is a single lookup. The objective
+// is the first enemy tower, building or base still standing along the lane path, or the
+// path end once none is left. Fields come from a Dijkstra search out of the objective;
+// tiles outside a corridor around the lane path cost extra, so creeps pushed off the lane
+// walk back to it instead of cutting across the map.
+//
+// update() rebuilds every field when the grid or the waypoints changed; otherwise it only
+// recomputes the fields whose objective died since the last call.
+class LaneFlowFields {
+public:
+    static constexpr u8 kNoFlow = 0xFF;         // Blocked or cut off from the objective
+    static constexpr u8 kAtObjective = 0xFE;    // Head straight for the objective
+
+    // Returns the number of fields computed
+    size_t update(const Registry& registry, const NavGrid& grid, const LanePathTable& paths, u64 lanePathRevision);
+    void clear();
+
+    // Unit direction on the ground plane; false where there is no flow (no field, blocked
+    // or unreachable tile, standing on the objective)
+    bool sample(LanePathId id, const Vec3& position, Vec3& outDirection) const;
+
+    // Neighbour index (see getStep), kNoFlow or kAtObjective
+    u8 getFlow(LanePathId id, i32 x, i32 z) const;
+    static Vec2i getStep(u8 flow);
+
+    // INVALID_ENTITY when the field leads to the path end
+    Entity getObjective(LanePathId id) const;
+
+    // Tiles within this many tiles of the lane path are in the corridor
+    void setCorridorWidth(f32 tiles) { corridorWidth_ = tiles; }
+    f32 getCorridorWidth() const { return corridorWidth_; }
+
+private:
+    struct Field {
+        Vector<u8> flow;
+        Vector<u8> corridor;
+        Entity objective = INVALID_ENTITY;
+        Vec3 target = Vec3(0.0f);
+    };
+
+    struct OpenNode {
+        f32 cost;
+        u32 cell;
+        // Min-heap order
+        bool operator<(const OpenNode& other) const {
+            return cost != other.cost ? cost > other.cost : cell > other.cell;
+        }
+    };
+
+    void buildCorridor(const Vector<Vec3>& path, Field& field) const;
+    void selectObjective(const Registry& registry, const Vector<Vec3>& path, i32 teamId, Field& field) const;
+    void computeFlow(Field& field, bool hasPath);
+    static bool isStanding(const Registry& registry, Entity entity);
+
+    Field fields_[LanePathTable::kPathCount];
+    const NavGrid* grid_ = nullptr;
+    u32 gridVersion_ = 0;
+    u64 lanePathRevision_ = ~0ull;
+    f32 corridorWidth_ = 2.0f;
+
+    // Dijkstra scratch, reused between fields
+    Vector<f32> cost_;
+    Vector<OpenNode> open_;
+};
+
+} // namespace WorldEditor
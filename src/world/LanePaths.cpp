@@ -0,0 +1,93 @@
+#include "LanePaths.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+namespace {
+
+const Vector<Vec3> kEmptyPath;
+
+void buildFallbackPath(CreepLane lane, i32 teamId, Vector<Vec3>& out) {
+    Vec3 start, end;
+    switch (lane) {
+        case CreepLane::Top:
+            start = teamId == 1 ? Vec3(50, 0, 250) : Vec3(250, 0, 50);
+            end = teamId == 1 ? Vec3(250, 0, 50) : Vec3(50, 0, 250);
+            break;
+        case CreepLane::Middle:
+            start = teamId == 1 ? Vec3(50, 0, 50) : Vec3(250, 0, 250);
+            end = teamId == 1 ? Vec3(250, 0, 250) : Vec3(50, 0, 50);
+            break;
+        case CreepLane::Bottom:
+            start = teamId == 1 ? Vec3(250, 0, 50) : Vec3(50, 0, 250);
+            end = teamId == 1 ? Vec3(50, 0, 250) : Vec3(250, 0, 50);
+            break;
+    }
+
+    out.push_back(start);
+    out.push_back(Vec3((start.x + end.x) * 0.5f, 0, (start.z + end.z) * 0.5f));
+    out.push_back(end);
+}
+
+} // namespace
+
+LanePathId LanePathTable::idFor(CreepLane lane, i32 teamId) {
+    const size_t laneIndex = static_cast<size_t>(lane);
+    if (laneIndex >= kLaneCount) {
+        return INVALID_LANE_PATH;
+    }
+    const size_t teamIndex = teamId == 1 ? 0 : 1;
+    return static_cast<LanePathId>(laneIndex * kTeamCount + teamIndex);
+}
+
+void LanePathTable::build(const Registry& registry) {
+    clear();
+
+    // One pass over the waypoints for all lanes
+    Vector<std::pair<i32, Vec3>> ordered[kLaneCount];
+    auto view = registry.view<ObjectComponent, TransformComponent>();
+    for (auto entity : view) {
+        const auto& obj = view.get<ObjectComponent>(entity);
+        if (obj.type != ObjectType::Waypoint) {
+            continue;
+        }
+
+        const Vec3& position = view.get<TransformComponent>(entity).position;
+        for (size_t lane = 0; lane < kLaneCount; ++lane) {
+            if (obj.waypointLane == static_cast<i32>(lane) || obj.waypointLane == -1) {
+                ordered[lane].push_back({obj.waypointOrder, position});
+            }
+        }
+    }
+
+    for (size_t lane = 0; lane < kLaneCount; ++lane) {
+        std::stable_sort(ordered[lane].begin(), ordered[lane].end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        // Both teams walk the same waypoints for now; team direction only
+        // matters for the fallback path
+        for (i32 teamId = 1; teamId <= 2; ++teamId) {
+            Vector<Vec3>& path = paths_[idFor(static_cast<CreepLane>(lane), teamId)];
+            if (ordered[lane].empty()) {
+                buildFallbackPath(static_cast<CreepLane>(lane), teamId, path);
+                continue;
+            }
+            path.reserve(ordered[lane].size());
+            for (const auto& waypoint : ordered[lane]) {
+                path.push_back(waypoint.second);
+            }
+        }
+    }
+}
+
+void LanePathTable::clear() {
+    for (auto& path : paths_) {
+        path.clear();
+    }
+}
+
+const Vector<Vec3>& LanePathTable::getPath(LanePathId id) const {
+    return id < kPathCount ? paths_[id] : kEmptyPath;
+}
+
+} // namespace WorldEditor
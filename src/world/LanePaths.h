@@ -0,0 +1,33 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+
+namespace WorldEditor {
+
+// Waypoint paths for every (lane, team), shared by all creeps. Waypoints only change on
+// map load or in the editor, so the table is built once from the placed Waypoint objects
+// and rebuilt when EntityManager reports a new lane path revision. Creeps keep a
+// LanePathId and an index instead of their own copy of the path.
+class LanePathTable {
+public:
+    static constexpr size_t kLaneCount = 3;
+    static constexpr size_t kTeamCount = 2;
+    static constexpr size_t kPathCount = kLaneCount * kTeamCount;
+
+    // Team 1 = Radiant, anything else = Dire
+    static LanePathId idFor(CreepLane lane, i32 teamId);
+
+    // Collect and order the waypoints of every lane; lanes without waypoints get a
+    // straight fallback path between the team bases
+    void build(const Registry& registry);
+    void clear();
+
+    // Empty for INVALID_LANE_PATH
+    const Vector<Vec3>& getPath(LanePathId id) const;
+
+private:
+    Vector<Vec3> paths_[kPathCount];
+};
+
+} // namespace WorldEditor
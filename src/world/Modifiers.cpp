@@ -0,0 +1,111 @@
+#include "Modifiers.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+namespace {
+
+constexpr u8 kFirstDebuff = static_cast<u8>(BuffType::Slow);
+
+} // namespace
+
+bool ModifierSet::apply(const Buff& buff) {
+    if (buff.duration <= 0.0f) {
+        return false;
+    }
+
+    for (Buff& existing : buffs_) {
+        if (existing.type == buff.type && existing.source == buff.source) {
+            existing.remainingTime = buff.duration;
+            if (buff.value <= existing.value) {
+                return false;
+            }
+            existing.value = buff.value;
+            rebuild();
+            return true;
+        }
+    }
+
+    Buff added = buff;
+    added.remainingTime = buff.duration;
+    added.tickTimer = buff.tickInterval;
+    buffs_.push_back(added);
+    rebuild();
+    return true;
+}
+
+size_t ModifierSet::remove(BuffType type) {
+    if (!has(type)) {
+        return 0;
+    }
+
+    size_t removed = 0;
+    for (size_t i = 0; i < buffs_.size();) {
+        if (buffs_[i].type == type) {
+            removeAt(i);
+            removed++;
+        } else {
+            ++i;
+        }
+    }
+    rebuild();
+    return removed;
+}
+
+size_t ModifierSet::purge(bool positive, bool negative) {
+    size_t removed = 0;
+    for (size_t i = 0; i < buffs_.size();) {
+        const Buff& buff = buffs_[i];
+        const bool isNegative = static_cast<u8>(buff.type) >= kFirstDebuff;
+        if (buff.isPurgeable && ((isNegative && negative) || (!isNegative && positive))) {
+            removeAt(i);
+            removed++;
+        } else {
+            ++i;
+        }
+    }
+    if (removed > 0) {
+        rebuild();
+    }
+    return removed;
+}
+
+void ModifierSet::clear() {
+    buffs_.clear();
+    rebuild();
+}
+
+void ModifierSet::removeAt(size_t index) {
+    // Order is irrelevant: totals are sums and maxima
+    if (index + 1 < buffs_.size()) {
+        buffs_[index] = buffs_.back();
+    }
+    buffs_.pop_back();
+}
+
+void ModifierSet::rebuild() {
+    mask_ = 0;
+    totals_ = ModifierTotals{};
+
+    for (const Buff& buff : buffs_) {
+        mask_ |= bit(buff.type);
+
+        switch (buff.type) {
+            case BuffType::Strength_Bonus: totals_.strength += buff.value; break;
+            case BuffType::Agility_Bonus: totals_.agility += buff.value; break;
+            case BuffType::Intelligence_Bonus: totals_.intelligence += buff.value; break;
+            case BuffType::DamageBonus: totals_.damage += buff.value; break;
+            case BuffType::ArmorBonus: totals_.armor += buff.value; break;
+            case BuffType::ArmorReduction: totals_.armor -= buff.value; break;
+            case BuffType::AttackSpeedBonus: totals_.attackSpeed += buff.value; break;
+            case BuffType::AttackSpeedSlow: totals_.attackSpeed -= buff.value; break;
+            case BuffType::Regeneration: totals_.healthRegen += buff.value; break;
+            case BuffType::ManaRegen: totals_.manaRegen += buff.value; break;
+            case BuffType::Haste: totals_.haste = std::max(totals_.haste, buff.value); break;
+            case BuffType::Slow: totals_.slowPercent = std::max(totals_.slowPercent, buff.value); break;
+            default: break;
+        }
+    }
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "core/Types.h"
+
+namespace WorldEditor {
+
+// Buff/Debuff types. Values double as bit indices in ModifierSet's mask, so they
+// must stay below 64.
+enum class BuffType : u8 {
+    // Positive buffs
+    Haste = 0,          // Move speed bonus
+    Strength_Bonus,     // +Strength
+    Agility_Bonus,      // +Agility
+    Intelligence_Bonus, // +Intelligence
+    DamageBonus,        // +Damage
+    ArmorBonus,         // +Armor
+    AttackSpeedBonus,   // +Attack speed
+    Regeneration,       // HP regen
+    ManaRegen,          // Mana regen
+    Invisibility,       // Invisible
+    Invulnerable,       // Can't be damaged
+
+    // Negative debuffs
+    Slow = 50,          // Move speed reduction
+    Stun,               // Can't act
+    Silence,            // Can't cast spells
+    Disarm,             // Can't attack
+    Root,               // Can't move
+    Break,              // Disable passives
+    Hex,                // Transformed, can't act
+    DamageOverTime,     // Taking damage over time
+    ArmorReduction,     // -Armor
+    AttackSpeedSlow     // -Attack speed
+};
+
+// Buff instance (plain data; the UI resolves a display name through source + sourceAbility)
+struct Buff {
+    BuffType type = BuffType::Haste;
+    i8 sourceAbility = -1;      // Ability slot on the source hero, -1 for items/other
+    f32 value = 0.0f;           // Effect magnitude
+    f32 duration = 0.0f;        // Total duration
+    f32 remainingTime = 0.0f;   // Time left
+    Entity source = INVALID_ENTITY; // Who applied this buff
+    bool isPurgeable = true;    // Can be dispelled
+    bool isHidden = false;      // Don't show in UI
+
+    // For DoT effects
+    f32 tickInterval = 1.0f;
+    f32 tickTimer = 0.0f;
+};
+
+// Stat deltas of all active modifiers, summed when the set changes
+struct ModifierTotals {
+    f32 strength = 0.0f;
+    f32 agility = 0.0f;
+    f32 intelligence = 0.0f;
+    f32 damage = 0.0f;
+    f32 armor = 0.0f;
+    f32 attackSpeed = 0.0f;
+    f32 healthRegen = 0.0f;
+    f32 manaRegen = 0.0f;
+    f32 haste = 0.0f;           // Strongest flat move speed bonus
+    f32 slowPercent = 0.0f;     // Strongest slow
+};
+
+// Active buffs of one unit. State checks (stunned, silenced, ...) are one mask test and
+// stat deltas are cached, so per-tick readers never scan the buff list; the list is only
+// walked to count down timers. Removal swaps with the last element, so the storage
+// stays contiguous and keeps its capacity for the next buffs.
+class ModifierSet {
+public:
+    static constexpr u64 bit(BuffType type) { return 1ull << static_cast<u8>(type); }
+
+    // Refreshes the buff of the same type and source (keeping the stronger value),
+    // otherwise adds it. Buffs without a duration are ignored. True if the totals changed.
+    bool apply(const Buff& buff);
+
+    // Returns the number of buffs removed
+    size_t remove(BuffType type);
+    size_t purge(bool positive, bool negative);
+    void clear();
+
+    // Counts down timers and drops expired buffs. onTick(buff) runs for every
+    // damage-over-time tick. True if buffs expired (stats need recomputing).
+    template<typename TickFunc>
+    bool update(f32 deltaTime, TickFunc&& onTick) {
+        bool expired = false;
+        for (size_t i = 0; i < buffs_.size();) {
+            Buff& buff = buffs_[i];
+            buff.remainingTime -= deltaTime;
+
+            if (buff.type == BuffType::DamageOverTime && buff.remainingTime > 0.0f) {
+                buff.tickTimer -= deltaTime;
+                if (buff.tickTimer <= 0.0f) {
+                    onTick(buff);
+                    buff.tickTimer = buff.tickInterval;
+                }
+            }
+
+            if (buff.remainingTime <= 0.0f) {
+                removeAt(i);
+                expired = true;
+            } else {
+                ++i;
+            }
+        }
+        if (expired) {
+            rebuild();
+        }
+        return expired;
+    }
+
+    bool has(BuffType type) const { return (mask_ & bit(type)) != 0; }
+    bool hasAny(u64 mask) const { return (mask_ & mask) != 0; }
+    u64 getMask() const { return mask_; }
+
+    const ModifierTotals& getTotals() const { return totals_; }
+    const Vector<Buff>& getBuffs() const { return buffs_; }
+    size_t size() const { return buffs_.size(); }
+    bool empty() const { return buffs_.empty(); }
+
+private:
+    void removeAt(size_t index);
+    void rebuild();
+
+    Vector<Buff> buffs_;
+    u64 mask_ = 0;
+    ModifierTotals totals_;
+};
+
+} // namespace WorldEditor
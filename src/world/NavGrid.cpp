@@ -0,0 +1,190 @@
+#include "NavGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace WorldEditor {
+
+NavGrid::NavGrid(f32 agentRadius)
+    : agentRadius_(std::max(agentRadius, 0.0f)) {
+}
+
+void NavGrid::clear() {
+    width_ = 0;
+    height_ = 0;
+    walkable_.clear();
+    groundHeight_.clear();
+    walkableCount_ = 0;
+    ++version_;
+}
+
+void NavGrid::build(const Registry& registry) {
+    clear();
+
+    const TerrainComponent* terrain = nullptr;
+    auto terrainView = registry.view<TerrainComponent, TransformComponent>();
+    for (auto entity : terrainView) {
+        terrain = &terrainView.get<TerrainComponent>(entity);
+        origin_ = terrainView.get<TransformComponent>(entity).position;
+        break;
+    }
+    if (!terrain || terrain->tilesX <= 0 || terrain->tilesZ <= 0 || terrain->tileSize <= 0.0f) {
+        return;
+    }
+
+    width_ = terrain->tilesX;
+    height_ = terrain->tilesZ;
+    cellSize_ = terrain->tileSize;
+
+    // Older maps only carry the float heightmap; fall back to levels derived from it
+    const i32 resX = terrain->resolution.x;
+    const size_t vertexCount = static_cast<size_t>(resX) * static_cast<size_t>(terrain->resolution.y);
+    const bool sameLayout = resX == width_ + 1 && terrain->resolution.y == height_ + 1;
+    const bool hasLevels = sameLayout && terrain->heightLevels.size() == vertexCount;
+    const bool hasHeights = sameLayout && terrain->heightmap.size() == vertexCount && terrain->heightStep > 0.0f;
+    const bool hasRamps = terrain->rampMask.size() == static_cast<size_t>(width_) * static_cast<size_t>(height_);
+
+    auto level = [&](i32 x, i32 z) -> f32 {
+        const size_t i = static_cast<size_t>(z) * static_cast<size_t>(resX) + static_cast<size_t>(x);
+        if (hasLevels) {
+            return static_cast<f32>(terrain->heightLevels[i]);
+        }
+        if (hasHeights) {
+            return std::round(terrain->heightmap[i] / terrain->heightStep);
+        }
+        return 0.0f;
+    };
+
+    const size_t cellCount = static_cast<size_t>(width_) * static_cast<size_t>(height_);
+    walkable_.assign(cellCount, 0);
+    groundHeight_.assign(cellCount, 0.0f);
+
+    for (i32 z = 0; z < height_; ++z) {
+        for (i32 x = 0; x < width_; ++x) {
+            const f32 l00 = level(x, z);
+            const f32 l10 = level(x + 1, z);
+            const f32 l01 = level(x, z + 1);
+            const f32 l11 = level(x + 1, z + 1);
+            const f32 lo = std::min(std::min(l00, l10), std::min(l01, l11));
+            const f32 hi = std::max(std::max(l00, l10), std::max(l01, l11));
+
+            const u32 i = index(x, z);
+            const bool ramp = hasRamps && terrain->rampMask[i] != 0;
+            walkable_[i] = (hi == lo || ramp) ? 1 : 0;
+            groundHeight_[i] = (l00 + l10 + l01 + l11) * 0.25f * terrain->heightStep;
+        }
+    }
+
+    blockColliders(registry);
+
+    walkableCount_ = static_cast<size_t>(std::count(walkable_.begin(), walkable_.end(), static_cast<u8>(1)));
+    LOG_INFO("NavGrid built: {}x{} tiles, {} walkable", width_, height_, walkableCount_);
+}
+
+void NavGrid::blockColliders(const Registry& registry) {
+    auto view = registry.view<CollisionComponent, TransformComponent>();
+    for (auto entity : view) {
+        const auto& col = view.get<CollisionComponent>(entity);
+        if (!col.isStatic || col.isTrigger || !col.blocksMovement) {
+            continue;
+        }
+
+        // Tiles whose center the agent could not stand on
+        const Vec3 center = view.get<TransformComponent>(entity).position + col.offset - origin_;
+        const f32 reach = col.getBoundingRadius() + agentRadius_;
+        const i32 minX = std::max(0, static_cast<i32>(std::floor((center.x - reach) / cellSize_)));
+        const i32 maxX = std::min(width_ - 1, static_cast<i32>(std::floor((center.x + reach) / cellSize_)));
+        const i32 minZ = std::max(0, static_cast<i32>(std::floor((center.z - reach) / cellSize_)));
+        const i32 maxZ = std::min(height_ - 1, static_cast<i32>(std::floor((center.z + reach) / cellSize_)));
+
+        for (i32 z = minZ; z <= maxZ; ++z) {
+            for (i32 x = minX; x <= maxX; ++x) {
+                const f32 dx = (static_cast<f32>(x) + 0.5f) * cellSize_ - center.x;
+                const f32 dz = (static_cast<f32>(z) + 0.5f) * cellSize_ - center.z;
+                if (dx * dx + dz * dz <= reach * reach) {
+                    walkable_[index(x, z)] = 0;
+                }
+            }
+        }
+    }
+}
+
+bool NavGrid::worldToCell(const Vec3& position, i32& outX, i32& outZ) const {
+    if (empty()) {
+        return false;
+    }
+    const Vec3 local = position - origin_;
+    outX = std::clamp(static_cast<i32>(std::floor(local.x / cellSize_)), 0, width_ - 1);
+    outZ = std::clamp(static_cast<i32>(std::floor(local.z / cellSize_)), 0, height_ - 1);
+    return true;
+}
+
+Vec3 NavGrid::cellToWorld(i32 x, i32 z) const {
+    const f32 ground = isInside(x, z) ? groundHeight_[index(x, z)] : 0.0f;
+    return origin_ + Vec3((static_cast<f32>(x) + 0.5f) * cellSize_, ground, (static_cast<f32>(z) + 0.5f) * cellSize_);
+}
+
+bool NavGrid::findNearestWalkable(i32 x, i32 z, i32 maxRadius, i32& outX, i32& outZ) const {
+    for (i32 r = 0; r <= maxRadius; ++r) {
+        i32 best = std::numeric_limits<i32>::max();
+        for (i32 dz = -r; dz <= r; ++dz) {
+            for (i32 dx = -r; dx <= r; ++dx) {
+                // Only the ring at distance r; inner rings were already checked
+                if (std::max(std::abs(dx), std::abs(dz)) != r || !isWalkable(x + dx, z + dz)) {
+                    continue;
+                }
+                const i32 distance = dx * dx + dz * dz;
+                if (distance < best) {
+                    best = distance;
+                    outX = x + dx;
+                    outZ = z + dz;
+                }
+            }
+        }
+        if (best != std::numeric_limits<i32>::max()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NavGrid::hasLineOfSight(i32 x0, i32 z0, i32 x1, i32 z1) const {
+    if (!isWalkable(x0, z0)) {
+        return false;
+    }
+
+    const i32 nx = std::abs(x1 - x0);
+    const i32 nz = std::abs(z1 - z0);
+    const i32 stepX = x1 > x0 ? 1 : -1;
+    const i32 stepZ = z1 > z0 ? 1 : -1;
+
+    // Supercover walk: every cell the segment touches, in order
+    i32 x = x0;
+    i32 z = z0;
+    for (i32 ix = 0, iz = 0; ix < nx || iz < nz;) {
+        const i64 decision = static_cast<i64>(1 + 2 * ix) * nz - static_cast<i64>(1 + 2 * iz) * nx;
+        if (decision == 0) {
+            // Exactly through a corner: both side cells must be open
+            if (!isWalkable(x + stepX, z) || !isWalkable(x, z + stepZ)) {
+                return false;
+            }
+            x += stepX;
+            z += stepZ;
+            ++ix;
+            ++iz;
+        } else if (decision < 0) {
+            x += stepX;
+            ++ix;
+        } else {
+            z += stepZ;
+            ++iz;
+        }
+
+        if (!isWalkable(x, z)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace WorldEditor
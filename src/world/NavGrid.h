@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+
+namespace WorldEditor {
+
+// Walkability of the terrain tile grid. A tile is walkable when its four corner height
+// levels match (flat ground) or it is marked in the ramp mask; tiles covered by a static
+// blocking collider (grown by the agent radius) are blocked. Built from the first
+// TerrainComponent in the registry; without terrain the grid is empty and callers
+// should move in straight lines.
+class NavGrid {
+public:
+    explicit NavGrid(f32 agentRadius = 48.0f);
+
+    void build(const Registry& registry);
+    void clear();
+
+    bool empty() const { return width_ == 0 || height_ == 0; }
+    i32 getWidth() const { return width_; }
+    i32 getHeight() const { return height_; }
+    f32 getCellSize() const { return cellSize_; }
+    size_t getWalkableCount() const { return walkableCount_; }
+
+    // Bumped by every build/clear so path caches know when to drop their entries
+    u32 getVersion() const { return version_; }
+
+    bool isInside(i32 x, i32 z) const { return x >= 0 && z >= 0 && x < width_ && z < height_; }
+    bool isWalkable(i32 x, i32 z) const { return isInside(x, z) && walkable_[index(x, z)] != 0; }
+
+    // Cell containing a world position (clamped to the grid); false when the grid is empty
+    bool worldToCell(const Vec3& position, i32& outX, i32& outZ) const;
+    // Cell center on the ground
+    Vec3 cellToWorld(i32 x, i32 z) const;
+
+    // Closest walkable cell within maxRadius rings of (x, z), the cell itself included
+    bool findNearestWalkable(i32 x, i32 z, i32 maxRadius, i32& outX, i32& outZ) const;
+
+    // The straight segment between two cell centers only crosses walkable cells and
+    // never squeezes diagonally between two blocked cells
+    bool hasLineOfSight(i32 x0, i32 z0, i32 x1, i32 z1) const;
+
+    u32 index(i32 x, i32 z) const { return static_cast<u32>(z) * static_cast<u32>(width_) + static_cast<u32>(x); }
+
+private:
+    void blockColliders(const Registry& registry);
+
+    f32 agentRadius_;
+    i32 width_ = 0;
+    i32 height_ = 0;
+    f32 cellSize_ = 128.0f;
+    Vec3 origin_ = Vec3(0.0f);      // World position of the terrain's (0, 0) corner
+    Vector<u8> walkable_;
+    Vector<f32> groundHeight_;      // Local height of each tile, for waypoints
+    size_t walkableCount_ = 0;
+    u32 version_ = 0;
+};
+
+} // namespace WorldEditor
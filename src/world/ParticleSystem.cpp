@@ -31,12 +31,21 @@ static Vec3 randomInCone(const Vec3& direction, f32 angleDegrees) {
 }
 
 ParticleSystem::ParticleSystem(EntityManager& entityManager)
-    : entityManager_(entityManager) {}
+    : entityManager_(entityManager) {
+    std::fill(std::begin(effectPrefabs_), std::end(effectPrefabs_), INVALID_PREFAB);
+}
+
+void ParticleSystem::declareAccess(SystemAccess& access) const {
+    // Effects spawned by abilities this tick emit this tick
+    access.changesStructure()
+          .read<TransformComponent>()
+          .write<ParticleEmitterComponent>()
+          .after("HeroSystem");
+}
 
 void ParticleSystem::update(f32 deltaTime) {
     auto& registry = entityManager_.getRegistry();
-    
-    Vector<Entity> toRemove;
+    auto& commands = entityManager_.getCommandBuffer();
     
     auto view = registry.view<ParticleEmitterComponent, TransformComponent>();
     for (auto entity : view) {
@@ -47,13 +56,9 @@ void ParticleSystem::update(f32 deltaTime) {
         
         // Remove finished non-looping effects
         if (!emitter.loop && emitter.elapsed >= emitter.duration && emitter.particles.empty()) {
-            toRemove.push_back(entity);
+            commands.destroy(entity);
         }
     }
-    
-    for (auto e : toRemove) {
-        entityManager_.destroyEntity(e);
-    }
 }
 
 void ParticleSystem::updateEmitter(Entity entity, ParticleEmitterComponent& emitter, f32 deltaTime) {
@@ -155,14 +160,33 @@ void ParticleSystem::updateParticle(Particle& p, f32 deltaTime) {
 }
 
 Entity ParticleSystem::createEffect(ParticleEffectType type, const Vec3& position, f32 duration) {
-    Entity entity = entityManager_.createEntity("ParticleEffect");
-    auto& transform = entityManager_.addComponent<TransformComponent>(entity);
-    transform.position = position;
+    Entity entity = entityManager_.getPrefabs().instantiate(getEffectPrefab(type));
+    if (entity == INVALID_ENTITY) {
+        return INVALID_ENTITY;
+    }
+    entityManager_.getComponent<TransformComponent>(entity).position = position;
     
-    auto& emitter = entityManager_.addComponent<ParticleEmitterComponent>(entity);
-    emitter.effectType = type;
+    // Presets that never loop (bursts) stay one-shot regardless of duration
+    auto& emitter = entityManager_.getComponent<ParticleEmitterComponent>(entity);
     emitter.duration = duration > 0 ? duration : 2.0f;
-    emitter.loop = (duration <= 0);
+    emitter.loop = emitter.loop && (duration <= 0);
+    
+    return entity;
+}
+
+PrefabId ParticleSystem::getEffectPrefab(ParticleEffectType type) {
+    const size_t index = static_cast<size_t>(type);
+    if (index >= kEffectTypeCount) {
+        return INVALID_PREFAB;
+    }
+    
+    PrefabId& id = effectPrefabs_[index];
+    if (id != INVALID_PREFAB) {
+        return id;
+    }
+    
+    ParticleEmitterComponent emitter;
+    emitter.effectType = type;
     
     switch (type) {
         case ParticleEffectType::Fireball: setupFireballEmitter(emitter); break;
@@ -183,7 +207,17 @@ Entity ParticleSystem::createEffect(ParticleEffectType type, const Vec3& positio
         default: break;
     }
     
-    return entity;
+    Prefab prefab("ParticleEffect_" + std::to_string(index));
+    prefab.withEntityName("ParticleEffect")
+          .with(TransformComponent())
+          .with(emitter)
+          .onInstantiate([](Registry& registry, Entity entity) {
+              // Size the particle pool up front instead of growing it while emitting
+              auto& instance = registry.get<ParticleEmitterComponent>(entity);
+              instance.particles.reserve(static_cast<size_t>(instance.maxParticles));
+          });
+    id = entityManager_.getPrefabs().add(std::move(prefab));
+    return id;
 }
 
 Entity ParticleSystem::createEffectAttached(ParticleEffectType type, Entity parent) {
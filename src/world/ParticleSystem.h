@@ -91,6 +91,7 @@ public:
     
     void update(f32 deltaTime) override;
     String getName() const override { return "ParticleSystem"; }
+    void declareAccess(SystemAccess& access) const override;
     
     // Create particle effects
     Entity createEffect(ParticleEffectType type, const Vec3& position, f32 duration = 0.0f);
@@ -120,6 +121,11 @@ public:
 private:
     EntityManager& entityManager_;
     
+    // Emitter prefab per effect type, preset applied once on first use
+    static constexpr size_t kEffectTypeCount = static_cast<size_t>(ParticleEffectType::Aura) + 1;
+    PrefabId getEffectPrefab(ParticleEffectType type);
+    PrefabId effectPrefabs_[kEffectTypeCount];
+    
     void updateEmitter(Entity entity, ParticleEmitterComponent& emitter, f32 deltaTime);
     void emitParticle(ParticleEmitterComponent& emitter, const Vec3& position);
     void updateParticle(Particle& p, f32 deltaTime);
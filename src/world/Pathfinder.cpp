@@ -0,0 +1,331 @@
+#include "Pathfinder.h"
+#include <cmath>
+#include <limits>
+
+namespace WorldEditor {
+
+namespace {
+
+constexpr f32 kDiagonalCost = 1.41421356f;
+constexpr i32 kSnapRadius = 8;     // Cells searched for walkable ground around start / goal
+
+constexpr i32 kNeighbourX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+constexpr i32 kNeighbourZ[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+f32 octile(i32 dx, i32 dz) {
+    dx = std::abs(dx);
+    dz = std::abs(dz);
+    return static_cast<f32>(dx + dz) + (kDiagonalCost - 2.0f) * static_cast<f32>(std::min(dx, dz));
+}
+
+} // namespace
+
+Pathfinder::Pathfinder(size_t cacheCapacity)
+    : cacheCapacity_(std::max<size_t>(cacheCapacity, 1)) {
+}
+
+void Pathfinder::clear() {
+    pending_.clear();
+    searchActive_ = false;
+    open_.clear();
+    cache_.clear();
+    cacheIndex_.clear();
+}
+
+bool Pathfinder::request(const NavGrid& grid, Entity agent, const Vec3& start, const Vec3& goal, Vector<Vec3>& outWaypoints) {
+    cancel(agent);
+    outWaypoints.clear();
+
+    // No terrain, or nowhere walkable near the agent: straight line as before
+    u32 startCell = 0;
+    u32 goalCell = 0;
+    if (grid.empty() || !resolveCells(grid, start, goal, startCell, goalCell)) {
+        outWaypoints.push_back(goal);
+        return true;
+    }
+    syncGrid(grid);
+
+    const i32 width = grid.getWidth();
+    if (grid.hasLineOfSight(static_cast<i32>(startCell) % width, static_cast<i32>(startCell) / width,
+                            static_cast<i32>(goalCell) % width, static_cast<i32>(goalCell) / width)) {
+        toWaypoints(grid, { startCell, goalCell }, goal, outWaypoints);
+        return true;
+    }
+
+    if (const CachedPath* cached = findCached(cacheKey(startCell, goalCell))) {
+        toWaypoints(grid, cached->cells, goal, outWaypoints);
+        return true;
+    }
+
+    pending_.push_back({ agent, start, goal });
+    return false;
+}
+
+void Pathfinder::cancel(Entity agent) {
+    pending_.erase(std::remove_if(pending_.begin(), pending_.end(),
+                                  [agent](const Request& request) { return request.agent == agent; }),
+                   pending_.end());
+    if (searchActive_ && active_.agent == agent) {
+        searchActive_ = false;
+    }
+}
+
+void Pathfinder::update(const NavGrid& grid, Vector<PathResult>& results) {
+    if (grid.empty()) {
+        // The terrain went away while searches were queued
+        searchActive_ = false;
+        for (const Request& request : pending_) {
+            results.push_back({ request.agent, request.goal, { request.goal }, true });
+        }
+        pending_.clear();
+        return;
+    }
+    syncGrid(grid);
+
+    u32 budget = searchBudget_;
+    while (budget > 0) {
+        if (!searchActive_) {
+            if (pending_.empty()) {
+                break;
+            }
+            const Request request = pending_.front();
+            pending_.pop_front();
+
+            PathResult result{ request.agent, request.goal, {}, true };
+            u32 startCell = 0;
+            u32 goalCell = 0;
+            if (!resolveCells(grid, request.start, request.goal, startCell, goalCell)) {
+                result.waypoints.push_back(request.goal);
+                results.push_back(std::move(result));
+                continue;
+            }
+            // An earlier search this tick may have produced the same pair
+            if (const CachedPath* cached = findCached(cacheKey(startCell, goalCell))) {
+                result.reachedGoal = toWaypoints(grid, cached->cells, request.goal, result.waypoints);
+                results.push_back(std::move(result));
+                continue;
+            }
+            beginSearch(request, startCell, goalCell);
+        }
+        expand(grid, budget, results);
+    }
+}
+
+void Pathfinder::syncGrid(const NavGrid& grid) {
+    if (gridVersion_ == grid.getVersion() && visited_.size() == static_cast<size_t>(grid.getWidth()) * grid.getHeight()) {
+        return;
+    }
+    gridVersion_ = grid.getVersion();
+
+    cache_.clear();
+    cacheIndex_.clear();
+
+    const size_t cellCount = static_cast<size_t>(grid.getWidth()) * static_cast<size_t>(grid.getHeight());
+    visited_.assign(cellCount, 0);
+    closed_.assign(cellCount, 0);
+    g_.assign(cellCount, 0.0f);
+    parent_.assign(cellCount, 0);
+    generation_ = 0;
+
+    // Restart the interrupted search on the new grid
+    if (searchActive_) {
+        searchActive_ = false;
+        pending_.push_front(active_);
+    }
+}
+
+void Pathfinder::beginSearch(const Request& request, u32 startCell, u32 goalCell) {
+    if (++generation_ == 0) {
+        std::fill(visited_.begin(), visited_.end(), 0u);
+        std::fill(closed_.begin(), closed_.end(), 0u);
+        generation_ = 1;
+    }
+
+    active_ = request;
+    activeStart_ = startCell;
+    activeGoal_ = goalCell;
+    searchActive_ = true;
+    ++cacheMisses_;
+
+    visited_[startCell] = generation_;
+    g_[startCell] = 0.0f;
+    parent_[startCell] = startCell;
+
+    bestCell_ = startCell;
+    bestH_ = std::numeric_limits<f32>::max();
+
+    open_.clear();
+    open_.push_back({ 0.0f, 0.0f, startCell });
+}
+
+void Pathfinder::expand(const NavGrid& grid, u32& budget, Vector<PathResult>& results) {
+    const i32 width = grid.getWidth();
+    const i32 goalX = static_cast<i32>(activeGoal_) % width;
+    const i32 goalZ = static_cast<i32>(activeGoal_) / width;
+
+    while (budget > 0 && !open_.empty()) {
+        std::pop_heap(open_.begin(), open_.end());
+        const OpenNode node = open_.back();
+        open_.pop_back();
+
+        if (closed_[node.cell] == generation_) {
+            continue;
+        }
+        closed_[node.cell] = generation_;
+        --budget;
+
+        const i32 x = static_cast<i32>(node.cell) % width;
+        const i32 z = static_cast<i32>(node.cell) / width;
+        const f32 h = octile(goalX - x, goalZ - z);
+        if (h < bestH_) {
+            bestH_ = h;
+            bestCell_ = node.cell;
+        }
+        if (node.cell == activeGoal_) {
+            finishSearch(grid, node.cell, results);
+            return;
+        }
+
+        for (i32 n = 0; n < 8; ++n) {
+            const i32 dx = kNeighbourX[n];
+            const i32 dz = kNeighbourZ[n];
+            if (!grid.isWalkable(x + dx, z + dz)) {
+                continue;
+            }
+            // No cutting corners past blocked cells
+            const bool diagonal = dx != 0 && dz != 0;
+            if (diagonal && (!grid.isWalkable(x + dx, z) || !grid.isWalkable(x, z + dz))) {
+                continue;
+            }
+
+            const u32 next = grid.index(x + dx, z + dz);
+            if (closed_[next] == generation_) {
+                continue;
+            }
+            const f32 g = g_[node.cell] + (diagonal ? kDiagonalCost : 1.0f);
+            if (visited_[next] == generation_ && g >= g_[next]) {
+                continue;
+            }
+            visited_[next] = generation_;
+            g_[next] = g;
+            parent_[next] = node.cell;
+
+            const f32 nextH = octile(goalX - x - dx, goalZ - z - dz);
+            open_.push_back({ g + nextH, nextH, next });
+            std::push_heap(open_.begin(), open_.end());
+        }
+    }
+
+    // Goal cut off: go as close as the search got
+    if (open_.empty()) {
+        finishSearch(grid, bestCell_, results);
+    }
+}
+
+void Pathfinder::finishSearch(const NavGrid& grid, u32 endCell, Vector<PathResult>& results) {
+    searchActive_ = false;
+    open_.clear();
+
+    Vector<u32> cells;
+    for (u32 cell = endCell; ; cell = parent_[cell]) {
+        cells.push_back(cell);
+        if (cell == activeStart_) {
+            break;
+        }
+    }
+    std::reverse(cells.begin(), cells.end());
+
+    const Vector<u32> smoothed = smooth(grid, cells);
+    storeCached(cacheKey(activeStart_, activeGoal_), smoothed);
+
+    PathResult result{ active_.agent, active_.goal, {}, false };
+    result.reachedGoal = toWaypoints(grid, smoothed, active_.goal, result.waypoints);
+    results.push_back(std::move(result));
+}
+
+Vector<u32> Pathfinder::smooth(const NavGrid& grid, const Vector<u32>& cells) const {
+    if (cells.size() <= 2) {
+        return cells;
+    }
+
+    // Keep a cell only where the straight line from the last kept one gets blocked
+    const i32 width = grid.getWidth();
+    auto visible = [&](u32 from, u32 to) {
+        return grid.hasLineOfSight(static_cast<i32>(from) % width, static_cast<i32>(from) / width,
+                                   static_cast<i32>(to) % width, static_cast<i32>(to) / width);
+    };
+
+    Vector<u32> out;
+    out.push_back(cells.front());
+    size_t anchor = 0;
+    for (size_t i = 2; i < cells.size(); ++i) {
+        if (!visible(cells[anchor], cells[i])) {
+            anchor = i - 1;
+            out.push_back(cells[anchor]);
+        }
+    }
+    out.push_back(cells.back());
+    return out;
+}
+
+bool Pathfinder::toWaypoints(const NavGrid& grid, const Vector<u32>& cells, const Vec3& goal, Vector<Vec3>& out) {
+    out.clear();
+    const i32 width = grid.getWidth();
+
+    i32 goalX = 0;
+    i32 goalZ = 0;
+    grid.worldToCell(goal, goalX, goalZ);
+    const bool reachedGoal = grid.isWalkable(goalX, goalZ) && cells.back() == grid.index(goalX, goalZ);
+
+    // The agent already stands in the first cell
+    for (size_t i = 1; i + 1 < cells.size(); ++i) {
+        out.push_back(grid.cellToWorld(static_cast<i32>(cells[i]) % width, static_cast<i32>(cells[i]) / width));
+    }
+    out.push_back(reachedGoal ? goal : grid.cellToWorld(static_cast<i32>(cells.back()) % width,
+                                                       static_cast<i32>(cells.back()) / width));
+    return reachedGoal;
+}
+
+bool Pathfinder::resolveCells(const NavGrid& grid, const Vec3& start, const Vec3& goal, u32& outStart, u32& outGoal) {
+    i32 startX = 0, startZ = 0, goalX = 0, goalZ = 0;
+    if (!grid.worldToCell(start, startX, startZ) || !grid.worldToCell(goal, goalX, goalZ)) {
+        return false;
+    }
+    if (!grid.findNearestWalkable(startX, startZ, kSnapRadius, startX, startZ)) {
+        return false;
+    }
+    // A goal with no walkable ground nearby stays put; the search then stops at the closest cell
+    grid.findNearestWalkable(goalX, goalZ, kSnapRadius, goalX, goalZ);
+
+    outStart = grid.index(startX, startZ);
+    outGoal = grid.index(goalX, goalZ);
+    return true;
+}
+
+const Pathfinder::CachedPath* Pathfinder::findCached(u64 key) {
+    auto it = cacheIndex_.find(key);
+    if (it == cacheIndex_.end()) {
+        return nullptr;
+    }
+    ++cacheHits_;
+    cache_.splice(cache_.begin(), cache_, it->second);
+    return &cache_.front();
+}
+
+void Pathfinder::storeCached(u64 key, const Vector<u32>& cells) {
+    auto it = cacheIndex_.find(key);
+    if (it != cacheIndex_.end()) {
+        it->second->cells = cells;
+        cache_.splice(cache_.begin(), cache_, it->second);
+        return;
+    }
+
+    cache_.push_front({ key, cells });
+    cacheIndex_[key] = cache_.begin();
+    if (cache_.size() > cacheCapacity_) {
+        cacheIndex_.erase(cache_.back().key);
+        cache_.pop_back();
+    }
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "core/Types.h"
+#include "NavGrid.h"
+#include <algorithm>
+#include <deque>
+#include <list>
+
+namespace WorldEditor {
+
+// Finished search for one agent: smoothed waypoints, the last one being the goal (or the
+// closest reachable point when the goal is cut off)
+struct PathResult {
+    Entity agent = INVALID_ENTITY;
+    Vec3 goal = Vec3(0.0f);             // As requested, to match against the agent's order
+    Vector<Vec3> waypoints;
+    bool reachedGoal = false;
+};
+
+// A* over a NavGrid (8-connected, no corner cutting, octile heuristic) with:
+// - a per-tick budget of expanded nodes; a search that runs out resumes next tick,
+// - string-pulling over grid line of sight so paths only turn at corners,
+// - an LRU cache of smoothed paths keyed by (start cell, goal cell), dropped whenever
+//   the grid is rebuilt.
+// One request per agent is kept; a new order replaces the pending one.
+class Pathfinder {
+public:
+    static constexpr u32 kDefaultSearchBudget = 4096;
+    static constexpr size_t kDefaultCacheCapacity = 64;
+
+    explicit Pathfinder(size_t cacheCapacity = kDefaultCacheCapacity);
+
+    // Answers at once (returns true and fills outWaypoints) when there is no grid, the
+    // goal is in plain sight or the cell pair is cached. Otherwise the search is queued
+    // and its result comes out of a later update().
+    bool request(const NavGrid& grid, Entity agent, const Vec3& start, const Vec3& goal, Vector<Vec3>& outWaypoints);
+    void cancel(Entity agent);
+
+    // Expands at most the search budget; appends finished paths to results
+    void update(const NavGrid& grid, Vector<PathResult>& results);
+
+    void setSearchBudget(u32 nodesPerTick) { searchBudget_ = std::max(nodesPerTick, 1u); }
+    u32 getSearchBudget() const { return searchBudget_; }
+
+    size_t getPendingCount() const { return pending_.size() + (searchActive_ ? 1 : 0); }
+    size_t getCacheSize() const { return cacheIndex_.size(); }
+    u64 getCacheHits() const { return cacheHits_; }
+    u64 getCacheMisses() const { return cacheMisses_; }
+
+    void clear();
+
+private:
+    struct Request {
+        Entity agent;
+        Vec3 start;
+        Vec3 goal;
+    };
+
+    struct OpenNode {
+        f32 f;
+        f32 h;
+        u32 cell;
+        // Min-heap order with deterministic ties (closer to the goal first)
+        bool operator<(const OpenNode& other) const {
+            if (f != other.f) return f > other.f;
+            if (h != other.h) return h > other.h;
+            return cell > other.cell;
+        }
+    };
+
+    struct CachedPath {
+        u64 key;
+        Vector<u32> cells;      // Smoothed, start cell first
+    };
+
+    void syncGrid(const NavGrid& grid);
+    void beginSearch(const Request& request, u32 startCell, u32 goalCell);
+    void expand(const NavGrid& grid, u32& budget, Vector<PathResult>& results);
+    void finishSearch(const NavGrid& grid, u32 endCell, Vector<PathResult>& results);
+
+    Vector<u32> smooth(const NavGrid& grid, const Vector<u32>& cells) const;
+    // Waypoints for a cell path; ends on the exact goal when the path reaches its cell
+    static bool toWaypoints(const NavGrid& grid, const Vector<u32>& cells, const Vec3& goal, Vector<Vec3>& out);
+    // Start and goal cells, moved onto walkable ground when needed
+    static bool resolveCells(const NavGrid& grid, const Vec3& start, const Vec3& goal, u32& outStart, u32& outGoal);
+    static u64 cacheKey(u32 startCell, u32 goalCell) { return (static_cast<u64>(startCell) << 32) | goalCell; }
+    const CachedPath* findCached(u64 key);
+    void storeCached(u64 key, const Vector<u32>& cells);
+
+    u32 searchBudget_ = kDefaultSearchBudget;
+    u32 gridVersion_ = 0;
+
+    std::deque<Request> pending_;
+
+    // Active search. Node state lives in grid-sized arrays stamped with the search
+    // generation, so starting a search never clears them.
+    bool searchActive_ = false;
+    Request active_{};
+    u32 activeStart_ = 0;
+    u32 activeGoal_ = 0;
+    u32 bestCell_ = 0;          // Closest to the goal so far, used if the goal is unreachable
+    f32 bestH_ = 0.0f;
+    u32 generation_ = 0;
+    Vector<u32> visited_;       // generation when g/parent were written
+    Vector<u32> closed_;        // generation when expanded
+    Vector<f32> g_;
+    Vector<u32> parent_;
+    Vector<OpenNode> open_;     // Binary heap
+
+    // LRU: most recently used at the front
+    size_t cacheCapacity_;
+    std::list<CachedPath> cache_;
+    Map<u64, std::list<CachedPath>::iterator> cacheIndex_;
+    u64 cacheHits_ = 0;
+    u64 cacheMisses_ = 0;
+};
+
+} // namespace WorldEditor
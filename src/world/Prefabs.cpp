@@ -0,0 +1,102 @@
+#include "Prefabs.h"
+#include "EntityManager.h"
+
+namespace WorldEditor {
+
+PrefabId PrefabLibrary::add(Prefab prefab) {
+    const PrefabId existing = find(prefab.getName());
+    if (existing != INVALID_PREFAB) {
+        prefabs_[existing] = std::move(prefab);
+        return existing;
+    }
+
+    prefabs_.push_back(std::move(prefab));
+    return static_cast<PrefabId>(prefabs_.size() - 1);
+}
+
+PrefabId PrefabLibrary::find(const String& name) const {
+    for (size_t i = 0; i < prefabs_.size(); ++i) {
+        if (prefabs_[i].getName() == name) {
+            return static_cast<PrefabId>(i);
+        }
+    }
+    return INVALID_PREFAB;
+}
+
+Entity PrefabLibrary::instantiate(PrefabId id) {
+    Entity entity = INVALID_ENTITY;
+    instantiate(id, &entity, 1);
+    return entity;
+}
+
+bool PrefabLibrary::instantiate(PrefabId id, Entity* out, size_t count) {
+    if (!isValid(id)) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+
+    Prefab& prefab = prefabs_[id];
+    auto& registry = entityManager_.getRegistry();
+    registry.create(out, out + count);
+    registry.insert<NameComponent>(out, out + count, NameComponent(prefab.getEntityName()));
+    emplace(prefab, out, out + count);
+    return true;
+}
+
+bool PrefabLibrary::applyTo(PrefabId id, Entity entity) {
+    if (!isValid(id) || !entityManager_.isValid(entity)) {
+        return false;
+    }
+
+    emplace(prefabs_[id], &entity, &entity + 1);
+    return true;
+}
+
+void PrefabLibrary::reserve(PrefabId id, size_t count) {
+    if (!isValid(id)) {
+        return;
+    }
+
+    auto& registry = entityManager_.getRegistry();
+    auto& names = registry.storage<NameComponent>();
+    names.reserve(names.size() + count);
+    for (const auto& component : prefabs_[id].components_) {
+        component.reserve(registry, count);
+    }
+}
+
+void PrefabLibrary::emplace(Prefab& prefab, const Entity* first, const Entity* last) {
+    auto& registry = entityManager_.getRegistry();
+    for (const auto& component : prefab.components_) {
+        component.insert(registry, first, last);
+    }
+
+    if (prefab.material_) {
+        const Entity material = getMaterialEntity(prefab);
+        for (const Entity* it = first; it != last; ++it) {
+            if (auto* mesh = registry.try_get<MeshComponent>(*it)) {
+                mesh->materialEntity = material;
+            }
+        }
+    }
+
+    if (prefab.init_) {
+        for (const Entity* it = first; it != last; ++it) {
+            prefab.init_(registry, *it);
+        }
+    }
+}
+
+Entity PrefabLibrary::getMaterialEntity(Prefab& prefab) {
+    // The world may have been cleared since the material was created
+    if (!entityManager_.isValid(prefab.materialEntity_) ||
+        !entityManager_.hasComponent<MaterialComponent>(prefab.materialEntity_)) {
+        prefab.materialEntity_ = entityManager_.createEntity(prefab.material_->name);
+        entityManager_.addComponent<MaterialComponent>(prefab.materialEntity_, *prefab.material_);
+    }
+    return prefab.materialEntity_;
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+#include <functional>
+#include <memory>
+
+namespace WorldEditor {
+
+class EntityManager;
+
+using PrefabId = u32;
+constexpr PrefabId INVALID_PREFAB = ~0u;
+
+// Pre-built component set for one kind of spawned entity (creep type, projectile kind,
+// effect type). Components are built once, including mesh geometry, and copied into
+// the registry on instantiation. A prefab with a material shares one material entity
+// between all of its instances instead of creating one per spawn.
+class Prefab {
+public:
+    explicit Prefab(const String& name) : name_(name) {}
+
+    // Adds (or replaces) the template for Component
+    template<typename Component>
+    Prefab& with(Component component) {
+        auto value = std::make_shared<const Component>(std::move(component));
+        ComponentTemplate entry;
+        entry.type = entt::type_hash<Component>::value();
+        entry.insert = [value](Registry& registry, const Entity* first, const Entity* last) {
+            registry.insert<Component>(first, last, *value);
+        };
+        entry.reserve = [](Registry& registry, size_t count) {
+            auto& storage = registry.storage<Component>();
+            storage.reserve(storage.size() + count);
+        };
+
+        for (auto& existing : components_) {
+            if (existing.type == entry.type) {
+                existing = std::move(entry);
+                return *this;
+            }
+        }
+        components_.push_back(std::move(entry));
+        return *this;
+    }
+
+    // Material shared by every instance's MeshComponent
+    Prefab& withMaterial(const MaterialComponent& material) {
+        material_ = std::make_shared<MaterialComponent>(material);
+        return *this;
+    }
+
+    // Name given to instances (defaults to the prefab name, which must be unique)
+    Prefab& withEntityName(const String& entityName) {
+        entityName_ = entityName;
+        return *this;
+    }
+
+    // Runs per instance after the components are copied (e.g. to reserve buffers)
+    Prefab& onInstantiate(std::function<void(Registry&, Entity)> init) {
+        init_ = std::move(init);
+        return *this;
+    }
+
+    const String& getName() const { return name_; }
+    const String& getEntityName() const { return entityName_.empty() ? name_ : entityName_; }
+
+private:
+    friend class PrefabLibrary;
+
+    struct ComponentTemplate {
+        entt::id_type type = 0;
+        std::function<void(Registry&, const Entity*, const Entity*)> insert;
+        std::function<void(Registry&, size_t)> reserve;
+    };
+
+    String name_;
+    String entityName_;
+    Vector<ComponentTemplate> components_;
+    std::shared_ptr<MaterialComponent> material_;
+    std::function<void(Registry&, Entity)> init_;
+    Entity materialEntity_ = INVALID_ENTITY;    // Created on first use, recreated after a world clear
+};
+
+// Prefabs of one world, registered by the systems that spawn them. Registering a name
+// again replaces the prefab under the same id. Instances are created in bulk: entities
+// first, then one storage insert per component.
+class PrefabLibrary {
+public:
+    explicit PrefabLibrary(EntityManager& entityManager) : entityManager_(entityManager) {}
+
+    PrefabId add(Prefab prefab);
+    PrefabId find(const String& name) const;
+    bool isValid(PrefabId id) const { return id < prefabs_.size(); }
+    size_t size() const { return prefabs_.size(); }
+
+    // Returns INVALID_ENTITY for an unknown prefab
+    Entity instantiate(PrefabId id);
+    // Fills out[0..count); returns false (and creates nothing) for an unknown prefab
+    bool instantiate(PrefabId id, Entity* out, size_t count);
+    // Copies the prefab's components onto an existing entity (deferred creates)
+    bool applyTo(PrefabId id, Entity entity);
+
+    // Pre-warm: grow the storages of the prefab's components by count so the next
+    // count instances don't reallocate them
+    void reserve(PrefabId id, size_t count);
+
+private:
+    void emplace(Prefab& prefab, const Entity* first, const Entity* last);
+    Entity getMaterialEntity(Prefab& prefab);
+
+    EntityManager& entityManager_;
+    Vector<Prefab> prefabs_;
+};
+
+} // namespace WorldEditor
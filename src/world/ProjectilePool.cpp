@@ -0,0 +1,205 @@
+#include "ProjectilePool.h"
+#include "EntityManager.h"
+#include <cmath>
+
+namespace WorldEditor {
+
+void ProjectilePool::spawn(const ProjectileSpawn& spawn) {
+    posX_.push_back(spawn.position.x);
+    posY_.push_back(spawn.position.y);
+    posZ_.push_back(spawn.position.z);
+    // Aim at the spawn point until the first gather
+    targetX_.push_back(spawn.position.x);
+    targetY_.push_back(spawn.position.y);
+    targetZ_.push_back(spawn.position.z);
+    speed_.push_back(spawn.speed);
+    hitRadius_.push_back(spawn.hitRadius);
+    life_.push_back(0.0f);
+    maxLife_.push_back(spawn.maxLife);
+    state_.push_back(Flying);
+
+    attacker_.push_back(spawn.attacker);
+    target_.push_back(spawn.target);
+    damage_.push_back(spawn.damage);
+    teamId_.push_back(spawn.teamId);
+    isTower_.push_back(spawn.isTower ? 1 : 0);
+    visualPrefab_.push_back(spawn.visual);
+    visual_.push_back(INVALID_ENTITY);
+}
+
+size_t ProjectilePool::update(f32 deltaTime) {
+    if (empty()) {
+        return 0;
+    }
+
+    gatherTargets();
+    integrate(deltaTime);
+
+    // Hits go to the combat stage in slot order, before any slot moves
+    auto& combat = entityManager_.getCombatEvents();
+    size_t hits = 0;
+    for (size_t i = 0; i < size(); ++i) {
+        if (state_[i] == Hit) {
+            combat.damage(attacker_[i], target_[i], damage_[i], DamageType::Physical);
+            ++hits;
+        }
+    }
+
+    // Back to front, so the slot swapped in has already been looked at
+    for (size_t i = size(); i-- > 0;) {
+        if (state_[i] != Flying) {
+            removeAt(i);
+        }
+    }
+
+    if (visualsEnabled_) {
+        syncVisuals();
+    }
+    return hits;
+}
+
+void ProjectilePool::gatherTargets() {
+    auto& registry = entityManager_.getRegistry();
+    for (size_t i = 0; i < size(); ++i) {
+        const TransformComponent* target = entityManager_.isValid(target_[i])
+            ? registry.try_get<TransformComponent>(target_[i])
+            : nullptr;
+        if (!target) {
+            state_[i] = Lost;
+            continue;
+        }
+        targetX_[i] = target->position.x;
+        targetY_[i] = target->position.y;
+        targetZ_[i] = target->position.z;
+    }
+}
+
+void ProjectilePool::integrate(f32 deltaTime) {
+    const size_t count = size();
+    f32* px = posX_.data();
+    f32* py = posY_.data();
+    f32* pz = posZ_.data();
+    const f32* tx = targetX_.data();
+    const f32* ty = targetY_.data();
+    const f32* tz = targetZ_.data();
+    const f32* speed = speed_.data();
+    const f32* hitRadius = hitRadius_.data();
+    const f32* maxLife = maxLife_.data();
+    f32* life = life_.data();
+    u8* state = state_.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        const f32 dx = tx[i] - px[i];
+        const f32 dy = ty[i] - py[i];
+        const f32 dz = tz[i] - pz[i];
+        const f32 distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const f32 step = speed[i] * deltaTime;
+
+        // Don't overshoot the target
+        const f32 t = distance > step ? step / distance : 1.0f;
+        px[i] += dx * t;
+        py[i] += dy * t;
+        pz[i] += dz * t;
+
+        life[i] += deltaTime;
+        const u8 expired = life[i] >= maxLife[i] ? Expired : Flying;
+        const u8 hit = distance - step <= hitRadius[i] ? Hit : Flying;
+        const u8 next = expired != Flying ? expired : hit;
+        state[i] = state[i] != Flying ? state[i] : next;
+    }
+}
+
+void ProjectilePool::syncVisuals() {
+    auto& registry = entityManager_.getRegistry();
+    auto& prefabs = entityManager_.getPrefabs();
+    for (size_t i = 0; i < size(); ++i) {
+        if (visual_[i] == INVALID_ENTITY) {
+            if (!prefabs.isValid(visualPrefab_[i])) {
+                continue;
+            }
+            visual_[i] = prefabs.instantiate(visualPrefab_[i]);
+        }
+
+        auto* transform = registry.try_get<TransformComponent>(visual_[i]);
+        if (!transform) {
+            continue;
+        }
+        transform->position = getPosition(i);
+
+        // Face the flight direction
+        const f32 dx = targetX_[i] - posX_[i];
+        const f32 dz = targetZ_[i] - posZ_[i];
+        if (dx * dx + dz * dz > 1e-6f) {
+            transform->rotation = glm::angleAxis(std::atan2(dx, dz), Vec3(0, 1, 0));
+        }
+    }
+}
+
+void ProjectilePool::removeAt(size_t index) {
+    if (visual_[index] != INVALID_ENTITY && entityManager_.isValid(visual_[index])) {
+        entityManager_.destroyEntity(visual_[index]);
+    }
+
+    auto swapRemove = [index](auto& values) {
+        values[index] = values.back();
+        values.pop_back();
+    };
+    swapRemove(posX_);
+    swapRemove(posY_);
+    swapRemove(posZ_);
+    swapRemove(targetX_);
+    swapRemove(targetY_);
+    swapRemove(targetZ_);
+    swapRemove(speed_);
+    swapRemove(hitRadius_);
+    swapRemove(life_);
+    swapRemove(maxLife_);
+    swapRemove(state_);
+    swapRemove(attacker_);
+    swapRemove(target_);
+    swapRemove(damage_);
+    swapRemove(teamId_);
+    swapRemove(isTower_);
+    swapRemove(visualPrefab_);
+    swapRemove(visual_);
+}
+
+void ProjectilePool::reserve(size_t count) {
+    auto reserveAll = [count](auto&... values) {
+        (values.reserve(count), ...);
+    };
+    reserveAll(posX_, posY_, posZ_, targetX_, targetY_, targetZ_, speed_, hitRadius_, life_,
+               maxLife_, state_, attacker_, target_, damage_, teamId_, isTower_, visualPrefab_, visual_);
+}
+
+void ProjectilePool::clear() {
+    for (Entity visual : visual_) {
+        if (visual != INVALID_ENTITY && entityManager_.isValid(visual)) {
+            entityManager_.destroyEntity(visual);
+        }
+    }
+
+    auto clearAll = [](auto&... values) {
+        (values.clear(), ...);
+    };
+    clearAll(posX_, posY_, posZ_, targetX_, targetY_, targetZ_, speed_, hitRadius_, life_,
+             maxLife_, state_, attacker_, target_, damage_, teamId_, isTower_, visualPrefab_, visual_);
+}
+
+void ProjectilePool::setVisualsEnabled(bool enabled) {
+    if (visualsEnabled_ == enabled) {
+        return;
+    }
+    visualsEnabled_ = enabled;
+
+    if (!enabled) {
+        for (Entity& visual : visual_) {
+            if (visual != INVALID_ENTITY && entityManager_.isValid(visual)) {
+                entityManager_.destroyEntity(visual);
+            }
+            visual = INVALID_ENTITY;
+        }
+    }
+}
+
+} // namespace WorldEditor
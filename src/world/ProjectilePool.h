@@ -0,0 +1,91 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Prefabs.h"
+
+namespace WorldEditor {
+
+class EntityManager;
+
+// Parameters of one homing projectile (creep and tower attacks)
+struct ProjectileSpawn {
+    Entity attacker = INVALID_ENTITY;   // Gets the kill credit
+    Entity target = INVALID_ENTITY;
+    Vec3 position = Vec3(0.0f);
+    i32 teamId = 0;
+    f32 speed = 80.0f;                  // World units per second
+    f32 hitRadius = 1.0f;               // How close is considered a hit
+    f32 damage = 0.0f;                  // Physical damage applied on hit
+    f32 maxLife = 5.0f;
+    bool isTower = false;
+    PrefabId visual = INVALID_PREFAB;   // Mesh + material shown on clients
+};
+
+// Homing projectiles kept as parallel arrays instead of entities. One update gathers
+// target positions, moves every projectile in a single branch-free loop, records hits
+// as Physical damage in the combat stage, then swap-removes spent slots.
+//
+// Render entities are only created when visuals are enabled (client and editor
+// worlds); a headless server never touches the registry for projectiles. Not
+// thread-safe: spawning systems are structural and run serially.
+class ProjectilePool {
+public:
+    explicit ProjectilePool(EntityManager& entityManager) : entityManager_(entityManager) {}
+
+    void spawn(const ProjectileSpawn& spawn);
+
+    // Returns the number of hits recorded
+    size_t update(f32 deltaTime);
+
+    void reserve(size_t count);
+    // Drops every projectile and destroys their render entities
+    void clear();
+
+    size_t size() const { return attacker_.size(); }
+    bool empty() const { return attacker_.empty(); }
+
+    void setVisualsEnabled(bool enabled);
+    bool getVisualsEnabled() const { return visualsEnabled_; }
+
+    Vec3 getPosition(size_t index) const { return Vec3(posX_[index], posY_[index], posZ_[index]); }
+    Entity getTarget(size_t index) const { return target_[index]; }
+    i32 getTeamId(size_t index) const { return teamId_[index]; }
+    bool isTower(size_t index) const { return isTower_[index] != 0; }
+    Entity getVisual(size_t index) const { return visual_[index]; }
+
+private:
+    enum State : u8 {
+        Flying = 0,
+        Hit,
+        Expired,
+        Lost        // Target died or was destroyed
+    };
+
+    void gatherTargets();
+    void integrate(f32 deltaTime);
+    void syncVisuals();
+    void removeAt(size_t index);
+
+    EntityManager& entityManager_;
+    bool visualsEnabled_ = false;
+
+    // Hot data, read and written every tick by integrate()
+    Vector<f32> posX_, posY_, posZ_;
+    Vector<f32> targetX_, targetY_, targetZ_;
+    Vector<f32> speed_;
+    Vector<f32> hitRadius_;
+    Vector<f32> life_;
+    Vector<f32> maxLife_;
+    Vector<u8> state_;
+
+    // Cold data, touched on spawn, hit and visual sync
+    Vector<Entity> attacker_;
+    Vector<Entity> target_;
+    Vector<f32> damage_;
+    Vector<i32> teamId_;
+    Vector<u8> isTower_;
+    Vector<PrefabId> visualPrefab_;
+    Vector<Entity> visual_;
+};
+
+} // namespace WorldEditor
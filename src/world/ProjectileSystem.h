@@ -14,25 +14,17 @@ public:
 
     void update(f32 deltaTime) override;
     String getName() const override { return "ProjectileSystem"; }
+    void declareAccess(SystemAccess& access) const override;
 
-    // Create projectile for ranged attacks
-    Entity createProjectile(Entity attacker, Entity target, f32 damage, bool isTower = false);
+    // Fire a homing projectile into the pool; false if attacker or target has no position
+    bool createProjectile(Entity attacker, Entity target, f32 damage, bool isTower = false);
 
 private:
     EntityManager& entityManager_;
     
-    // Projectile movement and collision
-    void updateProjectileMovement(Entity entity, ProjectileComponent& projectile, TransformComponent& transform, f32 deltaTime);
-    void checkProjectileHit(Entity entity, ProjectileComponent& projectile, const Vec3& position);
-    
-    // Damage application
-    void applyProjectileDamage(Entity projectile, Entity target, f32 damage);
-    
-    // Cleanup
-    void cleanupExpiredProjectiles();
-    
-    // Visual effects
-    void createHitEffect(const Vec3& position, i32 teamId);
+    // Render prefab per [creep, tower][Radiant, Dire], built on first use
+    PrefabId getProjectilePrefab(bool isTower, i32 teamId);
+    PrefabId projectilePrefabs_[2][2] = { { INVALID_PREFAB, INVALID_PREFAB }, { INVALID_PREFAB, INVALID_PREFAB } };
 };
 
 } // namespace WorldEditor
\ No newline at end of file
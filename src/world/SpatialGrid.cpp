@@ -0,0 +1,146 @@
+#include "SpatialGrid.h"
+#include "Components.h"
+#include "HeroSystem.h"
+#include "core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WorldEditor {
+
+namespace {
+
+bool hitLess(const SpatialHit& a, const SpatialHit& b) {
+    if (a.distance != b.distance) {
+        return a.distance < b.distance;
+    }
+    return a.entity < b.entity;
+}
+
+} // namespace
+
+SpatialGrid::SpatialGrid(f32 cellSize) {
+    setCellSize(cellSize);
+}
+
+void SpatialGrid::setCellSize(f32 cellSize) {
+    cellSize_ = std::max(cellSize, 1.0f);
+    invCellSize_ = 1.0f / cellSize_;
+    queryPadding_ = cellSize_ * 0.5f;
+}
+
+void SpatialGrid::clear() {
+    entries_.clear();
+    // Keep bucket storage around, only empty it
+    for (auto& [key, bucket] : cells_) {
+        bucket.clear();
+    }
+    maxEntryRadius_ = 0.0f;
+    registry_ = nullptr;
+}
+
+void SpatialGrid::rebuild(const Registry& registry) {
+    PROFILE_SCOPE("SpatialGrid::rebuild");
+    clear();
+    registry_ = &registry;
+
+    auto view = registry.view<TransformComponent>();
+    for (auto entity : view) {
+        Entry entry{entity, 0, 0u, 0.0f};
+
+        if (const auto* creep = registry.try_get<CreepComponent>(entity)) {
+            entry.type = SpatialType::Creep;
+            entry.teamId = creep->teamId;
+        } else if (const auto* hero = registry.try_get<HeroComponent>(entity)) {
+            entry.type = SpatialType::Hero;
+            entry.teamId = hero->teamId;
+        } else if (const auto* obj = registry.try_get<ObjectComponent>(entity);
+                   obj && obj->type == ObjectType::Tower) {
+            entry.type = SpatialType::Tower;
+            entry.teamId = obj->teamId;
+        }
+
+        if (const auto* col = registry.try_get<CollisionComponent>(entity)) {
+            entry.radius = col->getBoundingRadius() + glm::length(col->offset);
+            if (entry.type == 0u) {
+                entry.type = SpatialType::Collider;
+            }
+        }
+
+        if (entry.type == 0u) {
+            continue;
+        }
+
+        Cell cell = cellOf(view.get<TransformComponent>(entity).position);
+        cells_[cellKey(cell.x, cell.z)].push_back(static_cast<u32>(entries_.size()));
+        entries_.push_back(entry);
+        maxEntryRadius_ = std::max(maxEntryRadius_, entry.radius);
+    }
+}
+
+void SpatialGrid::queryRadius(const Vec3& center, f32 radius, const SpatialFilter& filter,
+                              Vector<SpatialHit>& out) const {
+    out.clear();
+    forEachInRadius(center, radius, filter, [&](Entity entity, f32 dist) {
+        out.push_back({entity, dist});
+    });
+    std::sort(out.begin(), out.end(), hitLess);
+}
+
+void SpatialGrid::queryKNearest(const Vec3& center, f32 radius, size_t k, const SpatialFilter& filter,
+                                Vector<SpatialHit>& out) const {
+    out.clear();
+    if (k == 0) {
+        return;
+    }
+
+    // Bounded insertion: keep the k best hits sorted, k is small in practice
+    forEachInRadius(center, radius, filter, [&](Entity entity, f32 dist) {
+        SpatialHit hit{entity, dist};
+        if (out.size() == k && !hitLess(hit, out.back())) {
+            return;
+        }
+        auto pos = std::upper_bound(out.begin(), out.end(), hit, hitLess);
+        out.insert(pos, hit);
+        if (out.size() > k) {
+            out.pop_back();
+        }
+    });
+}
+
+SpatialGrid::Cell SpatialGrid::cellOf(const Vec3& position) const {
+    Cell cell;
+    cell.x = static_cast<i32>(std::floor(position.x * invCellSize_));
+    cell.z = static_cast<i32>(std::floor(position.z * invCellSize_));
+    return cell;
+}
+
+u64 SpatialGrid::cellKey(i32 x, i32 z) {
+    return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u32>(z);
+}
+
+bool SpatialGrid::passes(const Entry& entry, const SpatialFilter& filter) const {
+    if ((entry.type & filter.typeMask) == 0u) {
+        return false;
+    }
+    if (entry.entity == filter.ignore) {
+        return false;
+    }
+    if (filter.excludeTeam >= 0 && entry.teamId == filter.excludeTeam) {
+        return false;
+    }
+    if (filter.onlyTeam >= 0 && entry.teamId != filter.onlyTeam) {
+        return false;
+    }
+    return true;
+}
+
+const Vec3* SpatialGrid::livePosition(Entity entity) const {
+    // Entities destroyed since the last rebuild are skipped
+    if (!registry_->valid(entity)) {
+        return nullptr;
+    }
+    const auto* transform = registry_->try_get<TransformComponent>(entity);
+    return transform ? &transform->position : nullptr;
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "core/Types.h"
+
+namespace WorldEditor {
+
+// Unit categories indexed by SpatialGrid (combine into a query type mask)
+namespace SpatialType {
+    constexpr u32 Creep    = 1u << 0;
+    constexpr u32 Hero     = 1u << 1;
+    constexpr u32 Tower    = 1u << 2;
+    constexpr u32 Collider = 1u << 3;   // Any other entity with a CollisionComponent
+
+    constexpr u32 Units    = Creep | Hero | Tower;
+    constexpr u32 All      = Units | Collider;
+}
+
+// Filter applied to every spatial query
+struct SpatialFilter {
+    u32 typeMask = SpatialType::Units;
+    i32 excludeTeam = -1;               // Skip entries of this team (enemy-only queries)
+    i32 onlyTeam = -1;                  // Keep only entries of this team (ally-only queries)
+    Entity ignore = INVALID_ENTITY;     // Usually the querying entity itself
+    bool useExtents = false;            // Treat entries as spheres of their collision radius
+
+    static SpatialFilter enemiesOf(i32 teamId, u32 typeMask = SpatialType::Units) {
+        SpatialFilter filter;
+        filter.typeMask = typeMask;
+        filter.excludeTeam = teamId;
+        return filter;
+    }
+};
+
+struct SpatialHit {
+    Entity entity = INVALID_ENTITY;
+    f32 distance = 0.0f;
+};
+
+// Uniform grid over the XZ plane used for unit proximity queries.
+// Rebuilt once per simulation tick (ServerWorld::updateSystems) from TransformComponent.
+// Buckets use tick-start positions; distance tests use the live transform, so units
+// that moved during the tick are still reported correctly as long as they stayed
+// within the query padding. Entities created mid-tick show up on the next rebuild.
+class SpatialGrid {
+public:
+    explicit SpatialGrid(f32 cellSize = 32.0f);
+
+    // Cell size should be close to the typical query radius (aggro / attack range)
+    void setCellSize(f32 cellSize);
+    f32 getCellSize() const { return cellSize_; }
+
+    // Extra distance added to query bounds to cover movement since the last rebuild
+    void setQueryPadding(f32 padding) { queryPadding_ = padding; }
+    f32 getQueryPadding() const { return queryPadding_; }
+
+    // Re-bucket every creep, hero, tower and collider in the registry
+    void rebuild(const Registry& registry);
+    void clear();
+
+    size_t size() const { return entries_.size(); }
+    bool isBuilt() const { return registry_ != nullptr; }
+
+    // All matching entities within radius, sorted by distance (ties by entity id)
+    void queryRadius(const Vec3& center, f32 radius, const SpatialFilter& filter,
+                     Vector<SpatialHit>& out) const;
+
+    // Up to k closest matching entities within radius, sorted by distance
+    void queryKNearest(const Vec3& center, f32 radius, size_t k, const SpatialFilter& filter,
+                       Vector<SpatialHit>& out) const;
+
+    // Closest matching entity within radius accepted by the predicate, or INVALID_ENTITY.
+    // Predicate signature: bool(Entity). Use it for state checks (dead, invisible, ...).
+    template<typename Pred>
+    Entity findNearest(const Vec3& center, f32 radius, const SpatialFilter& filter, Pred&& pred) const {
+        Entity nearest = INVALID_ENTITY;
+        f32 nearestDist = radius;
+        forEachCandidate(center, radius, filter, [&](Entity entity, f32 dist, f32) {
+            if (dist > nearestDist) return;
+            if (dist == nearestDist && (nearest == INVALID_ENTITY || entity > nearest)) return;
+            if (!pred(entity)) return;
+            nearest = entity;
+            nearestDist = dist;
+        });
+        return nearest;
+    }
+
+    Entity findNearest(const Vec3& center, f32 radius, const SpatialFilter& filter) const {
+        return findNearest(center, radius, filter, [](Entity) { return true; });
+    }
+
+    // Visit every matching entity within radius (unordered).
+    // Func signature: void(Entity entity, f32 distance)
+    template<typename Func>
+    void forEachInRadius(const Vec3& center, f32 radius, const SpatialFilter& filter, Func&& func) const {
+        forEachCandidate(center, radius, filter, [&](Entity entity, f32 dist, f32 extent) {
+            if (dist - extent <= radius) {
+                func(entity, dist);
+            }
+        });
+    }
+
+private:
+    struct Entry {
+        Entity entity;
+        i32 teamId;
+        u32 type;
+        f32 radius;     // Bounding radius of the CollisionComponent (0 if none)
+    };
+
+    struct Cell {
+        i32 x = 0;
+        i32 z = 0;
+    };
+
+    Cell cellOf(const Vec3& position) const;
+    static u64 cellKey(i32 x, i32 z);
+    bool passes(const Entry& entry, const SpatialFilter& filter) const;
+    const Vec3* livePosition(Entity entity) const;
+
+    // Visits entries whose cells overlap the padded query bounds.
+    // Func signature: void(Entity entity, f32 centerDistance, f32 extent)
+    template<typename Func>
+    void forEachCandidate(const Vec3& center, f32 radius, const SpatialFilter& filter, Func&& func) const {
+        if (!registry_ || entries_.empty()) {
+            return;
+        }
+
+        const f32 reach = radius + queryPadding_ + (filter.useExtents ? maxEntryRadius_ : 0.0f);
+        const Cell minCell = cellOf(center - Vec3(reach));
+        const Cell maxCell = cellOf(center + Vec3(reach));
+
+        for (i32 z = minCell.z; z <= maxCell.z; ++z) {
+            for (i32 x = minCell.x; x <= maxCell.x; ++x) {
+                auto it = cells_.find(cellKey(x, z));
+                if (it == cells_.end()) {
+                    continue;
+                }
+                for (u32 index : it->second) {
+                    const Entry& entry = entries_[index];
+                    if (!passes(entry, filter)) {
+                        continue;
+                    }
+                    const Vec3* position = livePosition(entry.entity);
+                    if (!position) {
+                        continue;
+                    }
+                    f32 dist = glm::length(*position - center);
+                    func(entry.entity, dist, filter.useExtents ? entry.radius : 0.0f);
+                }
+            }
+        }
+    }
+
+    f32 cellSize_;
+    f32 invCellSize_;
+    f32 queryPadding_;
+    f32 maxEntryRadius_ = 0.0f;
+
+    const Registry* registry_ = nullptr;
+    Vector<Entry> entries_;
+    Map<u64, Vector<u32>> cells_;   // Cell key -> indices into entries_
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,54 @@
+#include "StaticColliderGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WorldEditor {
+
+StaticColliderGrid::StaticColliderGrid(f32 cellSize)
+    : cellSize_(std::max(cellSize, 1.0f))
+    , invCellSize_(1.0f / std::max(cellSize, 1.0f)) {
+}
+
+void StaticColliderGrid::clear() {
+    cells_.clear();
+    oversized_.clear();
+    maxCellRadius_ = 0.0f;
+    entryCount_ = 0;
+}
+
+void StaticColliderGrid::build(const Registry& registry) {
+    clear();
+
+    auto view = registry.view<CollisionComponent, TransformComponent>();
+    for (auto entity : view) {
+        const auto& col = view.get<CollisionComponent>(entity);
+        if (!col.isStatic || col.isTrigger || !col.blocksMovement) {
+            continue;
+        }
+
+        Entry entry{entity, view.get<TransformComponent>(entity).position + col.offset, col.getBoundingRadius()};
+        ++entryCount_;
+
+        // Buildings / bases bigger than a cell would widen every query; keep them aside
+        if (entry.radius > cellSize_) {
+            oversized_.push_back(entry);
+            continue;
+        }
+
+        cells_[cellKey(cellCoord(entry.center.x), cellCoord(entry.center.z))].push_back(entry);
+        maxCellRadius_ = std::max(maxCellRadius_, entry.radius);
+    }
+
+    LOG_DEBUG("StaticColliderGrid built: {} colliders, {} cells, {} oversized",
+             entryCount_, cells_.size(), oversized_.size());
+}
+
+i32 StaticColliderGrid::cellCoord(f32 v) const {
+    return static_cast<i32>(std::floor(v * invCellSize_));
+}
+
+u64 StaticColliderGrid::cellKey(i32 x, i32 z) {
+    return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u32>(z);
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+
+namespace WorldEditor {
+
+// Broadphase for static blockers (trees, rocks, buildings, towers).
+// Static colliders never move after map load, so the grid is built once and only rebuilt
+// when EntityManager reports a new static collider revision (editor add/remove/move).
+// Each collider is bucketed by its center; colliders larger than a cell go to an
+// overflow list that every query checks.
+class StaticColliderGrid {
+public:
+    explicit StaticColliderGrid(f32 cellSize = 256.0f);
+
+    // Collect every static, blocking, non-trigger collider from the registry
+    void build(const Registry& registry);
+    void clear();
+
+    size_t size() const { return entryCount_; }
+
+    // Visit colliders whose bounds may overlap the sphere (center, radius).
+    // Func signature: bool(Entity entity). Return true to stop the query early.
+    template<typename Func>
+    bool forEachCandidate(const Vec3& center, f32 radius, Func&& func) const {
+        for (const Entry& entry : oversized_) {
+            if (overlaps(entry, center, radius) && func(entry.entity)) {
+                return true;
+            }
+        }
+
+        const f32 reach = radius + maxCellRadius_;
+        const i32 minX = cellCoord(center.x - reach);
+        const i32 maxX = cellCoord(center.x + reach);
+        const i32 minZ = cellCoord(center.z - reach);
+        const i32 maxZ = cellCoord(center.z + reach);
+
+        for (i32 z = minZ; z <= maxZ; ++z) {
+            for (i32 x = minX; x <= maxX; ++x) {
+                auto it = cells_.find(cellKey(x, z));
+                if (it == cells_.end()) {
+                    continue;
+                }
+                for (const Entry& entry : it->second) {
+                    if (overlaps(entry, center, radius) && func(entry.entity)) {
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Entry {
+        Entity entity;
+        Vec3 center;    // Transform position + collider offset
+        f32 radius;
+    };
+
+    static bool overlaps(const Entry& entry, const Vec3& center, f32 radius) {
+        const f32 dx = entry.center.x - center.x;
+        const f32 dz = entry.center.z - center.z;
+        const f32 reach = entry.radius + radius;
+        return dx * dx + dz * dz <= reach * reach;
+    }
+
+    i32 cellCoord(f32 v) const;
+    static u64 cellKey(i32 x, i32 z);
+
+    f32 cellSize_;
+    f32 invCellSize_;
+    f32 maxCellRadius_ = 0.0f;      // Largest radius among bucketed (non-oversized) entries
+    size_t entryCount_ = 0;
+
+    Map<u64, Vector<Entry>> cells_;
+    Vector<Entry> oversized_;
+};
+
+} // namespace WorldEditor
@@ -4,11 +4,57 @@
 
 namespace WorldEditor {
 
+using ComponentTypeId = entt::id_type;
+
+// What a system touches during update(), used by SystemScheduler to order systems
+// and to decide which ones may run concurrently.
+struct SystemAccess {
+    Vector<ComponentTypeId> reads;
+    Vector<ComponentTypeId> writes;
+    Vector<String> runAfter;        // Names of systems that must update before this one
+    Vector<String> runBefore;       // Names of systems that must update after this one
+    bool structural = false;        // Creates/destroys entities or adds/removes components
+
+    template<typename... Components>
+    SystemAccess& read() {
+        (reads.push_back(entt::type_hash<Components>::value()), ...);
+        return *this;
+    }
+
+    template<typename... Components>
+    SystemAccess& write() {
+        (writes.push_back(entt::type_hash<Components>::value()), ...);
+        return *this;
+    }
+
+    SystemAccess& after(const String& systemName) {
+        runAfter.push_back(systemName);
+        return *this;
+    }
+
+    SystemAccess& before(const String& systemName) {
+        runBefore.push_back(systemName);
+        return *this;
+    }
+
+    SystemAccess& changesStructure() {
+        structural = true;
+        return *this;
+    }
+
+    // Two systems conflict if either changes structure or one writes what the other touches
+    bool conflictsWith(const SystemAccess& other) const;
+};
+
 class System {
 public:
     virtual ~System() = default;
     virtual void update(f32 deltaTime) = 0;
     virtual String getName() const = 0;
+
+    // Default is conservative: a system that declares nothing is treated as structural,
+    // so it never runs concurrently with anything else.
+    virtual void declareAccess(SystemAccess& access) const { access.changesStructure(); }
 };
 
 } // namespace WorldEditor
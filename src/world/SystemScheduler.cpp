@@ -0,0 +1,284 @@
+#include "SystemScheduler.h"
+#include "core/Timer.h"
+#include "core/Profiler.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+namespace {
+
+bool intersects(const Vector<ComponentTypeId>& a, const Vector<ComponentTypeId>& b) {
+    for (ComponentTypeId id : a) {
+        if (std::find(b.begin(), b.end(), id) != b.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+bool SystemAccess::conflictsWith(const SystemAccess& other) const {
+    if (structural || other.structural) {
+        return true;
+    }
+    return intersects(writes, other.writes) ||
+           intersects(writes, other.reads) ||
+           intersects(reads, other.writes);
+}
+
+void SystemScheduler::add(UniquePtr<System> system) {
+    if (!system) {
+        return;
+    }
+
+    String name = system->getName();
+    for (auto& entry : entries_) {
+        if (entry.name == name) {
+            entry.system = std::move(system);
+            dirty_ = true;
+            return;
+        }
+    }
+
+    Entry entry;
+    entry.profileName = Profiler::intern(name);
+    entry.name = std::move(name);
+    entry.system = std::move(system);
+    entries_.push_back(std::move(entry));
+    dirty_ = true;
+}
+
+bool SystemScheduler::remove(const String& name) {
+    auto it = std::find_if(entries_.begin(), entries_.end(),
+                           [&](const Entry& entry) { return entry.name == name; });
+    if (it == entries_.end()) {
+        return false;
+    }
+    entries_.erase(it);
+    dirty_ = true;
+    return true;
+}
+
+void SystemScheduler::clear() {
+    entries_.clear();
+    stages_.clear();
+    dirty_ = true;
+}
+
+System* SystemScheduler::find(const String& name) {
+    for (auto& entry : entries_) {
+        if (entry.name == name) {
+            return entry.system.get();
+        }
+    }
+    return nullptr;
+}
+
+const System* SystemScheduler::find(const String& name) const {
+    for (const auto& entry : entries_) {
+        if (entry.name == name) {
+            return entry.system.get();
+        }
+    }
+    return nullptr;
+}
+
+void SystemScheduler::update(f32 deltaTime) {
+    if (dirty_) {
+        rebuild();
+    }
+
+    for (const auto& stage : stages_) {
+        runStage(stage, deltaTime);
+        if (syncPoint_) {
+            syncPoint_();
+        }
+    }
+}
+
+Vector<String> SystemScheduler::getExecutionOrder() {
+    if (dirty_) {
+        rebuild();
+    }
+
+    Vector<String> order;
+    for (const auto& stage : stages_) {
+        for (u32 index : stage) {
+            order.push_back(entries_[index].name);
+        }
+    }
+    return order;
+}
+
+const Vector<Vector<u32>>& SystemScheduler::getStages() {
+    if (dirty_) {
+        rebuild();
+    }
+    return stages_;
+}
+
+void SystemScheduler::rebuild() {
+    dirty_ = false;
+    stages_.clear();
+
+    const size_t count = entries_.size();
+    timings_.assign(count, SystemTiming{});
+    for (size_t i = 0; i < count; ++i) {
+        timings_[i].name = entries_[i].name;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    for (auto& entry : entries_) {
+        entry.access = SystemAccess{};
+        entry.system->declareAccess(entry.access);
+    }
+
+    auto indexOf = [&](const String& name) -> i32 {
+        for (size_t i = 0; i < count; ++i) {
+            if (entries_[i].name == name) {
+                return static_cast<i32>(i);
+            }
+        }
+        return -1;
+    };
+
+    // edges[a][b]: a must update before b. reach is the transitive closure.
+    Vector<Vector<bool>> edges(count, Vector<bool>(count, false));
+    Vector<Vector<bool>> reach(count, Vector<bool>(count, false));
+
+    auto addEdge = [&](size_t from, size_t to) {
+        if (from == to || reach[to][from]) {
+            return false;
+        }
+        edges[from][to] = true;
+        // Everything reaching 'from' (and 'from' itself) now reaches everything 'to' reaches
+        for (size_t a = 0; a < count; ++a) {
+            if (a != from && !reach[a][from]) {
+                continue;
+            }
+            reach[a][to] = true;
+            for (size_t b = 0; b < count; ++b) {
+                if (reach[to][b]) {
+                    reach[a][b] = true;
+                }
+            }
+        }
+        return true;
+    };
+
+    // 1. Explicit constraints (unknown names are fine: the system may not be registered here)
+    for (size_t i = 0; i < count; ++i) {
+        const auto& access = entries_[i].access;
+        for (const auto& name : access.runAfter) {
+            i32 other = indexOf(name);
+            if (other >= 0 && !addEdge(static_cast<size_t>(other), i)) {
+                LOG_WARN("SystemScheduler: ignoring cyclic constraint {} after {}", entries_[i].name, name);
+            }
+        }
+        for (const auto& name : access.runBefore) {
+            i32 other = indexOf(name);
+            if (other >= 0 && !addEdge(i, static_cast<size_t>(other))) {
+                LOG_WARN("SystemScheduler: ignoring cyclic constraint {} before {}", entries_[i].name, name);
+            }
+        }
+    }
+
+    // 2. Conflicting pairs keep registration order unless already ordered
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = i + 1; j < count; ++j) {
+            if (reach[i][j] || reach[j][i]) {
+                continue;
+            }
+            if (entries_[i].access.conflictsWith(entries_[j].access)) {
+                addEdge(i, j);
+            }
+        }
+    }
+
+    // 3. Stage = longest chain of predecessors. Processing in topological order
+    //    (smallest registration index first among ready systems) keeps it stable.
+    Vector<u32> inDegree(count, 0);
+    for (size_t a = 0; a < count; ++a) {
+        for (size_t b = 0; b < count; ++b) {
+            if (edges[a][b]) {
+                inDegree[b]++;
+            }
+        }
+    }
+
+    Vector<u32> stageOf(count, 0);
+    Vector<bool> done(count, false);
+    for (size_t processed = 0; processed < count; ++processed) {
+        size_t next = count;
+        for (size_t i = 0; i < count; ++i) {
+            if (!done[i] && inDegree[i] == 0) {
+                next = i;
+                break;
+            }
+        }
+        // addEdge rejects cycles, so a ready system always exists
+        if (next == count) {
+            break;
+        }
+
+        done[next] = true;
+        for (size_t b = 0; b < count; ++b) {
+            if (edges[next][b]) {
+                inDegree[b]--;
+                stageOf[b] = std::max(stageOf[b], stageOf[next] + 1);
+            }
+        }
+    }
+
+    u32 stageCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        stageCount = std::max(stageCount, stageOf[i] + 1);
+    }
+    stages_.resize(stageCount);
+    for (size_t i = 0; i < count; ++i) {
+        stages_[stageOf[i]].push_back(static_cast<u32>(i));
+    }
+
+    String order;
+    for (const auto& stage : stages_) {
+        order += order.empty() ? "" : " | ";
+        for (size_t k = 0; k < stage.size(); ++k) {
+            order += (k ? ", " : "") + entries_[stage[k]].name;
+        }
+    }
+    LOG_INFO("SystemScheduler order: {}", order);
+}
+
+void SystemScheduler::runStage(const Vector<u32>& stage, f32 deltaTime) {
+    if (mode_ == ExecutionMode::Serial || !jobSystem_ || stage.size() < 2) {
+        for (u32 index : stage) {
+            runSystem(index, deltaTime);
+        }
+        return;
+    }
+
+    // Systems in one stage never conflict: one job per system, the first runs on this thread
+    jobSystem_->parallelFor(static_cast<u32>(stage.size()), 1, [&](u32 begin, u32 end) {
+        for (u32 k = begin; k < end; ++k) {
+            runSystem(stage[k], deltaTime);
+        }
+    });
+}
+
+void SystemScheduler::runSystem(u32 index, f32 deltaTime) {
+    PROFILE_SCOPE(entries_[index].profileName);
+    if (!timingEnabled_) {
+        entries_[index].system->update(deltaTime);
+        return;
+    }
+
+    // Each system only writes its own slot, so this is safe from job threads
+    Timer timer;
+    entries_[index].system->update(deltaTime);
+    timings_[index].microseconds = timer.elapsedMillis() * 1000.0;
+}
+
+} // namespace WorldEditor
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "core/Types.h"
+#include "System.h"
+#include "core/JobSystem.h"
+#include <functional>
+
+namespace WorldEditor {
+
+// Owns the systems of a world and runs them in a stable, dependency-ordered sequence.
+//
+// Order is derived from SystemAccess declarations: explicit before/after constraints
+// first, then every conflicting pair (see SystemAccess::conflictsWith) is ordered by
+// registration order unless a constraint already orders it. Systems are grouped into
+// stages; systems in the same stage never conflict, so Parallel mode may run them as jobs
+// on the attached JobSystem (without one it falls back to serial). Serial mode runs the stages one system at a time in the same order,
+// which keeps replays bit-identical across builds.
+class SystemScheduler {
+public:
+    enum class ExecutionMode : u8 {
+        Serial,
+        Parallel
+    };
+
+    struct SystemTiming {
+        String name;
+        f64 microseconds = 0.0;     // Wall time of the last update() call
+    };
+
+    SystemScheduler() = default;
+    ~SystemScheduler() = default;
+
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    // Adding a system with an existing name replaces it in its original slot
+    void add(UniquePtr<System> system);
+    bool remove(const String& name);
+    void clear();
+
+    System* find(const String& name);
+    const System* find(const String& name) const;
+    size_t size() const { return entries_.size(); }
+
+    void update(f32 deltaTime);
+
+    void setExecutionMode(ExecutionMode mode) { mode_ = mode; }
+    ExecutionMode getExecutionMode() const { return mode_; }
+
+    void setJobSystem(JobSystem* jobSystem) { jobSystem_ = jobSystem; }
+
+    // Called on the updating thread after every stage, e.g. to flush deferred entity commands
+    void setSyncPoint(std::function<void()> syncPoint) { syncPoint_ = std::move(syncPoint); }
+
+    // Per-system wall time of the last update, in registration order. Off by default
+    // (two clock reads per system per tick); used by sim_bench.
+    void setTimingEnabled(bool enabled) { timingEnabled_ = enabled; }
+    const Vector<SystemTiming>& getTimings() const { return timings_; }
+
+    // Resolved order (rebuilt lazily after add/remove)
+    Vector<String> getExecutionOrder();
+    const Vector<Vector<u32>>& getStages();
+
+    // Force access declarations to be re-read (e.g. after a system changed its config)
+    void invalidate() { dirty_ = true; }
+
+private:
+    struct Entry {
+        UniquePtr<System> system;
+        String name;
+        const char* profileName = nullptr;  // Interned copy of name for PROFILE_SCOPE
+        SystemAccess access;
+    };
+
+    void rebuild();
+    void runStage(const Vector<u32>& stage, f32 deltaTime);
+    void runSystem(u32 index, f32 deltaTime);
+
+    Vector<Entry> entries_;             // Registration order
+    Vector<Vector<u32>> stages_;        // Indices into entries_, each stage sorted by registration
+    Vector<SystemTiming> timings_;      // Parallel to entries_
+    ExecutionMode mode_ = ExecutionMode::Serial;
+    JobSystem* jobSystem_ = nullptr;
+    std::function<void()> syncPoint_;
+    bool dirty_ = true;
+    bool timingEnabled_ = false;
+};
+
+} // namespace WorldEditor
@@ -43,6 +43,7 @@ bool TerrainChunks::initializeChunks(TerrainComponent& terrain, MeshComponent& m
     return true;
 }
 
+#ifdef DIRECTX_RENDERER
 void TerrainChunks::updateDirtyChunks(TerrainComponent& terrain, MeshComponent& mesh, ID3D12Device* device) {
     auto& chunks = getChunks(mesh);
     
@@ -63,6 +64,7 @@ void TerrainChunks::updateDirtyChunks(TerrainComponent& terrain, MeshComponent&
         }
     }
 }
+#endif
 
 void TerrainChunks::markChunksDirty(TerrainComponent& terrain, const Vec2i& minAffected, const Vec2i& maxAffected) {
     // This would need access to chunks, but we don't have MeshComponent here
@@ -179,8 +181,8 @@ Vector<TerrainChunks::TerrainChunk>& TerrainChunks::getChunks(MeshComponent& mes
     return globalChunks;
 }
 
-void TerrainChunks::createChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* device) {
 #ifdef DIRECTX_RENDERER
+void TerrainChunks::createChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* device) {
     if (!device || chunk.vertices.empty()) return;
     
     // Create vertex buffer
@@ -256,12 +258,9 @@ void TerrainChunks::createChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* dev
             }
         }
     }
-#endif
 }
 
 void TerrainChunks::updateChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* device) {
-    (void)device;
-#ifdef DIRECTX_RENDERER
     // IMPORTANT: Do NOT recreate buffers every edit. Releasing D3D12 resources while GPU is still using them
     // can trigger device removal / debug-layer exceptions and "soft crashes" on the first sculpt stroke.
     // Chunks have stable topology after initialization, so we can update the upload-heap buffers in-place.
@@ -295,7 +294,7 @@ void TerrainChunks::updateChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* dev
             chunk.indexBuffer->Unmap(0, nullptr);
         }
     }
-#endif
 }
+#endif
 
 } // namespace WorldEditor
\ No newline at end of file
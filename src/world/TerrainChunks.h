@@ -37,8 +37,10 @@ public:
     // Initialize chunk system for terrain
     static bool initializeChunks(TerrainComponent& terrain, MeshComponent& mesh);
     
+#ifdef DIRECTX_RENDERER
     // Update only dirty chunks (much more efficient)
     static void updateDirtyChunks(TerrainComponent& terrain, MeshComponent& mesh, ID3D12Device* device);
+#endif
     
     // Mark chunks as dirty in affected area
     static void markChunksDirty(TerrainComponent& terrain, const Vec2i& minAffected, const Vec2i& maxAffected);
@@ -53,8 +55,10 @@ public:
     static Vector<TerrainChunk>& getChunks(MeshComponent& mesh);
     
 private:
+#ifdef DIRECTX_RENDERER
     static void createChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* device);
     static void updateChunkGPUBuffers(TerrainChunk& chunk, ID3D12Device* device);
+#endif
 };
 
 } // namespace WorldEditor
\ No newline at end of file
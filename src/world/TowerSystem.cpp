@@ -7,6 +7,20 @@ namespace WorldEditor {
 
 TowerSystem::TowerSystem(EntityManager& entityManager) 
     : entityManager_(entityManager) {
+    // Towers covering a hero react quickly; idle ones only poll for creeps
+    AiLodSettings lod;
+    lod.highInterval = 0.1f;
+    lod.mediumInterval = 0.2f;
+    lod.lowInterval = 0.5f;
+    aiLod_.setSettings(lod);
+}
+
+void TowerSystem::declareAccess(SystemAccess& access) const {
+    // Fires projectiles; targets this tick's creep positions
+    access.changesStructure()
+          .read<ObjectComponent, TransformComponent, CreepComponent, HeroComponent, HealthComponent>()
+          .write<TowerRuntimeComponent>()
+          .after("CreepSystem");
 }
 
 void TowerSystem::update(f32 deltaTime) {
@@ -19,19 +33,26 @@ void TowerSystem::update(f32 deltaTime) {
         runtime.attackCooldown = std::max(0.0f, runtime.attackCooldown - deltaTime);
     }
     
-    // Update tower AI (throttled for performance)
-    lastFullUpdate_ += deltaTime;
-    if (lastFullUpdate_ >= FULL_UPDATE_INTERVAL) {
-        auto towerView = registry.view<ObjectComponent, TransformComponent>();
-        for (auto entity : towerView) {
-            auto& obj = towerView.get<ObjectComponent>(entity);
-            auto& transform = towerView.get<TransformComponent>(entity);
-            
-            if (obj.type == ObjectType::Tower) {
-                updateTowerAI(entity, obj, transform, deltaTime);
-            }
+    // Update tower AI, each tower on its own time slice
+    aiLod_.beginTick(entityManager_, deltaTime);
+    auto towerView = registry.view<ObjectComponent, TransformComponent>();
+    for (auto entity : towerView) {
+        auto& obj = towerView.get<ObjectComponent>(entity);
+        auto& transform = towerView.get<TransformComponent>(entity);
+        
+        if (obj.type != ObjectType::Tower) {
+            continue;
+        }
+        
+        // Reloading towers have nothing to decide; engaged ones keep the fast cadence
+        const auto* runtime = registry.try_get<TowerRuntimeComponent>(entity);
+        if (runtime && runtime->attackCooldown > 0.0f) {
+            continue;
+        }
+        const bool inCombat = runtime && runtime->lastTarget != INVALID_ENTITY;
+        if (aiLod_.shouldThink(entity, aiLod_.classify(transform.position, inCombat))) {
+            updateTowerAI(entity, obj, transform, deltaTime);
         }
-        lastFullUpdate_ = 0.0f;
     }
 }
 
@@ -58,6 +79,7 @@ void TowerSystem::updateTowerAI(Entity entity, ObjectComponent& tower, Transform
     
     // Find target
     Entity target = findBestTarget(transform.position, tower.attackRange, tower.teamId);
+    runtime.lastTarget = target;
     if (target != INVALID_ENTITY) {
         // Fire at target
         fireTowerProjectile(entity, target, tower);
@@ -67,64 +89,43 @@ void TowerSystem::updateTowerAI(Entity entity, ObjectComponent& tower, Transform
 
 Entity TowerSystem::findBestTarget(const Vec3& towerPos, f32 range, i32 teamId) {
     auto& registry = entityManager_.getRegistry();
+    const auto& grid = entityManager_.getSpatialGrid();
     
     Entity bestTarget = INVALID_ENTITY;
     f32 bestPriority = -1.0f;
     
-    // Priority 1: Check enemy creeps (towers prioritize creeps over heroes)
-    auto creepView = registry.view<CreepComponent, TransformComponent>();
-    for (auto entity : creepView) {
-        auto& creep = creepView.get<CreepComponent>(entity);
-        auto& transform = creepView.get<TransformComponent>(entity);
-        
-        // Skip same team or dead creeps
-        if (creep.teamId == teamId || creep.state == CreepState::Dead) {
-            continue;
-        }
-        
-        // Check range
-        f32 distance = glm::length(transform.position - towerPos);
-        if (distance > range) {
-            continue;
-        }
-        
-        // Calculate priority
-        f32 priority = calculateTargetPriority(entity, towerPos);
-        if (priority > bestPriority) {
-            bestTarget = entity;
-            bestPriority = priority;
-        }
-    }
+    // Visit in distance order so equal priorities resolve the same way every tick
+    grid.queryRadius(towerPos, range, SpatialFilter::enemiesOf(teamId, SpatialType::Creep | SpatialType::Hero),
+                     targetScratch_);
     
-    // Priority 2: Check enemy heroes (if no creeps in range or hero is attacking tower)
-    auto heroView = registry.view<HeroComponent, TransformComponent>();
-    for (auto entity : heroView) {
-        auto& hero = heroView.get<HeroComponent>(entity);
-        auto& transform = heroView.get<TransformComponent>(entity);
+    const auto& visibility = entityManager_.getVisibility();
+    for (const auto& hit : targetScratch_) {
+        f32 priority = 0.0f;
         
-        // Skip same team or dead heroes
-        if (hero.teamId == teamId || hero.state == HeroState::Dead) {
+        // Nothing in the fog (high ground seen from below)
+        if (!visibility.isVisibleTo(teamId, hit.entity)) {
             continue;
         }
         
-        // Skip invisible heroes
-        if (hero.isInvisible()) {
-            continue;
-        }
-        
-        // Check range
-        f32 distance = glm::length(transform.position - towerPos);
-        if (distance > range) {
+        if (const auto* creep = registry.try_get<CreepComponent>(hit.entity)) {
+            // Priority 1: enemy creeps (towers prioritize creeps over heroes)
+            if (creep->state == CreepState::Dead) {
+                continue;
+            }
+            priority = calculateTargetPriority(hit.entity, towerPos);
+        } else if (const auto* hero = registry.try_get<HeroComponent>(hit.entity)) {
+            // Priority 2: enemy heroes (skip dead and invisible ones)
+            if (hero->state == HeroState::Dead || hero->isInvisible()) {
+                continue;
+            }
+            // Heroes get lower base priority than creeps, but can still be targeted
+            priority = calculateTargetPriority(hit.entity, towerPos) - 20.0f;
+        } else {
             continue;
         }
         
-        // Calculate priority for hero (lower than creeps, but still valid)
-        f32 priority = calculateTargetPriority(entity, towerPos);
-        // Heroes get lower base priority than creeps, but can still be targeted
-        priority -= 20.0f; // Slight penalty to prefer creeps
-        
         if (priority > bestPriority) {
-            bestTarget = entity;
+            bestTarget = hit.entity;
             bestPriority = priority;
         }
     }
@@ -186,9 +187,6 @@ f32 TowerSystem::calculateTargetPriority(Entity target, const Vec3& towerPos) {
 }
 
 void TowerSystem::fireTowerProjectile(Entity tower, Entity target, const ObjectComponent& towerComp) {
-    // Find or create ProjectileSystem to handle projectile creation
-    // For now, create projectile directly (in full implementation, would use system)
-    
     if (!entityManager_.hasComponent<TransformComponent>(tower) || 
         !entityManager_.hasComponent<TransformComponent>(target)) {
         return;
@@ -196,26 +194,30 @@ void TowerSystem::fireTowerProjectile(Entity tower, Entity target, const ObjectC
     
     auto& towerTransform = entityManager_.getComponent<TransformComponent>(tower);
     
-    // Create projectile entity
-    Entity projectile = entityManager_.createEntity("TowerProjectile");
-    auto& projComp = entityManager_.addComponent<ProjectileComponent>(projectile);
-    auto& transform = entityManager_.addComponent<TransformComponent>(projectile);
-    
-    // Set projectile properties
-    projComp.attacker = tower;
-    projComp.target = target;
-    projComp.teamId = towerComp.teamId;
-    projComp.baseDamage = towerComp.attackDamage;
-    projComp.active = true;
-    projComp.isTower = true;
-    projComp.speed = 60.0f; // Tower projectiles are slower but more visible
-    projComp.hitRadius = 1.5f; // Larger hit radius for tower projectiles
+    ProjectileSpawn spawn;
+    spawn.attacker = tower;
+    spawn.target = target;
+    spawn.teamId = towerComp.teamId;
+    spawn.damage = towerComp.attackDamage;
+    spawn.isTower = true;
+    spawn.speed = 60.0f; // Tower projectiles are slower but more visible
+    spawn.hitRadius = 1.5f; // Larger hit radius for tower projectiles
     
     // Set starting position (above tower)
-    transform.position = towerTransform.position + Vec3(0, 2, 0);
+    spawn.position = towerTransform.position + Vec3(0, 2, 0);
+    spawn.visual = getProjectilePrefab(towerComp.teamId);
+    
+    entityManager_.getProjectiles().spawn(spawn);
+}
+
+PrefabId TowerSystem::getProjectilePrefab(i32 teamId) {
+    PrefabId& id = projectilePrefabs_[teamId == 1 ? 0 : 1];
+    if (id != INVALID_PREFAB) {
+        return id;
+    }
     
     // Create visual mesh (larger than creep projectiles)
-    auto& mesh = entityManager_.addComponent<MeshComponent>(projectile, "TowerProjectileMesh");
+    MeshComponent mesh("TowerProjectileMesh");
     // Use simple sphere for now - in full implementation would use proper projectile model
     Vector<Vec3> vertices, normals;
     Vector<Vec2> texCoords;
@@ -265,12 +267,9 @@ void TowerSystem::fireTowerProjectile(Entity tower, Entity target, const ObjectC
     mesh.indices = std::move(indices);
     mesh.gpuUploadNeeded = true;
     
-    // Create material
-    Entity materialEntity = entityManager_.createEntity("TowerProjectileMaterial");
-    auto& material = entityManager_.addComponent<MaterialComponent>(materialEntity, "TowerProjectileMaterial");
-    
     // Team-based colors (brighter for tower projectiles)
-    if (towerComp.teamId == 1) {
+    MaterialComponent material("TowerProjectileMaterial");
+    if (teamId == 1) {
         material.baseColor = Vec3(0.2f, 1.0f, 0.2f); // Bright green for Radiant
         material.emissiveColor = Vec3(0.1f, 0.4f, 0.1f);
     } else {
@@ -278,7 +277,13 @@ void TowerSystem::fireTowerProjectile(Entity tower, Entity target, const ObjectC
         material.emissiveColor = Vec3(0.4f, 0.1f, 0.1f);
     }
     
-    mesh.materialEntity = materialEntity;
+    Prefab prefab(teamId == 1 ? "TowerProjectile_1" : "TowerProjectile_2");
+    prefab.withEntityName("TowerProjectile")
+          .with(TransformComponent())
+          .with(std::move(mesh))
+          .withMaterial(material);
+    id = entityManager_.getPrefabs().add(std::move(prefab));
+    return id;
 }
 
 void TowerSystem::initializeTower(Entity tower) {
@@ -309,11 +314,12 @@ void TowerSystem::initializeTower(Entity tower) {
     
     // Add collision component if missing
     if (!entityManager_.hasComponent<CollisionComponent>(tower)) {
-        auto& collision = entityManager_.addComponent<CollisionComponent>(tower, CollisionShape::Capsule);
+        CollisionComponent collision(CollisionShape::Capsule);
         collision.capsuleRadius = 2.0f;
         collision.capsuleHeight = 4.0f;
         collision.isStatic = true;
         collision.blocksMovement = true;
+        entityManager_.addComponent<CollisionComponent>(tower, collision);
     }
 }
 
@@ -3,6 +3,7 @@
 #include "System.h"
 #include "Components.h"
 #include "EntityManager.h"
+#include "AiLodScheduler.h"
 #include "core/Types.h"
 
 namespace WorldEditor {
@@ -16,6 +17,7 @@ public:
 
     void update(f32 deltaTime) override;
     String getName() const override { return "TowerSystem"; }
+    void declareAccess(SystemAccess& access) const override;
     
     // Set world reference
     void setWorld(World* world) { world_ = world; }
@@ -23,10 +25,14 @@ public:
     // Tower management
     void initializeTower(Entity tower);
     Entity findNearestEnemyInRange(Entity tower, const Vec3& position, f32 range, i32 teamId);
+    
+    // Target acquisition cadence by distance to heroes, optional per-tick budget
+    AiLodScheduler& getAiLod() { return aiLod_; }
 
 private:
     EntityManager& entityManager_;
     World* world_ = nullptr;
+    AiLodScheduler aiLod_;
     
     // Tower AI
     void updateTowerAI(Entity entity, ObjectComponent& tower, TransformComponent& transform, f32 deltaTime);
@@ -35,13 +41,14 @@ private:
     // Target acquisition
     Entity findBestTarget(const Vec3& towerPos, f32 range, i32 teamId);
     f32 calculateTargetPriority(Entity target, const Vec3& towerPos);
+    Vector<SpatialHit> targetScratch_; // Reused between findBestTarget calls
     
     // Combat
     void fireTowerProjectile(Entity tower, Entity target, const ObjectComponent& towerComp);
     
-    // Performance optimization
-    f32 lastFullUpdate_ = 0.0f;
-    static constexpr f32 FULL_UPDATE_INTERVAL = 0.2f; // 5 Hz for expensive operations
+    // Projectile render prefab per team [Radiant, Dire], built on first use
+    PrefabId getProjectilePrefab(i32 teamId);
+    PrefabId projectilePrefabs_[2] = { INVALID_PREFAB, INVALID_PREFAB };
 };
 
 } // namespace WorldEditor
\ No newline at end of file
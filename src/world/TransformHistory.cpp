@@ -0,0 +1,148 @@
+#include "TransformHistory.h"
+#include "HeroSystem.h"
+#include <algorithm>
+
+namespace WorldEditor {
+
+TransformHistory::TransformHistory(size_t frameCount) {
+    setFrameCount(frameCount);
+}
+
+void TransformHistory::setFrameCount(size_t frameCount) {
+    frameCount_ = std::max<size_t>(frameCount, 2);
+    frameTime_.assign(frameCount_, 0.0f);
+    clear();
+}
+
+void TransformHistory::record(const Registry& registry, f32 time) {
+    const u64 frame = frames_;
+    frameTime_[frameIndex(frame)] = time;
+
+    auto write = [&](Entity entity, const Vec3& position) {
+        const u32 slot = acquireSlot(entity);
+        slotLastFrame_[slot] = frame;
+        const size_t i = static_cast<size_t>(slot) * frameCount_ + frameIndex(frame);
+        x_[i] = position.x;
+        y_[i] = position.y;
+        z_[i] = position.z;
+    };
+
+    auto heroes = registry.view<HeroComponent, TransformComponent>();
+    for (auto entity : heroes) {
+        if (heroes.get<HeroComponent>(entity).state != HeroState::Dead) {
+            write(entity, heroes.get<TransformComponent>(entity).position);
+        }
+    }
+
+    auto creeps = registry.view<CreepComponent, TransformComponent>();
+    for (auto entity : creeps) {
+        if (creeps.get<CreepComponent>(entity).state != CreepState::Dead) {
+            write(entity, creeps.get<TransformComponent>(entity).position);
+        }
+    }
+
+    // Died or destroyed this tick: the slot goes back to the pool
+    for (auto it = slots_.begin(); it != slots_.end();) {
+        const u32 slot = it->second;
+        if (slotLastFrame_[slot] != frame) {
+            slotEntity_[slot] = INVALID_ENTITY;
+            freeSlots_.push_back(slot);
+            it = slots_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    ++frames_;
+}
+
+void TransformHistory::clear() {
+    frames_ = 0;
+    slots_.clear();
+    slotEntity_.clear();
+    slotFirstFrame_.clear();
+    slotLastFrame_.clear();
+    freeSlots_.clear();
+    x_.clear();
+    y_.clear();
+    z_.clear();
+}
+
+f32 TransformHistory::getOldestTime() const {
+    return frames_ > 0 ? frameTime_[frameIndex(oldestFrame())] : 0.0f;
+}
+
+f32 TransformHistory::getNewestTime() const {
+    return frames_ > 0 ? frameTime_[frameIndex(frames_ - 1)] : 0.0f;
+}
+
+f32 TransformHistory::clampTime(f32 time) const {
+    if (frames_ == 0) {
+        return time;
+    }
+    return std::clamp(time, getOldestTime(), getNewestTime());
+}
+
+bool TransformHistory::getPosition(Entity entity, f32 time, Vec3& outPosition) const {
+    auto it = slots_.find(entity);
+    if (it == slots_.end()) {
+        return false;
+    }
+
+    const u32 slot = it->second;
+    const size_t base = static_cast<size_t>(slot) * frameCount_;
+    const u64 first = std::max(slotFirstFrame_[slot], oldestFrame());
+    const u64 last = slotLastFrame_[slot];
+    auto positionAt = [&](u64 frame) {
+        const size_t i = base + frameIndex(frame);
+        return Vec3(x_[i], y_[i], z_[i]);
+    };
+
+    if (time >= frameTime_[frameIndex(last)]) {
+        outPosition = positionAt(last);
+        return true;
+    }
+
+    // Newest to oldest: at most frameCount_ steps
+    for (u64 frame = last; frame > first; --frame) {
+        const f32 t0 = frameTime_[frameIndex(frame - 1)];
+        if (time < t0) {
+            continue;
+        }
+        const f32 t1 = frameTime_[frameIndex(frame)];
+        const f32 alpha = t1 > t0 ? (time - t0) / (t1 - t0) : 1.0f;
+        const Vec3 from = positionAt(frame - 1);
+        outPosition = from + (positionAt(frame) - from) * alpha;
+        return true;
+    }
+
+    // Older than anything kept for this entity
+    outPosition = positionAt(first);
+    return true;
+}
+
+u32 TransformHistory::acquireSlot(Entity entity) {
+    auto it = slots_.find(entity);
+    if (it != slots_.end()) {
+        return it->second;
+    }
+
+    u32 slot = 0;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        slotEntity_[slot] = entity;
+    } else {
+        slot = static_cast<u32>(slotEntity_.size());
+        slotEntity_.push_back(entity);
+        slotFirstFrame_.push_back(0);
+        slotLastFrame_.push_back(0);
+        x_.resize(x_.size() + frameCount_);
+        y_.resize(y_.size() + frameCount_);
+        z_.resize(z_.size() + frameCount_);
+    }
+    slotFirstFrame_[slot] = frames_;
+    slots_.emplace(entity, slot);
+    return slot;
+}
+
+} // namespace WorldEditor
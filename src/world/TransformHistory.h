@@ -0,0 +1,68 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+
+namespace WorldEditor {
+
+// Server-side record of where every hero and creep stood over the last few ticks, for
+// lag compensation: a command is judged against the positions the client was looking at
+// (its interpolation time) instead of the ones the server has now.
+//
+// The history is a fixed ring of frames, one per record() call. Each tracked entity owns
+// a slot, and the slot's positions are stored slot-major in flat x/y/z arrays
+// (slot * frameCount + frame), so memory is frameCount * 12 bytes per unit and a query
+// touches one contiguous run. Slots of units that died or were destroyed are reused.
+// Entities without a slot (towers, buildings) do not move and are read from their live
+// transform by callers.
+class TransformHistory {
+public:
+    // 16 frames cover ~500ms at the 30Hz server tick
+    static constexpr size_t kDefaultFrameCount = 16;
+
+    explicit TransformHistory(size_t frameCount = kDefaultFrameCount);
+
+    // Drops the history
+    void setFrameCount(size_t frameCount);
+    size_t getFrameCount() const { return frameCount_; }
+
+    // Appends a frame with the current positions, stamped with the server time they
+    // belong to (the time sent in the snapshot of this tick)
+    void record(const Registry& registry, f32 time);
+    void clear();
+
+    size_t getRecordedFrames() const { return static_cast<size_t>(frames_ < frameCount_ ? frames_ : frameCount_); }
+    size_t getTrackedCount() const { return slots_.size(); }
+
+    // Window of times a query can rewind to; both 0 before the first frame
+    f32 getOldestTime() const;
+    f32 getNewestTime() const;
+    f32 clampTime(f32 time) const;
+
+    // Position at the given time, interpolated between the two frames around it and
+    // clamped to the part of the window the entity was alive for. False for entities
+    // without a slot.
+    bool getPosition(Entity entity, f32 time, Vec3& outPosition) const;
+
+private:
+    u32 frameIndex(u64 frame) const { return static_cast<u32>(frame % frameCount_); }
+    u64 oldestFrame() const { return frames_ > frameCount_ ? frames_ - frameCount_ : 0; }
+    u32 acquireSlot(Entity entity);
+
+    size_t frameCount_ = kDefaultFrameCount;
+    u64 frames_ = 0;                    // Frames recorded so far; the newest is frames_ - 1
+    Vector<f32> frameTime_;             // Per ring frame
+
+    Map<Entity, u32> slots_;
+    Vector<Entity> slotEntity_;         // INVALID_ENTITY for free slots
+    Vector<u64> slotFirstFrame_;        // First frame recorded for the slot's entity
+    Vector<u64> slotLastFrame_;         // Newest frame recorded for the slot's entity
+    Vector<u32> freeSlots_;
+
+    // Positions, slot-major
+    Vector<f32> x_;
+    Vector<f32> y_;
+    Vector<f32> z_;
+};
+
+} // namespace WorldEditor
@@ -0,0 +1,277 @@
+#include "Visibility.h"
+#include "HeroSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace WorldEditor {
+
+size_t VisibilityGrid::update(const Registry& registry, u64 terrainRevision) {
+    registry_ = &registry;
+
+    // New terrain: every viewer is stamped again below
+    if (terrainRevision != terrainRevision_) {
+        terrainRevision_ = terrainRevision;
+        viewers_.clear();
+        buildTiles(registry);
+    }
+    if (empty()) {
+        return 0;
+    }
+    ++tick_;
+
+    size_t stamped = 0;
+    auto visit = [&](Entity entity, i32 teamId, bool alive, f32 radius, const Vec3& position) {
+        const i32 team = teamIndex(teamId);
+        auto it = viewers_.find(entity);
+        if (team < 0 || !alive || radius <= 0.0f) {
+            if (it != viewers_.end()) {
+                stamp(it->second, -1);
+                viewers_.erase(it);
+                ++stamped;
+            }
+            return;
+        }
+
+        Viewer next;
+        next.team = team;
+        next.radius = radius;
+        next.seenTick = tick_;
+        worldToTile(position, next.x, next.z);
+
+        if (it != viewers_.end()) {
+            Viewer& viewer = it->second;
+            if (viewer.team == next.team && viewer.x == next.x && viewer.z == next.z && viewer.radius == next.radius) {
+                viewer.seenTick = tick_;
+                return;
+            }
+            // Crossed into another tile: move the stamp
+            stamp(viewer, -1);
+            ++stamped;
+            viewer = next;
+        } else {
+            it = viewers_.emplace(entity, next).first;
+        }
+        stamp(it->second, 1);
+        ++stamped;
+    };
+
+    auto heroes = registry.view<HeroComponent, TransformComponent>();
+    for (auto entity : heroes) {
+        const auto& hero = heroes.get<HeroComponent>(entity);
+        visit(entity, hero.teamId, hero.state != HeroState::Dead, settings_.heroRadius,
+              heroes.get<TransformComponent>(entity).position);
+    }
+
+    auto creeps = registry.view<CreepComponent, TransformComponent>();
+    for (auto entity : creeps) {
+        const auto& creep = creeps.get<CreepComponent>(entity);
+        visit(entity, creep.teamId, creep.state != CreepState::Dead, settings_.creepRadius,
+              creeps.get<TransformComponent>(entity).position);
+    }
+
+    auto objects = registry.view<ObjectComponent, TransformComponent>();
+    for (auto entity : objects) {
+        const auto& obj = objects.get<ObjectComponent>(entity);
+        if (obj.type != ObjectType::Tower) {
+            continue;
+        }
+        const auto* health = registry.try_get<HealthComponent>(entity);
+        visit(entity, obj.teamId, !health || !health->isDead, settings_.towerRadius,
+              objects.get<TransformComponent>(entity).position);
+    }
+
+    // Destroyed since the last update
+    for (auto it = viewers_.begin(); it != viewers_.end();) {
+        if (it->second.seenTick != tick_) {
+            stamp(it->second, -1);
+            it = viewers_.erase(it);
+            ++stamped;
+        } else {
+            ++it;
+        }
+    }
+    return stamped;
+}
+
+void VisibilityGrid::clear() {
+    viewers_.clear();
+    width_ = 0;
+    height_ = 0;
+    levels_.clear();
+    for (auto& seen : seenBy_) {
+        seen.clear();
+    }
+    registry_ = nullptr;
+    terrainRevision_ = ~0ull;
+}
+
+bool VisibilityGrid::isTileVisible(i32 teamId, i32 x, i32 z) const {
+    const i32 team = teamIndex(teamId);
+    if (team < 0 || empty()) {
+        return true;
+    }
+    if (x < 0 || z < 0 || x >= width_ || z >= height_) {
+        return false;
+    }
+    return seenBy_[team][index(x, z)] > 0;
+}
+
+bool VisibilityGrid::isPositionVisible(i32 teamId, const Vec3& position) const {
+    i32 x = 0;
+    i32 z = 0;
+    if (!worldToTile(position, x, z)) {
+        return true;
+    }
+    return isTileVisible(teamId, x, z);
+}
+
+bool VisibilityGrid::isVisibleTo(i32 teamId, Entity entity) const {
+    if (teamIndex(teamId) < 0 || empty()) {
+        return true;
+    }
+    if (!registry_ || !registry_->valid(entity)) {
+        return false;
+    }
+    if (teamOf(*registry_, entity) == teamId) {
+        return true;
+    }
+    const auto* transform = registry_->try_get<TransformComponent>(entity);
+    return transform && isPositionVisible(teamId, transform->position);
+}
+
+bool VisibilityGrid::buildTiles(const Registry& registry) {
+    width_ = 0;
+    height_ = 0;
+    levels_.clear();
+    for (auto& seen : seenBy_) {
+        seen.clear();
+    }
+
+    const TerrainComponent* terrain = nullptr;
+    auto terrainView = registry.view<TerrainComponent, TransformComponent>();
+    for (auto entity : terrainView) {
+        terrain = &terrainView.get<TerrainComponent>(entity);
+        origin_ = terrainView.get<TransformComponent>(entity).position;
+        break;
+    }
+    if (!terrain || terrain->tilesX <= 0 || terrain->tilesZ <= 0 || terrain->tileSize <= 0.0f) {
+        return false;
+    }
+
+    const i32 resX = terrain->resolution.x;
+    const size_t vertexCount = static_cast<size_t>(resX) * static_cast<size_t>(terrain->resolution.y);
+    const bool sameLayout = resX == terrain->tilesX + 1 && terrain->resolution.y == terrain->tilesZ + 1;
+    const bool hasLevels = sameLayout && terrain->heightLevels.size() == vertexCount;
+    const bool hasHeights = sameLayout && terrain->heightmap.size() == vertexCount && terrain->heightStep > 0.0f;
+
+    auto level = [&](i32 x, i32 z) -> i16 {
+        const size_t i = static_cast<size_t>(z) * static_cast<size_t>(resX) + static_cast<size_t>(x);
+        if (hasLevels) {
+            return terrain->heightLevels[i];
+        }
+        if (hasHeights) {
+            return static_cast<i16>(std::lround(terrain->heightmap[i] / terrain->heightStep));
+        }
+        return 0;
+    };
+
+    width_ = terrain->tilesX;
+    height_ = terrain->tilesZ;
+    tileSize_ = terrain->tileSize;
+
+    const size_t tileCount = static_cast<size_t>(width_) * static_cast<size_t>(height_);
+    levels_.resize(tileCount);
+    for (i32 z = 0; z < height_; ++z) {
+        for (i32 x = 0; x < width_; ++x) {
+            levels_[index(x, z)] = std::max(std::max(level(x, z), level(x + 1, z)),
+                                            std::max(level(x, z + 1), level(x + 1, z + 1)));
+        }
+    }
+    for (auto& seen : seenBy_) {
+        seen.assign(tileCount, 0);
+    }
+    return true;
+}
+
+void VisibilityGrid::stamp(const Viewer& viewer, i32 delta) {
+    // Measured between tile centers so the same tiles come off when the viewer moves on
+    const f32 radiusTiles = viewer.radius / tileSize_;
+    const i32 reach = static_cast<i32>(std::ceil(radiusTiles));
+    const i16 level = levels_[index(viewer.x, viewer.z)];
+    Vector<u16>& seen = seenBy_[viewer.team];
+
+    const i32 minZ = std::max(0, viewer.z - reach);
+    const i32 maxZ = std::min(height_ - 1, viewer.z + reach);
+    const i32 minX = std::max(0, viewer.x - reach);
+    const i32 maxX = std::min(width_ - 1, viewer.x + reach);
+    for (i32 z = minZ; z <= maxZ; ++z) {
+        for (i32 x = minX; x <= maxX; ++x) {
+            const f32 dx = static_cast<f32>(x - viewer.x);
+            const f32 dz = static_cast<f32>(z - viewer.z);
+            if (dx * dx + dz * dz > radiusTiles * radiusTiles) {
+                continue;
+            }
+            const u32 i = index(x, z);
+            if (levels_[i] > level || occluded(viewer.x, viewer.z, x, z, level)) {
+                continue;
+            }
+            seen[i] = static_cast<u16>(seen[i] + delta);
+        }
+    }
+}
+
+bool VisibilityGrid::worldToTile(const Vec3& position, i32& outX, i32& outZ) const {
+    if (empty()) {
+        return false;
+    }
+    const Vec3 local = position - origin_;
+    outX = std::clamp(static_cast<i32>(std::floor(local.x / tileSize_)), 0, width_ - 1);
+    outZ = std::clamp(static_cast<i32>(std::floor(local.z / tileSize_)), 0, height_ - 1);
+    return true;
+}
+
+bool VisibilityGrid::occluded(i32 x0, i32 z0, i32 x1, i32 z1, i16 level) const {
+    const i32 nx = std::abs(x1 - x0);
+    const i32 nz = std::abs(z1 - z0);
+    const i32 stepX = x1 > x0 ? 1 : -1;
+    const i32 stepZ = z1 > z0 ? 1 : -1;
+
+    // Tiles the line between the two centers passes through; higher ground blocks it
+    i32 x = x0;
+    i32 z = z0;
+    for (i32 ix = 0, iz = 0; ix < nx || iz < nz;) {
+        const i64 decision = static_cast<i64>(1 + 2 * ix) * nz - static_cast<i64>(1 + 2 * iz) * nx;
+        if (decision == 0) {
+            x += stepX;
+            z += stepZ;
+            ++ix;
+            ++iz;
+        } else if (decision < 0) {
+            x += stepX;
+            ++ix;
+        } else {
+            z += stepZ;
+            ++iz;
+        }
+
+        if (levels_[index(x, z)] > level) {
+            return true;
+        }
+    }
+    return false;
+}
+
+i32 VisibilityGrid::teamOf(const Registry& registry, Entity entity) {
+    if (const auto* hero = registry.try_get<HeroComponent>(entity)) {
+        return hero->teamId;
+    }
+    if (const auto* creep = registry.try_get<CreepComponent>(entity)) {
+        return creep->teamId;
+    }
+    if (const auto* obj = registry.try_get<ObjectComponent>(entity)) {
+        return obj->teamId;
+    }
+    return 0;
+}
+
+} // namespace WorldEditor
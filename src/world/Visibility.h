@@ -0,0 +1,79 @@
+#pragma once
+
+#include "core/Types.h"
+#include "Components.h"
+
+namespace WorldEditor {
+
+// Vision radii in world units, by unit kind
+struct VisionSettings {
+    f32 heroRadius = 1800.0f;
+    f32 creepRadius = 750.0f;
+    f32 towerRadius = 1900.0f;
+};
+
+// Server-side fog of war: per-team visibility over the terrain tile grid. Every living
+// hero, creep and tower of team 1 or 2 reveals the tiles within its vision radius that
+// are not on higher ground than its own tile and not hidden behind it (the straight line
+// to the tile may only cross tiles at or below the viewer's level).
+//
+// Tiles keep a per-team count of viewers that see them. update() only re-stamps viewers
+// that crossed into another tile, changed radius or died since the last call; terrain
+// changes re-stamp everything. Without terrain there is no fog and everything is
+// visible.
+class VisibilityGrid {
+public:
+    static constexpr size_t kTeamCount = 2;     // Radiant (1) and Dire (2)
+
+    void setSettings(const VisionSettings& settings) { settings_ = settings; terrainRevision_ = ~0ull; }
+    const VisionSettings& getSettings() const { return settings_; }
+
+    // terrainRevision changes whenever the terrain was edited (EntityManager's nav grid
+    // revision); returns the number of viewers stamped or unstamped
+    size_t update(const Registry& registry, u64 terrainRevision);
+    void clear();
+
+    bool empty() const { return width_ == 0 || height_ == 0; }
+    i32 getWidth() const { return width_; }
+    i32 getHeight() const { return height_; }
+    size_t getViewerCount() const { return viewers_.size(); }
+
+    // Teams other than 1 and 2 (spectators) see everything
+    bool isTileVisible(i32 teamId, i32 x, i32 z) const;
+    bool isPositionVisible(i32 teamId, const Vec3& position) const;
+    // A team always sees its own units; O(1), reads the entity's live transform
+    bool isVisibleTo(i32 teamId, Entity entity) const;
+
+private:
+    struct Viewer {
+        i32 team = 0;           // Team index (0 or 1)
+        i32 x = 0;
+        i32 z = 0;
+        f32 radius = 0.0f;
+        u32 seenTick = 0;
+    };
+
+    bool buildTiles(const Registry& registry);
+    void stamp(const Viewer& viewer, i32 delta);
+    bool worldToTile(const Vec3& position, i32& outX, i32& outZ) const;
+    bool occluded(i32 x0, i32 z0, i32 x1, i32 z1, i16 level) const;
+    u32 index(i32 x, i32 z) const { return static_cast<u32>(z) * static_cast<u32>(width_) + static_cast<u32>(x); }
+    static i32 teamIndex(i32 teamId) { return teamId == 1 ? 0 : (teamId == 2 ? 1 : -1); }
+    static i32 teamOf(const Registry& registry, Entity entity);
+
+    VisionSettings settings_;
+    const Registry* registry_ = nullptr;
+    u64 terrainRevision_ = ~0ull;
+
+    i32 width_ = 0;
+    i32 height_ = 0;
+    f32 tileSize_ = 128.0f;
+    Vec3 origin_ = Vec3(0.0f);
+    Vector<i16> levels_;                // Highest corner level of each tile
+    Vector<u16> seenBy_[kTeamCount];    // Viewers currently seeing each tile
+
+    Map<Entity, Viewer> viewers_;
+    u32 tick_ = 0;
+};
+
+} // namespace WorldEditor
@@ -105,6 +105,11 @@ public:
         return serverWorld_->getEntityManager();
     }
     
+    // Underlying authoritative world (scheduler, tick control)
+    ServerWorld& getServerWorld() {
+        return *serverWorld_;
+    }
+    
     const EntityManager& getEntityManager() const {
         return serverWorld_->getEntityManager();
     }
@@ -1,5 +1,4 @@
 #include "World.h"
-#include "WorldLegacy.h"
 #include "CreepSystem.h"
 #include "ProjectileSystem.h"
 #include "TowerSystem.h"
@@ -7,6 +6,10 @@
 #include "CollisionSystem.h"
 #include "HeroSystem.h"
 
+#ifdef DIRECTX_RENDERER
+#include "WorldLegacy.h"
+#endif
+
 namespace WorldEditor {
 
 World::World() {
@@ -36,6 +39,9 @@ World::World(ID3D12Device* device) {
     // Add Hero System
     serverWorld_->addSystem(std::make_unique<HeroSystem>(entityManager));
     
+    // Rendered world: give pooled projectiles mesh entities
+    entityManager.getProjectiles().setVisualsEnabled(true);
+    
     // Set world reference for systems that need it (after all systems are added)
     entityManager.setWorld(this);
 }
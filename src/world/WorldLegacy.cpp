@@ -42,6 +42,9 @@ WorldLegacy::WorldLegacy(ID3D12Device* device) : device_(device) {
     // heroSystem->setWorld(this); // WorldLegacy is deprecated
     addSystem(std::move(heroSystem));
     
+    // Rendered world: give pooled projectiles mesh entities
+    entityManager_.getProjectiles().setVisualsEnabled(true);
+    
     LOG_INFO("World initialized");
 }
 
@@ -98,6 +101,9 @@ const System* WorldLegacy::getSystem(const String& name) const {
 }
 
 void WorldLegacy::update(f32 deltaTime, bool gameModeActive) {
+    entityManager_.rebuildSpatialGrid();
+    entityManager_.getCombatEvents().clearKills();
+    
     for (auto& pair : systems_) {
         // Only update game systems (like CreepSystem) when game mode is active
         String systemName = pair.second->getName();
@@ -105,6 +111,8 @@ void WorldLegacy::update(f32 deltaTime, bool gameModeActive) {
             continue; // Skip CreepSystem when not in game mode
         }
         pair.second->update(deltaTime);
+        entityManager_.resolveCombat();
+        entityManager_.flushCommands();
     }
 }
 
@@ -1378,9 +1386,9 @@ void WorldLegacy::startGame() {
             heroSystem->setPlayerHero(playerHero);
             
             // Give starting items
-            heroSystem->giveItem(playerHero, HeroSystem::createItem_Tango());
-            heroSystem->giveItem(playerHero, HeroSystem::createItem_IronBranch());
-            heroSystem->giveItem(playerHero, HeroSystem::createItem_IronBranch());
+            heroSystem->giveItem(playerHero, "tango");
+            heroSystem->giveItem(playerHero, "iron_branch");
+            heroSystem->giveItem(playerHero, "iron_branch");
             
             // Learn first ability
             heroSystem->learnAbility(playerHero, 0);
@@ -1397,8 +1405,8 @@ void WorldLegacy::startGame() {
                 enemyComp.heroName = "Enemy Mage";
                 
                 // Give enemy some items too
-                heroSystem->giveItem(enemyHero, HeroSystem::createItem_IronBranch());
-                heroSystem->giveItem(enemyHero, HeroSystem::createItem_IronBranch());
+                heroSystem->giveItem(enemyHero, "iron_branch");
+                heroSystem->giveItem(enemyHero, "iron_branch");
                 
                 // Learn abilities
                 heroSystem->learnAbility(enemyHero, 0);
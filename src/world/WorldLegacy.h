@@ -29,6 +29,7 @@ public:
 
     void update(f32 deltaTime) override {}
     String getName() const override { return "RenderSystem"; }
+    void declareAccess(SystemAccess& /*access*/) const override {} // Renders outside the tick
 
     void render(ID3D12GraphicsCommandList* commandList,
                 const Mat4& viewProjMatrix,
@@ -0,0 +1,107 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/AiLodScheduler.h"
+#include "world/EntityManager.h"
+#include "world/HeroSystem.h"
+#include <thread>
+
+using namespace WorldEditor;
+
+namespace {
+
+constexpr f32 kDt = 1.0f / 30.0f;
+
+Vector<Entity> makeAgents(EntityManager& em, u32 count) {
+    Vector<Entity> agents;
+    for (u32 i = 0; i < count; ++i) {
+        agents.push_back(em.createEntity("Agent"));
+    }
+    return agents;
+}
+
+} // namespace
+
+TEST_CASE("AiLodScheduler - Agents of one LOD are spread over the interval", "[ai_lod]") {
+    EntityManager em;
+    Vector<Entity> agents = makeAgents(em, 90);
+
+    AiLodScheduler lod;
+    AiLodSettings settings;
+    settings.lowInterval = 0.3f;   // 9 ticks at 30 Hz
+    lod.setSettings(settings);
+
+    Map<Entity, u32> thinksPerAgent;
+    for (i32 tick = 0; tick < 90; ++tick) {
+        lod.beginTick(em, kDt);
+        for (Entity agent : agents) {
+            if (lod.shouldThink(agent, AiLod::Low)) {
+                thinksPerAgent[agent]++;
+            }
+        }
+        // 90 agents / 9 buckets: a flat 10 per tick instead of 90 every 9th tick
+        REQUIRE(lod.getThinkCount() == 10);
+    }
+
+    for (Entity agent : agents) {
+        REQUIRE(thinksPerAgent[agent] == 10);
+    }
+}
+
+TEST_CASE("AiLodScheduler - Agents near heroes or in combat think more often", "[ai_lod]") {
+    EntityManager em;
+    Entity hero = em.createEntity("Hero");
+    em.addComponent<TransformComponent>(hero).position = Vec3(0.0f, 0.0f, 0.0f);
+    em.addComponent<HeroComponent>(hero);
+
+    AiLodScheduler lod;
+    lod.beginTick(em, kDt);
+
+    REQUIRE(lod.classify(Vec3(10.0f, 0.0f, 0.0f), false) == AiLod::High);
+    REQUIRE(lod.classify(Vec3(50.0f, 0.0f, 0.0f), false) == AiLod::Medium);
+    REQUIRE(lod.classify(Vec3(200.0f, 0.0f, 0.0f), false) == AiLod::Low);
+    REQUIRE(lod.classify(Vec3(200.0f, 0.0f, 0.0f), true) == AiLod::High);
+
+    // Dead heroes do not keep the area awake
+    em.getComponent<HeroComponent>(hero).state = HeroState::Dead;
+    lod.beginTick(em, kDt);
+    REQUIRE(lod.classify(Vec3(10.0f, 0.0f, 0.0f), false) == AiLod::Low);
+
+    Vector<Entity> agents = makeAgents(em, 2);
+    u32 highThinks = 0;
+    u32 lowThinks = 0;
+    for (i32 tick = 0; tick < 300; ++tick) {
+        lod.beginTick(em, kDt);
+        highThinks += lod.shouldThink(agents[0], AiLod::High) ? 1 : 0;
+        lowThinks += lod.shouldThink(agents[1], AiLod::Low) ? 1 : 0;
+    }
+    REQUIRE(highThinks == 100);
+    REQUIRE(lowThinks == 10);
+}
+
+TEST_CASE("AiLodScheduler - Budget defers thinks but never starves an agent", "[ai_lod]") {
+    EntityManager em;
+    Vector<Entity> agents = makeAgents(em, 4);
+
+    AiLodScheduler lod;
+    AiLodSettings settings;
+    settings.highInterval = kDt;   // Every tick
+    settings.budgetMicroseconds = 1;
+    lod.setSettings(settings);
+
+    // The sleep spends the budget before any agent asks
+    for (i32 tick = 0; tick < 10; ++tick) {
+        lod.beginTick(em, kDt);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        u32 thinks = 0;
+        for (Entity agent : agents) {
+            thinks += lod.shouldThink(agent, AiLod::High) ? 1 : 0;
+        }
+        // Deferred agents are a whole interval late on the next tick and run regardless
+        if (tick % 2 == 0) {
+            REQUIRE(thinks == 0);
+            REQUIRE(lod.getDeferredCount() == 4);
+        } else {
+            REQUIRE(thinks == 4);
+            REQUIRE(lod.getDeferredCount() == 0);
+        }
+    }
+}
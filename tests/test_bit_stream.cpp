@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "common/BitStream.h"
+#include "common/GameSnapshot.h"
+#include <cmath>
+#include <random>
+
+using namespace WorldEditor;
+
+namespace {
+
+EntitySnapshot randomEntity(std::mt19937& rng, NetworkId id) {
+    std::uniform_real_distribution<f32> mapCoord(0.0f, 16000.0f);
+    std::uniform_real_distribution<f32> height(0.0f, 512.0f);
+    std::uniform_real_distribution<f32> angle(-3.14159f, 3.14159f);
+    std::uniform_real_distribution<f32> unit(0.0f, 1.0f);
+
+    EntitySnapshot entity;
+    entity.networkId = id;
+    entity.position = Vec3(mapCoord(rng), height(rng), mapCoord(rng));
+    entity.velocity = Vec3(unit(rng) * 600.0f - 300.0f, 0.0f, unit(rng) * 600.0f - 300.0f);
+    const f32 yaw = angle(rng);
+    entity.rotation = Quat(std::cos(yaw * 0.5f), 0.0f, std::sin(yaw * 0.5f), 0.0f);
+    entity.maxHealth = std::floor(200.0f + unit(rng) * 3000.0f);
+    entity.health = entity.maxHealth * unit(rng);
+    entity.maxMana = std::floor(unit(rng) * 1500.0f);
+    entity.mana = entity.maxMana * unit(rng);
+    entity.stateFlags = static_cast<u32>(rng());
+    entity.teamId = static_cast<TeamId>(rng() % 3);
+    entity.entityType = static_cast<u8>(rng() % 4);
+    entity.ownerClientId = rng() % 11;
+    return entity;
+}
+
+WorldSnapshot randomWorld(u32 seed, size_t entityCount) {
+    std::mt19937 rng(seed);
+    WorldSnapshot snapshot;
+    snapshot.tick = 1234;
+    snapshot.serverTime = 41.1f;
+    snapshot.gameTime = 41.1f;
+    snapshot.currentWave = 3;
+    for (size_t i = 0; i < entityCount; ++i) {
+        snapshot.entities.push_back(randomEntity(rng, static_cast<NetworkId>(i + 1)));
+    }
+    return snapshot;
+}
+
+} // namespace
+
+TEST_CASE("BitStream - Mixed-width values round-trip", "[bitstream]") {
+    std::mt19937 rng(7);
+    u8 buffer[2048];
+
+    for (i32 round = 0; round < 50; ++round) {
+        Vector<std::pair<u32, u32>> values;
+        BitWriter writer(buffer, sizeof(buffer));
+        for (i32 i = 0; i < 100; ++i) {
+            const u32 bits = 1 + rng() % 32;
+            const u32 value = bits == 32 ? static_cast<u32>(rng()) : static_cast<u32>(rng()) & ((1u << bits) - 1u);
+            values.push_back({value, bits});
+            writer.writeBits(value, bits);
+        }
+        const u32 varint = static_cast<u32>(rng()) >> (rng() % 32);
+        writer.writeVarint(varint);
+        writer.writeFloat(-1.5e-3f);
+        REQUIRE_FALSE(writer.overflowed());
+
+        BitReader reader(buffer, writer.getBytesWritten());
+        for (const auto& [value, bits] : values) {
+            REQUIRE(reader.readBits(bits) == value);
+        }
+        REQUIRE(reader.readVarint() == varint);
+        REQUIRE(reader.readFloat() == -1.5e-3f);
+        REQUIRE_FALSE(reader.hasError());
+
+        // Nothing left to read
+        reader.readBits(8);
+        REQUIRE(reader.hasError());
+    }
+}
+
+TEST_CASE("BitStream - Byte layout does not depend on the host", "[bitstream]") {
+    u8 buffer[8] = {};
+    BitWriter writer(buffer, sizeof(buffer));
+    writer.writeBits(0x5, 3);
+    writer.writeBits(0x1234, 16);
+    writer.writeVarint(300);
+    REQUIRE(writer.getBytesWritten() == 5);
+    // 101 | 0x1234 from bit 3 | 0xAC 0x02 from bit 19
+    REQUIRE(buffer[0] == 0xA5);
+    REQUIRE(buffer[1] == 0x91);
+    REQUIRE(buffer[2] == 0x60);
+    REQUIRE(buffer[3] == 0x15);
+    REQUIRE(buffer[4] == 0x00);
+
+    // Overflow drops the write; a rewind makes room again
+    u8 small[1];
+    BitWriter full(small, sizeof(small));
+    full.writeBits(0x3F, 6);
+    const size_t mark = full.getBitPosition();
+    full.writeBits(0xF, 4);
+    REQUIRE(full.overflowed());
+    full.rewind(mark);
+    full.writeBits(0x2, 2);
+    REQUIRE_FALSE(full.overflowed());
+    REQUIRE(small[0] == 0xBF);
+}
+
+TEST_CASE("BitStream - Quantized entities stay within the wire precision", "[bitstream][snapshots]") {
+    const WorldSnapshot world = randomWorld(42, 100);
+    u8 buffer[4096];
+    const size_t size = world.serialize(buffer, sizeof(buffer));
+    REQUIRE(size > 0);
+    // Well under the raw struct copy
+    REQUIRE(size * 2 < world.entities.size() * sizeof(EntitySnapshot));
+
+    WorldSnapshot decoded;
+    REQUIRE(decoded.deserialize(buffer, size));
+    REQUIRE(decoded.tick == world.tick);
+    REQUIRE(decoded.entities.size() == world.entities.size());
+
+    for (size_t i = 0; i < world.entities.size(); ++i) {
+        const EntitySnapshot& sent = world.entities[i];
+        const EntitySnapshot& got = decoded.entities[i];
+        REQUIRE(got.networkId == sent.networkId);
+        REQUIRE(std::abs(got.position.x - sent.position.x) <= 0.05f);
+        REQUIRE(std::abs(got.position.y - sent.position.y) <= 0.07f);
+        REQUIRE(std::abs(got.position.z - sent.position.z) <= 0.05f);
+        REQUIRE(std::abs(got.velocity.x - sent.velocity.x) <= 0.04f);
+        REQUIRE(std::abs(std::abs(got.rotation.w * sent.rotation.w + got.rotation.y * sent.rotation.y) - 1.0f) <= 1e-5f);
+        REQUIRE(got.maxHealth == sent.maxHealth);
+        REQUIRE(std::abs(got.health - sent.health) <= sent.maxHealth / 65535.0f);
+        REQUIRE(std::abs(got.mana - sent.mana) <= sent.maxMana / 65535.0f + 1e-4f);
+        REQUIRE(got.stateFlags == sent.stateFlags);
+        REQUIRE(got.teamId == sent.teamId);
+        REQUIRE(got.entityType == sent.entityType);
+        REQUIRE(got.ownerClientId == sent.ownerClientId);
+
+        // quantize() predicts the decoded value exactly
+        EntitySnapshot predicted = sent;
+        EntitySnapshotCodec::quantize(predicted);
+        REQUIRE(EntitySnapshotCodec::changedFields(predicted, got) == 0);
+    }
+
+    // Truncated data is rejected, not half-read
+    REQUIRE_FALSE(decoded.deserialize(buffer, size - 1));
+}
+
+// Hidden from the default run: simulation_tests "[benchmark]"
+TEST_CASE("BitStream - Snapshot encode/decode throughput", "[.][benchmark][snapshots]") {
+    const WorldSnapshot world = randomWorld(99, 300);
+    static u8 buffer[16384];
+    const size_t size = world.serialize(buffer, sizeof(buffer));
+
+    BENCHMARK("encode " + std::to_string(world.entities.size()) + " entities") {
+        return world.serialize(buffer, sizeof(buffer));
+    };
+
+    WorldSnapshot decoded;
+    BENCHMARK("decode " + std::to_string(world.entities.size()) + " entities") {
+        return decoded.deserialize(buffer, size);
+    };
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch_test_macros.hpp>
+#include "client/ClientWorld.h"
+#include <cmath>
+
+using namespace WorldEditor;
+
+namespace {
+
+// One creep walking along +X at 10 units per second of server time
+WorldSnapshot makeSnapshot(TickNumber tick, f32 serverTime) {
+    WorldSnapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.serverTime = serverTime;
+    snapshot.gameTime = serverTime;
+
+    EntitySnapshot creep;
+    creep.networkId = 1;
+    creep.entityType = 2;
+    creep.position = Vec3(serverTime * 10.0f, 0.0f, 0.0f);
+    creep.health = creep.maxHealth = 500.0f;
+    creep.teamId = TEAM_DIRE;
+    snapshot.entities.push_back(creep);
+    return snapshot;
+}
+
+} // namespace
+
+TEST_CASE("ClientWorld - View time follows the server clock, not the client's", "[client]") {
+    ClientWorld world;
+    const f32 tickTime = NetworkConfig::SERVER_TICK_INTERVAL;
+
+    // The server has been up for minutes and the client's frame clock runs 5% fast
+    f32 serverTime = 500.0f;
+    TickNumber tick = 1;
+    for (i32 frame = 0; frame < 120; ++frame, ++tick) {
+        serverTime += tickTime;
+        world.applySnapshot(makeSnapshot(tick, serverTime));
+        world.update(tickTime * 1.05f);
+    }
+
+    // Within a couple of ticks of the newest snapshot minus the interpolation delay
+    const f32 expected = serverTime - NetworkConfig::INTERPOLATION_DELAY;
+    REQUIRE(std::abs(world.getViewTime() - expected) < 2.0f * tickTime);
+
+    // Remote entities are drawn where the server had them at the view time
+    const Entity creep = world.getEntityByNetworkId(1);
+    REQUIRE(creep != INVALID_ENTITY);
+    const f32 x = world.getComponent<TransformComponent>(creep).position.x;
+    REQUIRE(std::abs(x - world.getViewTime() * 10.0f) < 0.01f);
+
+    // A server that restarts its clock is followed at once
+    world.applySnapshot(makeSnapshot(tick, 1.0f));
+    REQUIRE(std::abs(world.getViewTime() - (1.0f - NetworkConfig::INTERPOLATION_DELAY)) < 0.001f);
+}
@@ -0,0 +1,135 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "world/EntityManager.h"
+#include "world/CollisionSystem.h"
+#include <random>
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity makeTree(EntityManager& em, const Vec3& position, f32 radius) {
+    Entity entity = em.createEntity("Tree");
+    em.addComponent<TransformComponent>(entity).position = position;
+    CollisionComponent col(CollisionShape::Sphere);
+    col.radius = radius;
+    col.isStatic = true;
+    col.blocksMovement = true;
+    em.addComponent<CollisionComponent>(entity, col);
+    return entity;
+}
+
+void plantForest(EntityManager& em, i32 treeCount, u32 seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<f32> coord(0.0f, 16000.0f);
+    std::uniform_real_distribution<f32> size(20.0f, 60.0f);
+    for (i32 i = 0; i < treeCount; ++i) {
+        makeTree(em, Vec3(coord(rng), 0.0f, coord(rng)), size(rng));
+    }
+}
+
+// Reference: the full scan the broadphase replaced
+bool bruteForceBlocked(EntityManager& em, const CollisionSystem& collision, const Vec3& position, f32 radius) {
+    auto view = em.getRegistry().view<CollisionComponent>();
+    for (auto entity : view) {
+        const auto& col = view.get<CollisionComponent>(entity);
+        if (col.isTrigger || !col.blocksMovement || !col.isStatic) {
+            continue;
+        }
+        if (collision.checkSphereCollision(entity, position, radius)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("CollisionSystem - Static broadphase matches full scan", "[collision]") {
+    EntityManager em;
+    plantForest(em, 2000, 5);
+
+    // One oversized building that spans many cells
+    Entity base = em.createEntity("Base");
+    em.addComponent<TransformComponent>(base).position = Vec3(8000.0f, 0.0f, 8000.0f);
+    auto& baseCol = em.addComponent<CollisionComponent>(base, CollisionShape::Box);
+    baseCol.boxSize = Vec3(1200.0f, 200.0f, 1200.0f);
+    baseCol.isStatic = true;
+
+    CollisionSystem collision(em);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<f32> coord(0.0f, 16000.0f);
+    for (i32 i = 0; i < 500; ++i) {
+        Vec3 probe(coord(rng), 0.0f, coord(rng));
+        REQUIRE(collision.hasBlockingCollisionAt(probe, 40.0f) == bruteForceBlocked(em, collision, probe, 40.0f));
+    }
+    REQUIRE(collision.hasBlockingCollisionAt(Vec3(8000.0f, 0.0f, 8400.0f), 10.0f));
+}
+
+TEST_CASE("CollisionSystem - Static broadphase follows editor changes", "[collision]") {
+    EntityManager em;
+    Entity tree = makeTree(em, Vec3(100.0f, 0.0f, 100.0f), 30.0f);
+    CollisionSystem collision(em);
+
+    REQUIRE(collision.hasBlockingCollisionAt(Vec3(100.0f, 0.0f, 100.0f), 5.0f));
+    REQUIRE_FALSE(collision.hasBlockingCollisionAt(Vec3(500.0f, 0.0f, 500.0f), 5.0f));
+    REQUIRE_FALSE(collision.hasBlockingCollisionAt(Vec3(100.0f, 0.0f, 100.0f), 5.0f, tree));
+
+    SECTION("Moved static object") {
+        em.getComponent<TransformComponent>(tree).position = Vec3(500.0f, 0.0f, 500.0f);
+        em.markStaticCollidersDirty();
+        REQUIRE(collision.hasBlockingCollisionAt(Vec3(500.0f, 0.0f, 500.0f), 5.0f));
+        REQUIRE_FALSE(collision.hasBlockingCollisionAt(Vec3(100.0f, 0.0f, 100.0f), 5.0f));
+    }
+
+    SECTION("Added and removed static objects") {
+        makeTree(em, Vec3(900.0f, 0.0f, 900.0f), 30.0f);
+        REQUIRE(collision.hasBlockingCollisionAt(Vec3(900.0f, 0.0f, 900.0f), 5.0f));
+
+        em.destroyEntity(tree);
+        REQUIRE_FALSE(collision.hasBlockingCollisionAt(Vec3(100.0f, 0.0f, 100.0f), 5.0f));
+    }
+
+    SECTION("Dynamic colliders do not invalidate the broadphase") {
+        const u64 revision = em.getStaticColliderRevision();
+        Entity creep = em.createEntity("Creep");
+        em.addComponent<TransformComponent>(creep);
+        em.addComponent<CollisionComponent>(creep, CollisionShape::Capsule);
+        em.destroyEntity(creep);
+        REQUIRE(em.getStaticColliderRevision() == revision);
+    }
+}
+
+// Hidden from the default run: simulation_tests "[benchmark]"
+TEST_CASE("CollisionSystem - Blocking checks vs tree count", "[.][benchmark][collision]") {
+    for (i32 treeCount : {500, 2000, 8000}) {
+        EntityManager em;
+        plantForest(em, treeCount, 3);
+        CollisionSystem collision(em);
+        collision.rebuildStaticColliders();
+
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<f32> coord(0.0f, 16000.0f);
+        Vector<Vec3> probes(256);
+        for (auto& probe : probes) {
+            probe = Vec3(coord(rng), 0.0f, coord(rng));
+        }
+
+        BENCHMARK("full scan, " + std::to_string(treeCount) + " trees") {
+            u32 blocked = 0;
+            for (const auto& probe : probes) {
+                blocked += bruteForceBlocked(em, collision, probe, 40.0f);
+            }
+            return blocked;
+        };
+
+        BENCHMARK("broadphase, " + std::to_string(treeCount) + " trees") {
+            u32 blocked = 0;
+            for (const auto& probe : probes) {
+                blocked += collision.hasBlockingCollisionAt(probe, 40.0f);
+            }
+            return blocked;
+        };
+    }
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "world/EntityManager.h"
+#include "world/HeroSystem.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity makeCreep(EntityManager& em, f32 health) {
+    Entity creep = em.createEntity("Creep");
+    auto& comp = em.addComponent<CreepComponent>(creep);
+    comp.maxHealth = health;
+    comp.currentHealth = health;
+    return creep;
+}
+
+Entity makeHero(EntityManager& em, f32 armor) {
+    Entity hero = em.createEntity("Hero");
+    auto& comp = em.addComponent<HeroComponent>(hero);
+    comp.armor = armor;
+    comp.maxHealth = 500.0f;
+    comp.currentHealth = 500.0f;
+    return hero;
+}
+
+} // namespace
+
+TEST_CASE("CombatEventBuffer - Damage is applied at resolve with mitigation", "[combat]") {
+    EntityManager em;
+    auto& combat = em.getCombatEvents();
+
+    Entity creep = makeCreep(em, 100.0f);
+    Entity hero = makeHero(em, 5.0f);
+    Entity tower = em.createEntity("Tower");
+    auto& towerHealth = em.addComponent<HealthComponent>(tower, 1000.0f);
+    towerHealth.magicResistance = 0.5f;
+
+    combat.damage(INVALID_ENTITY, creep, 30.0f, DamageType::Physical);
+    combat.damage(INVALID_ENTITY, hero, 100.0f, DamageType::Physical);
+    combat.damage(INVALID_ENTITY, hero, 100.0f, DamageType::Magical);
+    combat.damage(INVALID_ENTITY, tower, 100.0f, DamageType::Magical);
+    REQUIRE(combat.size() == 4);
+    REQUIRE(em.getComponent<CreepComponent>(creep).currentHealth == 100.0f);
+
+    REQUIRE(em.resolveCombat() == 4);
+    REQUIRE(combat.empty());
+    REQUIRE(em.getComponent<CreepComponent>(creep).currentHealth == Catch::Approx(70.0f));
+    const f32 physical = 100.0f * CombatEventBuffer::armorMultiplier(5.0f);
+    REQUIRE(em.getComponent<HeroComponent>(hero).currentHealth == Catch::Approx(500.0f - physical - 75.0f));
+    REQUIRE(towerHealth.currentHealth == Catch::Approx(950.0f));
+}
+
+TEST_CASE("CombatEventBuffer - Invulnerable and dead targets take nothing", "[combat]") {
+    EntityManager em;
+    auto& combat = em.getCombatEvents();
+
+    Entity hero = makeHero(em, 0.0f);
+    Buff invulnerable;
+    invulnerable.type = BuffType::Invulnerable;
+    invulnerable.duration = 1.0f;
+    em.getComponent<HeroComponent>(hero).modifiers.apply(invulnerable);
+
+    Entity creep = makeCreep(em, 50.0f);
+    Entity killer = makeHero(em, 0.0f);
+    Entity other = makeHero(em, 0.0f);
+
+    combat.damage(killer, hero, 1000.0f, DamageType::Pure);
+    combat.damage(killer, creep, 60.0f, DamageType::Pure);
+    combat.damage(other, creep, 60.0f, DamageType::Pure);
+    combat.heal(other, creep, 100.0f);
+    REQUIRE(em.resolveCombat() == 1);
+
+    REQUIRE(em.getComponent<HeroComponent>(hero).currentHealth == 500.0f);
+    REQUIRE(em.getComponent<CreepComponent>(creep).state == CreepState::Dead);
+    REQUIRE(em.getComponent<CreepComponent>(creep).currentHealth == 0.0f);
+
+    // One death, one credit: the overkill from the second hit is dropped
+    REQUIRE(combat.getKills().size() == 1);
+    REQUIRE(em.getComponent<HeroComponent>(killer).lastHits == 1);
+    REQUIRE(em.getComponent<HeroComponent>(other).lastHits == 0);
+}
+
+TEST_CASE("CombatEventBuffer - Kills pay the killing hero and are reported", "[combat]") {
+    EntityManager em;
+    auto& combat = em.getCombatEvents();
+
+    Entity killer = makeHero(em, 0.0f);
+    Entity victim = makeHero(em, 0.0f);
+    auto& victimHero = em.getComponent<HeroComponent>(victim);
+    victimHero.level = 3;
+    auto& killerHero = em.getComponent<HeroComponent>(killer);
+    const i32 goldBefore = killerHero.gold;
+
+    combat.damage(killer, victim, 10000.0f, DamageType::Pure);
+    em.resolveCombat();
+
+    REQUIRE(victimHero.state == HeroState::Dead);
+    REQUIRE(victimHero.deaths == 1);
+    REQUIRE(victimHero.respawnTimer == Catch::Approx(HeroSystem::calculateRespawnTime(3)));
+    REQUIRE(killerHero.kills == 1);
+    REQUIRE(killerHero.gold == goldBefore + 230);
+    REQUIRE(killerHero.experience == Catch::Approx(160.0f));
+
+    REQUIRE(combat.getKills().size() == 1);
+    const KillEvent& kill = combat.getKills()[0];
+    REQUIRE(kill.killer == killer);
+    REQUIRE(kill.victim == victim);
+    REQUIRE(kill.victimType == CombatTargetType::Hero);
+    REQUIRE(kill.killerIsHero);
+    REQUIRE_FALSE(kill.lastHit);
+    REQUIRE(kill.gold == 230);
+
+    combat.clearKills();
+    REQUIRE(combat.getKills().empty());
+}
+
+TEST_CASE("CombatEventBuffer - Sort key decides who lands the last hit", "[combat]") {
+    EntityManager em;
+    auto& combat = em.getCombatEvents();
+
+    Entity creep = makeCreep(em, 50.0f);
+    Entity first = makeHero(em, 0.0f);
+    Entity second = makeHero(em, 0.0f);
+
+    // Recorded out of order, e.g. by two parallel chunks
+    combat.damage(second, creep, 50.0f, DamageType::Pure, 1);
+    combat.damage(first, creep, 50.0f, DamageType::Pure, 0);
+    em.resolveCombat();
+
+    REQUIRE(combat.getKills().size() == 1);
+    REQUIRE(combat.getKills()[0].killer == first);
+    REQUIRE(combat.getKills()[0].lastHit);
+}
+
+TEST_CASE("CombatEventBuffer - Heals clamp to max health", "[combat]") {
+    EntityManager em;
+    auto& combat = em.getCombatEvents();
+
+    Entity creep = makeCreep(em, 100.0f);
+    em.getComponent<CreepComponent>(creep).currentHealth = 40.0f;
+
+    combat.heal(INVALID_ENTITY, creep, 30.0f);
+    em.resolveCombat();
+    REQUIRE(em.getComponent<CreepComponent>(creep).currentHealth == Catch::Approx(70.0f));
+
+    combat.heal(INVALID_ENTITY, creep, 500.0f);
+    em.resolveCombat();
+    REQUIRE(em.getComponent<CreepComponent>(creep).currentHealth == 100.0f);
+
+    // Events for destroyed entities are dropped
+    combat.damage(INVALID_ENTITY, creep, 10.0f, DamageType::Pure);
+    em.destroyEntity(creep);
+    REQUIRE(em.resolveCombat() == 0);
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+#include <algorithm>
+#include <string>
+#include <thread>
+
+using namespace WorldEditor;
+
+TEST_CASE("EntityCommandBuffer - Structural changes wait for flush", "[commands]") {
+    EntityManager em;
+    auto& commands = em.getCommandBuffer();
+
+    Entity unit = em.createEntity("Unit");
+    em.addComponent<TransformComponent>(unit);
+
+    commands.addComponent(unit, HealthComponent{});
+    commands.removeComponent<TransformComponent>(unit);
+    commands.create("Spawned", [&em](Entity entity) {
+        em.addComponent<TransformComponent>(entity).position = Vec3(1.0f, 2.0f, 3.0f);
+    });
+
+    REQUIRE(commands.size() == 3);
+    REQUIRE_FALSE(em.hasComponent<HealthComponent>(unit));
+    REQUIRE(em.getEntityCount() == 1);
+
+    REQUIRE(em.flushCommands() == 3);
+    REQUIRE(commands.empty());
+    REQUIRE(em.hasComponent<HealthComponent>(unit));
+    REQUIRE_FALSE(em.hasComponent<TransformComponent>(unit));
+
+    auto spawned = em.getEntitiesWithName("Spawned");
+    REQUIRE(spawned.size() == 1);
+    REQUIRE(em.getComponent<TransformComponent>(spawned[0]).position == Vec3(1.0f, 2.0f, 3.0f));
+}
+
+TEST_CASE("EntityCommandBuffer - Commands on destroyed entities are skipped", "[commands]") {
+    EntityManager em;
+    auto& commands = em.getCommandBuffer();
+    Entity unit = em.createEntity("Unit");
+
+    commands.destroy(unit);
+    commands.destroy(unit);
+    commands.addComponent(unit, HealthComponent{});
+    em.flushCommands();
+
+    REQUIRE_FALSE(em.isValid(unit));
+    REQUIRE(em.getEntityCount() == 0);
+}
+
+TEST_CASE("EntityCommandBuffer - Flush order is deterministic across threads", "[commands]") {
+    auto run = []() {
+        EntityManager em;
+        auto& commands = em.getCommandBuffer();
+
+        Vector<std::thread> producers;
+        for (u32 key = 0; key < 4; ++key) {
+            producers.emplace_back([&commands, key]() {
+                for (i32 i = 0; i < 50; ++i) {
+                    commands.create("P" + std::to_string(key) + "_" + std::to_string(i), nullptr, key);
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+        em.flushCommands();
+
+        // Entity ids are handed out in flush order
+        Vector<std::pair<u32, String>> created;
+        auto view = em.getRegistry().view<NameComponent>();
+        for (auto entity : view) {
+            created.emplace_back(static_cast<u32>(entity), view.get<NameComponent>(entity).name);
+        }
+        std::sort(created.begin(), created.end());
+        return created;
+    };
+
+    auto first = run();
+    REQUIRE(first.size() == 200);
+    REQUIRE(first.front().second == "P0_0");
+    REQUIRE(first.back().second == "P3_49");
+    for (i32 attempt = 0; attempt < 5; ++attempt) {
+        REQUIRE(run() == first);
+    }
+}
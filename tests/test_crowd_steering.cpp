@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "world/EntityManager.h"
+#include "world/CreepSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace WorldEditor;
+
+namespace {
+
+void addWaypoint(EntityManager& em, const Vec3& position, i32 order) {
+    Entity entity = em.createEntity("Waypoint");
+    em.addComponent<TransformComponent>(entity).position = position;
+    auto& obj = em.addComponent<ObjectComponent>(entity, ObjectType::Waypoint);
+    obj.waypointOrder = order;
+    obj.waypointLane = static_cast<i32>(CreepLane::Middle);
+}
+
+// One team marching down a straight lane in a tight clump
+void spawnWave(EntityManager& em, i32 waveSize) {
+    addWaypoint(em, Vec3(50.0f, 0.0f, 0.0f), 0);
+    addWaypoint(em, Vec3(400.0f, 0.0f, 0.0f), 1);
+
+    for (i32 i = 0; i < waveSize; ++i) {
+        Entity entity = em.createEntity("Creep");
+        auto& transform = em.addComponent<TransformComponent>(entity);
+        transform.position = Vec3((i / 3) * -1.0f, 0.0f, (i % 3) * 0.5f);
+
+        auto& creep = em.addComponent<CreepComponent>(entity, 1, CreepLane::Middle);
+        creep.formationIndex = i;
+        creep.pathId = LanePathTable::idFor(CreepLane::Middle, 1);
+    }
+}
+
+Vector<Vec3> simulate(i32 waveSize, i32 ticks, const CrowdSettings& settings) {
+    EntityManager em;
+    spawnWave(em, waveSize);
+    CreepSystem creeps(em);
+    creeps.getCrowdSteering().setSettings(settings);
+
+    for (i32 tick = 0; tick < ticks; ++tick) {
+        em.rebuildSpatialGrid();
+        creeps.update(1.0f / 30.0f);
+    }
+
+    Vector<Vec3> positions;
+    auto view = em.getRegistry().view<CreepComponent, TransformComponent>();
+    for (auto entity : view) {
+        positions.push_back(view.get<TransformComponent>(entity).position);
+    }
+    return positions;
+}
+
+f32 minSpacing(const Vector<Vec3>& positions) {
+    f32 best = 1e9f;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        for (size_t j = i + 1; j < positions.size(); ++j) {
+            best = std::min(best, glm::length(positions[i] - positions[j]));
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+TEST_CASE("CrowdSteering - Simulation is deterministic", "[crowd]") {
+    CrowdSettings settings;
+    Vector<Vec3> first = simulate(24, 90, settings);
+    Vector<Vec3> second = simulate(24, 90, settings);
+
+    REQUIRE(first.size() == second.size());
+    REQUIRE(std::memcmp(first.data(), second.data(), first.size() * sizeof(Vec3)) == 0);
+}
+
+TEST_CASE("CrowdSteering - Wave spreads out and keeps following the lane", "[crowd]") {
+    CrowdSettings settings;
+    Vector<Vec3> positions = simulate(12, 150, settings);
+
+    REQUIRE(positions.size() == 12);
+    REQUIRE(minSpacing(positions) > 0.25f);
+    for (const auto& position : positions) {
+        // Moved forward along +X and stayed near the lane
+        REQUIRE(position.x > 5.0f);
+        REQUIRE(std::abs(position.z) < 10.0f);
+    }
+}
+
+TEST_CASE("CrowdSteering - A wave does not refresh its neighbours in one tick", "[crowd]") {
+    EntityManager em;
+    spawnWave(em, 24);
+    CreepSystem creeps(em);
+    em.rebuildSpatialGrid();
+    creeps.update(1.0f / 30.0f);
+
+    Vector<f32> cooldowns;
+    auto view = em.getRegistry().view<CreepComponent>();
+    for (auto entity : view) {
+        const auto& creep = view.get<CreepComponent>(entity);
+        REQUIRE(creep.crowdNeighborsBuilt);
+        cooldowns.push_back(creep.crowdRefreshCooldown);
+    }
+    std::sort(cooldowns.begin(), cooldowns.end());
+    cooldowns.erase(std::unique(cooldowns.begin(), cooldowns.end()), cooldowns.end());
+    REQUIRE(cooldowns.size() > 4);
+}
+
+// Hidden from the default run: simulation_tests "[benchmark]"
+TEST_CASE("CrowdSteering - Wave size scaling", "[.][benchmark][crowd]") {
+    for (i32 waveSize : {25, 100, 400, 1000}) {
+        EntityManager em;
+        spawnWave(em, waveSize);
+        CreepSystem creeps(em);
+
+        BENCHMARK("creep movement tick, wave of " + std::to_string(waveSize)) {
+            em.rebuildSpatialGrid();
+            creeps.update(1.0f / 30.0f);
+            return em.getEntityCount();
+        };
+    }
+}
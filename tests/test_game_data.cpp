@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/GameData.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+const char* kSmallData = R"({
+    "version": 1,
+    "abilities": {
+        "zap": { "name": "Zap", "target": "unit", "element": "lightning", "damage": 80, "hotkey": "Q" },
+        "quake": { "name": "Quake", "target": "point", "radius": 250 },
+        "roar": { "name": "Roar", "target": "none", "duration": 5, "buff_visual": "shield" }
+    },
+    "items": {
+        "salve": { "name": "Salve", "consumable": true,
+                   "active": { "effect": "heal_over_time", "value": 400, "duration": 8 } }
+    },
+    "heroes": {
+        "Brute": { "primary": "strength", "abilities": ["quake", "roar"] },
+        "Sage": { "primary": "intelligence", "move_speed": 310, "abilities": ["zap"] }
+    },
+    "hero_aliases": { "Ogre": "Brute" },
+    "fallback_hero": "Sage"
+})";
+
+} // namespace
+
+TEST_CASE("GameDataRegistry - Effects and visuals are resolved at load", "[gamedata]") {
+    GameDataRegistry data;
+    String error;
+    REQUIRE(data.loadFromString(kSmallData, &error));
+    REQUIRE(data.getAbilityCount() == 3);
+    REQUIRE(data.getAbility(0) == nullptr);
+
+    const AbilityData* zap = data.getAbility(data.findAbility("zap"));
+    REQUIRE(zap != nullptr);
+    REQUIRE(zap->id == data.findAbility("zap"));
+    REQUIRE(zap->effect == AbilityEffect::TargetNuke);
+    REQUIRE(zap->hitVisual == AbilityVisual::Lightning);
+    REQUIRE(zap->areaVisual == AbilityVisual::LightningStrikes);
+    REQUIRE(zap->hotkey == 'Q');
+    REQUIRE(zap->damage == 80.0f);
+    // Unset fields keep the AbilityData defaults
+    REQUIRE(zap->manaCost == 100.0f);
+
+    // Effects implied by targeting when the data does not name one
+    const AbilityData* quake = data.getAbility(data.findAbility("quake"));
+    REQUIRE(quake->effect == AbilityEffect::AreaNuke);
+    REQUIRE(quake->areaVisual == AbilityVisual::Explosion);
+    const AbilityData* roar = data.getAbility(data.findAbility("roar"));
+    REQUIRE(roar->effect == AbilityEffect::SelfBuff);
+    REQUIRE(roar->buffVisual == AbilityVisual::Shield);
+
+    const ItemData* salve = data.getItem(data.findItem("salve"));
+    REQUIRE(salve != nullptr);
+    REQUIRE(salve->hasActive);
+    REQUIRE(salve->activeEffect == ItemEffect::HealOverTime);
+    REQUIRE(salve->activeValue == 400.0f);
+    REQUIRE(data.findItem("missing") == 0);
+}
+
+TEST_CASE("GameDataRegistry - Heroes resolve by name, alias and fallback", "[gamedata]") {
+    GameDataRegistry data;
+    REQUIRE(data.loadFromString(kSmallData));
+
+    const HeroDefinition* brute = data.findHero("Ogre");
+    REQUIRE(brute != nullptr);
+    REQUIRE(brute->name == "Brute");
+    REQUIRE(brute->abilities[0] == data.findAbility("quake"));
+    REQUIRE(brute->abilities[1] == data.findAbility("roar"));
+    REQUIRE(brute->abilities[2] == 0);
+
+    const HeroDefinition* unknown = data.findHero("Nobody");
+    REQUIRE(unknown != nullptr);
+    REQUIRE(unknown->name == "Sage");
+    REQUIRE(unknown->primaryAttribute == HeroAttribute::Intelligence);
+    REQUIRE(unknown->moveSpeed == 310.0f);
+}
+
+TEST_CASE("GameDataRegistry - Bad data is rejected and leaves the registry empty", "[gamedata]") {
+    GameDataRegistry data;
+    String error;
+
+    REQUIRE_FALSE(data.loadFromString(R"({ "version": 1, "abilities": { "a": { "element": "plasma" } } })", &error));
+    REQUIRE(error.find("plasma") != String::npos);
+    REQUIRE(data.getAbilityCount() == 0);
+
+    REQUIRE_FALSE(data.loadFromString(R"({ "version": 1, "heroes": { "H": { "abilities": ["nope"] } } })", &error));
+    REQUIRE(data.findHero("H") == nullptr);
+
+    REQUIRE_FALSE(data.loadFromString(R"({ "version": 2 })", &error));
+    REQUIRE_FALSE(data.loadFromString("{ not json", &error));
+}
+
+TEST_CASE("GameDataRegistry - Shipped data file loads", "[gamedata]") {
+    GameDataRegistry data;
+    String error;
+    REQUIRE(data.loadFromFile(GAME_DATA_FILE, &error));
+
+    for (const char* hero : { "Warrior", "Mage", "Assassin" }) {
+        const HeroDefinition* def = data.findHero(hero);
+        REQUIRE(def != nullptr);
+        REQUIRE(def->name == hero);
+        for (u16 id : def->abilities) {
+            REQUIRE(data.getAbility(id) != nullptr);
+        }
+    }
+    REQUIRE(data.findHero("Lina")->name == "Mage");
+    REQUIRE(data.findItem("iron_branch") != 0);
+    REQUIRE(data.findItem("tango") != 0);
+}
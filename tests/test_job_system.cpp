@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "core/JobSystem.h"
+#include "world/EntityManager.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <string>
+
+using namespace WorldEditor;
+
+namespace {
+
+JobSystemConfig workers(i32 count) {
+    JobSystemConfig config;
+    config.workerCount = count;
+    return config;
+}
+
+// Float sum whose result depends on association order
+f32 reduceSum(JobSystem& jobs, const Vector<f32>& values, JobSystem::ReduceMode mode) {
+    return jobs.parallelReduce(static_cast<u32>(values.size()), 64, 0.0f,
+        [&](u32 begin, u32 end) {
+            f32 sum = 0.0f;
+            for (u32 i = begin; i < end; ++i) {
+                sum += values[i];
+            }
+            return sum;
+        },
+        [](f32 a, f32 b) { return a + b; },
+        mode);
+}
+
+f32 burn(u32 i) {
+    f32 x = static_cast<f32>(i);
+    for (i32 k = 0; k < 64; ++k) {
+        x = std::sin(x) * 1.0001f + 0.5f;
+    }
+    return x;
+}
+
+} // namespace
+
+TEST_CASE("JobSystem - parallelFor visits every index once", "[jobs]") {
+    for (i32 workerCount : {0, 1, 3}) {
+        JobSystem jobs(workers(workerCount));
+        Vector<std::atomic<u32>> hits(10007);
+        jobs.parallelFor(static_cast<u32>(hits.size()), 100, [&](u32 begin, u32 end) {
+            for (u32 i = begin; i < end; ++i) {
+                hits[i].fetch_add(1);
+            }
+        });
+        for (const auto& hit : hits) {
+            REQUIRE(hit.load() == 1u);
+        }
+    }
+}
+
+TEST_CASE("JobSystem - Nested parallelFor completes", "[jobs]") {
+    JobSystem jobs(workers(2));
+    std::atomic<u32> total{0};
+    jobs.parallelFor(16, 1, [&](u32 begin, u32 end) {
+        for (u32 i = begin; i < end; ++i) {
+            jobs.parallelFor(100, 10, [&](u32 innerBegin, u32 innerEnd) {
+                total.fetch_add(innerEnd - innerBegin);
+            });
+        }
+    });
+    REQUIRE(total.load() == 1600u);
+}
+
+TEST_CASE("JobSystem - Deterministic reduction ignores worker count", "[jobs]") {
+    Vector<f32> values(50000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 1.0f / static_cast<f32>(i + 1) * (i % 2 ? -1.0f : 1.0f) * 1000.0f;
+    }
+
+    JobSystem serial(workers(0));
+    const f32 expected = reduceSum(serial, values, JobSystem::ReduceMode::Deterministic);
+    for (i32 workerCount : {1, 3, 7}) {
+        JobSystem jobs(workers(workerCount));
+        for (i32 run = 0; run < 5; ++run) {
+            REQUIRE(reduceSum(jobs, values, JobSystem::ReduceMode::Deterministic) == expected);
+        }
+    }
+}
+
+TEST_CASE("EntityManager - parallelForEach and parallelReduce", "[jobs]") {
+    EntityManager em;
+    for (i32 i = 0; i < 3000; ++i) {
+        Entity entity = em.createEntity("Unit");
+        em.addComponent<TransformComponent>(entity).position = Vec3(static_cast<f32>(i) * 0.37f, 0.0f, 0.0f);
+        if (i % 3 == 0) {
+            em.addComponent<HealthComponent>(entity);
+        }
+    }
+
+    auto sumX = [&em]() {
+        return em.parallelReduce<TransformComponent>(0.0f,
+            [](Entity, const TransformComponent& transform) { return transform.position.x; },
+            [](f32 a, f32 b) { return a + b; }, 128);
+    };
+    const f32 serialSum = sumX();
+
+    JobSystem jobs(workers(3));
+    em.setJobSystem(&jobs);
+
+    em.parallelForEach<TransformComponent, HealthComponent>(
+        [](Entity, TransformComponent& transform, HealthComponent&) {
+            transform.position.y = 1.0f;
+        }, 64);
+
+    i32 raised = 0;
+    em.forEach<TransformComponent>([&](Entity, TransformComponent& transform) {
+        raised += transform.position.y == 1.0f;
+    });
+    REQUIRE(raised == 1000);
+    REQUIRE(sumX() == serialSum);
+
+    em.setJobSystem(nullptr);
+}
+
+// Hidden from the default run: simulation_tests "[benchmark]"
+TEST_CASE("JobSystem - Scheduling overhead", "[.][benchmark][jobs]") {
+    JobSystem jobs;
+
+    BENCHMARK("submit + wait, 1000 empty jobs") {
+        JobCounter counter;
+        for (i32 i = 0; i < 1000; ++i) {
+            jobs.submit(counter, []() {});
+        }
+        jobs.wait(counter);
+        return counter.isDone();
+    };
+
+    BENCHMARK("parallelFor, 1 element per chunk x 1000") {
+        std::atomic<u32> count{0};
+        jobs.parallelFor(1000, 1, [&](u32 begin, u32 end) { count.fetch_add(end - begin); });
+        return count.load();
+    };
+}
+
+TEST_CASE("JobSystem - Scaling from 1 to N cores", "[.][benchmark][jobs]") {
+    Vector<f32> out(200000);
+    const i32 hardware = std::max(1, static_cast<i32>(std::thread::hardware_concurrency()));
+
+    Vector<i32> threadCounts;
+    for (i32 threads = 1; threads < hardware; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(hardware);
+
+    for (i32 threads : threadCounts) {
+        JobSystem jobs(workers(threads - 1));
+        BENCHMARK(std::to_string(threads) + " thread(s), 200k elements") {
+            jobs.parallelFor(static_cast<u32>(out.size()), 1024, [&](u32 begin, u32 end) {
+                for (u32 i = begin; i < end; ++i) {
+                    out[i] = burn(i);
+                }
+            });
+            return out[out.size() / 2];
+        };
+    }
+}
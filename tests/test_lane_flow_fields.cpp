@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+#include "world/CreepSystem.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+// Flat 10x10 unit tiles with a middle lane along z = 5.5
+void addLaneMap(EntityManager& em) {
+    Entity terrain = em.createEntity("Terrain");
+    em.addComponent<TransformComponent>(terrain);
+    auto& t = em.addComponent<TerrainComponent>(terrain);
+    t.tilesX = 10;
+    t.tilesZ = 10;
+    t.tileSize = 1.0f;
+    t.heightStep = 1.0f;
+    t.resolution = Vec2i(11, 11);
+    t.heightLevels.assign(11 * 11, 0);
+
+    for (i32 i = 0; i < 2; ++i) {
+        Entity waypoint = em.createEntity("Waypoint");
+        em.addComponent<TransformComponent>(waypoint).position = Vec3(i == 0 ? 0.5f : 9.5f, 0.0f, 5.5f);
+        auto& obj = em.addComponent<ObjectComponent>(waypoint, ObjectType::Waypoint);
+        obj.waypointOrder = i;
+        obj.waypointLane = static_cast<i32>(CreepLane::Middle);
+    }
+}
+
+Entity addTower(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity tower = em.createEntity("Tower");
+    em.addComponent<TransformComponent>(tower).position = position;
+    em.addComponent<ObjectComponent>(tower, ObjectType::Tower).teamId = teamId;
+    em.addComponent<HealthComponent>(tower);
+    return tower;
+}
+
+} // namespace
+
+TEST_CASE("LaneFlowFields - Creeps flow along the lane to the first enemy tower", "[flowfields]") {
+    EntityManager em;
+    addLaneMap(em);
+    Entity outer = addTower(em, Vec3(4.5f, 0.0f, 5.5f), 2);
+    addTower(em, Vec3(7.5f, 0.0f, 5.5f), 2);
+    addTower(em, Vec3(2.5f, 0.0f, 5.5f), 1);     // Friendly, ignored
+    addTower(em, Vec3(4.5f, 0.0f, 0.5f), 2);     // Off the lane, ignored
+
+    const LaneFlowFields& fields = em.getLaneFlowFields();
+    const LanePathId radiantMid = LanePathTable::idFor(CreepLane::Middle, 1);
+    REQUIRE(fields.getObjective(radiantMid) == outer);
+
+    // Along the lane toward the tower, straight at it on its own tile
+    Vec3 direction;
+    REQUIRE(fields.sample(radiantMid, Vec3(1.5f, 0.0f, 5.5f), direction));
+    REQUIRE(direction.x == 1.0f);
+    REQUIRE(fields.getFlow(radiantMid, 4, 5) == LaneFlowFields::kAtObjective);
+
+    // Pushed off the lane: back toward it first
+    REQUIRE(fields.sample(radiantMid, Vec3(1.5f, 0.0f, 0.5f), direction));
+    REQUIRE(direction.z > 0.0f);
+}
+
+TEST_CASE("LaneFlowFields - Only lanes whose objective fell are recomputed", "[flowfields]") {
+    EntityManager em;
+    addLaneMap(em);
+    Entity outer = addTower(em, Vec3(4.5f, 0.0f, 5.5f), 2);
+    Entity inner = addTower(em, Vec3(7.5f, 0.0f, 5.5f), 2);
+    addTower(em, Vec3(2.5f, 0.0f, 5.5f), 1);
+
+    const NavGrid& grid = em.getNavGrid();
+    const LanePathTable& paths = em.getLanePaths();
+    LaneFlowFields fields;
+    REQUIRE(fields.update(em.getRegistry(), grid, paths, 0) == LanePathTable::kPathCount);
+    REQUIRE(fields.update(em.getRegistry(), grid, paths, 0) == 0);
+
+    const LanePathId radiantMid = LanePathTable::idFor(CreepLane::Middle, 1);
+    const LanePathId direMid = LanePathTable::idFor(CreepLane::Middle, 2);
+    const Entity direTarget = fields.getObjective(direMid);
+    REQUIRE(direTarget != INVALID_ENTITY);
+
+    em.getComponent<HealthComponent>(outer).isDead = true;
+    REQUIRE(fields.update(em.getRegistry(), grid, paths, 0) == 1);
+    REQUIRE(fields.getObjective(radiantMid) == inner);
+    REQUIRE(fields.getFlow(radiantMid, 4, 5) != LaneFlowFields::kAtObjective);
+    REQUIRE(fields.getObjective(direMid) == direTarget);
+
+    // Last tower down: the field leads to the path end
+    em.destroyEntity(inner);
+    REQUIRE(fields.update(em.getRegistry(), grid, paths, 0) == 1);
+    REQUIRE(fields.getObjective(radiantMid) == INVALID_ENTITY);
+    REQUIRE(fields.getFlow(radiantMid, 9, 5) == LaneFlowFields::kAtObjective);
+
+    // New waypoints: everything again
+    REQUIRE(fields.update(em.getRegistry(), grid, paths, 1) == LanePathTable::kPathCount);
+}
+
+TEST_CASE("LaneFlowFields - Creeps on the field keep their waypoint index moving", "[flowfields]") {
+    EntityManager em;
+    addLaneMap(em);
+    Entity entity = em.createEntity("Creep");
+    em.addComponent<TransformComponent>(entity).position = Vec3(1.5f, 0.0f, 5.5f);
+    auto& creep = em.addComponent<CreepComponent>(entity, 1, CreepLane::Middle);
+    creep.pathId = LanePathTable::idFor(CreepLane::Middle, 1);
+
+    CreepSystem creeps(em);
+    em.rebuildSpatialGrid();
+    creeps.update(1.0f / 30.0f);
+
+    // Past the first waypoint along the lane: the fallback would aim at the second one
+    REQUIRE(em.getComponent<TransformComponent>(entity).position.x > 1.5f);
+    REQUIRE(em.getComponent<CreepComponent>(entity).currentWaypointIndex == 1);
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity addWaypoint(EntityManager& em, const Vec3& position, i32 order, i32 lane) {
+    Entity entity = em.createEntity("Waypoint");
+    em.addComponent<TransformComponent>(entity).position = position;
+    auto& obj = em.addComponent<ObjectComponent>(entity, ObjectType::Waypoint);
+    obj.waypointOrder = order;
+    obj.waypointLane = lane;
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("LanePathTable - Waypoints are ordered per lane", "[lanepaths]") {
+    EntityManager em;
+    addWaypoint(em, Vec3(30.0f, 0.0f, 0.0f), 2, 1);
+    addWaypoint(em, Vec3(10.0f, 0.0f, 0.0f), 0, 1);
+    addWaypoint(em, Vec3(20.0f, 0.0f, 0.0f), 1, -1);    // Shared by every lane
+    addWaypoint(em, Vec3(0.0f, 0.0f, 99.0f), 0, 0);
+
+    const LanePathTable& table = em.getLanePaths();
+    const Vector<Vec3>& mid = table.getPath(LanePathTable::idFor(CreepLane::Middle, 1));
+    REQUIRE(mid.size() == 3);
+    REQUIRE(mid[0].x == 10.0f);
+    REQUIRE(mid[1].x == 20.0f);
+    REQUIRE(mid[2].x == 30.0f);
+
+    const Vector<Vec3>& top = table.getPath(LanePathTable::idFor(CreepLane::Top, 2));
+    REQUIRE(top.size() == 2);
+    REQUIRE(top[0].z == 99.0f);
+
+    // Lanes without waypoints fall back to a base-to-base path per team
+    const Vector<Vec3>& radiantBot = table.getPath(LanePathTable::idFor(CreepLane::Bottom, 1));
+    const Vector<Vec3>& direBot = table.getPath(LanePathTable::idFor(CreepLane::Bottom, 2));
+    REQUIRE(radiantBot.size() == 3);
+    REQUIRE(radiantBot.front().x == direBot.back().x);
+    REQUIRE(radiantBot.front().z == direBot.back().z);
+
+    REQUIRE(table.getPath(INVALID_LANE_PATH).empty());
+}
+
+TEST_CASE("LanePathTable - Rebuilt only after waypoints change", "[lanepaths]") {
+    EntityManager em;
+    Entity first = addWaypoint(em, Vec3(10.0f, 0.0f, 0.0f), 0, 1);
+    addWaypoint(em, Vec3(20.0f, 0.0f, 0.0f), 1, 1);
+    const LanePathId mid = LanePathTable::idFor(CreepLane::Middle, 1);
+
+    REQUIRE(em.getLanePaths().getPath(mid).size() == 2);
+
+    // Moving a waypoint is invisible until someone marks the paths dirty
+    em.getComponent<TransformComponent>(first).position.x = 15.0f;
+    REQUIRE(em.getLanePaths().getPath(mid)[0].x == 10.0f);
+
+    em.markLanePathsDirty();
+    REQUIRE(em.getLanePaths().getPath(mid)[0].x == 15.0f);
+
+    // Adding and removing waypoints is tracked automatically
+    addWaypoint(em, Vec3(30.0f, 0.0f, 0.0f), 2, 1);
+    REQUIRE(em.getLanePaths().getPath(mid).size() == 3);
+    em.destroyEntity(first);
+    REQUIRE(em.getLanePaths().getPath(mid).size() == 2);
+}
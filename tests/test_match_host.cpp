@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include "server/MatchHost.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+MatchSlotInfo makeSlot(u64 matchId, bool local, size_t players) {
+    MatchSlotInfo slot;
+    slot.matchId = matchId;
+    slot.local = local;
+    slot.joinable = true;
+    slot.players = players;
+    return slot;
+}
+
+} // namespace
+
+TEST_CASE("MatchHost - Lobbies are admitted only once assigned", "[matchhost]") {
+    Vector<MatchSlotInfo> slots;
+    slots.push_back(makeSlot(42, false, 3));
+    slots.push_back(makeSlot(MatchHost::LOCAL_MATCH_BASE + 1, true, 10));
+    slots.push_back(makeSlot(MatchHost::LOCAL_MATCH_BASE + 2, true, 1));
+    slots.push_back(makeSlot(MatchHost::LOCAL_MATCH_BASE, true, 0));
+    slots.back().joinable = false;
+
+    u64 matchId = 0;
+    REQUIRE(admitLobby(slots, 42, 10, matchId) == LobbyAdmission::Join);
+    REQUIRE(matchId == 42);
+
+    // Never assigned, or not a lobby at all: a client cannot pick its own match
+    matchId = 0;
+    REQUIRE(admitLobby(slots, 43, 10, matchId) == LobbyAdmission::Reject);
+    REQUIRE(admitLobby(slots, MatchHost::LOCAL_MATCH_BASE + 2, 10, matchId) == LobbyAdmission::Reject);
+    REQUIRE(matchId == 0);
+
+    // A lobby that already finished takes nobody
+    slots[0].finished = true;
+    REQUIRE(admitLobby(slots, 42, 10, matchId) == LobbyAdmission::Reject);
+
+    // Direct connects fill the lowest local match that is still seating and has room
+    REQUIRE(admitLobby(slots, 0, 10, matchId) == LobbyAdmission::Join);
+    REQUIRE(matchId == MatchHost::LOCAL_MATCH_BASE + 2);
+    slots[2].players = 10;
+    REQUIRE(admitLobby(slots, 0, 10, matchId) == LobbyAdmission::OpenLocal);
+}
+
+TEST_CASE("MatchHost - Tick deadlines count misses and skip ahead", "[matchhost]") {
+    const f64 interval = 1.0 / 30.0;
+    TickDeadline deadline(interval, 0.0, MatchHost::MAX_CATCH_UP_TICKS);
+    f64 skipped = 0.0;
+
+    REQUIRE_FALSE(deadline.poll(interval * 0.5, skipped));
+    REQUIRE(deadline.poll(interval * 1.5, skipped));
+    REQUIRE(deadline.getMissed() == 0);
+    REQUIRE(skipped == 0.0);
+
+    // Started over an interval late: missed, but the backlog is still run tick by tick
+    REQUIRE(deadline.poll(interval * 3.5, skipped));
+    REQUIRE(deadline.getMissed() == 1);
+    REQUIRE(skipped == 0.0);
+    REQUIRE(deadline.poll(interval * 3.5, skipped));
+    REQUIRE(deadline.getMissed() == 1);
+    REQUIRE_FALSE(deadline.poll(interval * 3.5, skipped));
+
+    // A long stall drops the backlog: one tick now, the next a full interval later
+    const f64 stalled = interval * 40.0;
+    REQUIRE(deadline.poll(stalled, skipped));
+    REQUIRE(skipped > interval * MatchHost::MAX_CATCH_UP_TICKS);
+    REQUIRE(deadline.getMissed() == 2);
+    REQUIRE_FALSE(deadline.poll(stalled, skipped));
+    REQUIRE(deadline.getNextTickTime() == stalled + interval);
+}
+
+TEST_CASE("MatchHost - A closed match gives its slot back", "[matchhost]") {
+    // Never started: the host is driven without a socket
+    Network::NetworkServer network;
+    MatchHost host(network, nullptr, 1, 30);
+
+    REQUIRE(host.createMatch(7, 10) != nullptr);
+    REQUIRE(host.createMatch(7, 10) == host.findMatch(7));
+    REQUIRE(host.createMatch(8, 10) == nullptr);
+    u64 matchId = 0;
+    REQUIRE(host.resolveMatch(7, matchId));
+    REQUIRE_FALSE(host.resolveMatch(8, matchId));
+    REQUIRE_FALSE(host.resolveMatch(0, matchId));
+
+    // Nobody joined the lobby in time
+    host.updateLobbies(30.0f);
+    REQUIRE(host.getMatchCount() == 1);
+    host.updateLobbies(31.0f);
+    REQUIRE(host.getMatchCount() == 0);
+    REQUIRE_FALSE(host.resolveMatch(7, matchId));
+
+    REQUIRE(host.createMatch(8, 10) != nullptr);
+    REQUIRE(host.resolveMatch(8, matchId));
+    REQUIRE(matchId == 8);
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/Modifiers.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Buff makeBuff(BuffType type, f32 value, f32 duration, Entity source = INVALID_ENTITY) {
+    Buff buff;
+    buff.type = type;
+    buff.value = value;
+    buff.duration = duration;
+    buff.source = source;
+    return buff;
+}
+
+} // namespace
+
+TEST_CASE("ModifierSet - Mask and totals follow applied buffs", "[modifiers]") {
+    ModifierSet set;
+    REQUIRE(set.getMask() == 0);
+
+    REQUIRE(set.apply(makeBuff(BuffType::Stun, 0.0f, 1.0f)));
+    REQUIRE(set.apply(makeBuff(BuffType::ArmorBonus, 5.0f, 2.0f)));
+    REQUIRE(set.apply(makeBuff(BuffType::ArmorReduction, 2.0f, 2.0f)));
+    REQUIRE(set.apply(makeBuff(BuffType::Slow, 20.0f, 2.0f, static_cast<Entity>(1))));
+    REQUIRE(set.apply(makeBuff(BuffType::Slow, 35.0f, 2.0f, static_cast<Entity>(2))));
+
+    REQUIRE(set.has(BuffType::Stun));
+    REQUIRE(set.hasAny(ModifierSet::bit(BuffType::Hex) | ModifierSet::bit(BuffType::Stun)));
+    REQUIRE_FALSE(set.has(BuffType::Silence));
+    REQUIRE(set.getTotals().armor == 3.0f);
+    REQUIRE(set.getTotals().slowPercent == 35.0f);
+
+    // Zero-duration buffs never become active
+    REQUIRE_FALSE(set.apply(makeBuff(BuffType::Silence, 0.0f, 0.0f)));
+    REQUIRE_FALSE(set.has(BuffType::Silence));
+}
+
+TEST_CASE("ModifierSet - Refresh keeps one instance per type and source", "[modifiers]") {
+    ModifierSet set;
+    const Entity source = static_cast<Entity>(7);
+
+    REQUIRE(set.apply(makeBuff(BuffType::DamageBonus, 10.0f, 1.0f, source)));
+    // Weaker re-application only refreshes the timer: totals are unchanged
+    REQUIRE_FALSE(set.apply(makeBuff(BuffType::DamageBonus, 5.0f, 3.0f, source)));
+    REQUIRE(set.size() == 1);
+    REQUIRE(set.getBuffs()[0].remainingTime == 3.0f);
+    REQUIRE(set.getTotals().damage == 10.0f);
+
+    REQUIRE(set.apply(makeBuff(BuffType::DamageBonus, 15.0f, 3.0f, source)));
+    REQUIRE(set.getTotals().damage == 15.0f);
+
+    // Another source stacks
+    REQUIRE(set.apply(makeBuff(BuffType::DamageBonus, 5.0f, 3.0f)));
+    REQUIRE(set.size() == 2);
+    REQUIRE(set.getTotals().damage == 20.0f);
+}
+
+TEST_CASE("ModifierSet - Expiry, removal and purge update the mask", "[modifiers]") {
+    ModifierSet set;
+    set.apply(makeBuff(BuffType::Stun, 0.0f, 0.5f));
+    set.apply(makeBuff(BuffType::Haste, 50.0f, 2.0f));
+
+    Buff poison = makeBuff(BuffType::DamageOverTime, 10.0f, 2.0f);
+    poison.tickInterval = 0.5f;
+    set.apply(poison);
+
+    i32 ticks = 0;
+    auto onTick = [&ticks](const Buff& buff) {
+        REQUIRE(buff.type == BuffType::DamageOverTime);
+        ticks++;
+    };
+
+    REQUIRE_FALSE(set.update(0.25f, onTick));
+    REQUIRE(set.has(BuffType::Stun));
+    REQUIRE(set.update(0.25f, onTick));
+    REQUIRE_FALSE(set.has(BuffType::Stun));
+    REQUIRE(set.has(BuffType::Haste));
+    REQUIRE(ticks == 1);
+
+    REQUIRE(set.remove(BuffType::Haste) == 1);
+    REQUIRE(set.getTotals().haste == 0.0f);
+    REQUIRE(set.remove(BuffType::Haste) == 0);
+
+    // Positive purge leaves debuffs alone
+    REQUIRE(set.purge(true, false) == 0);
+    REQUIRE(set.purge(false, true) == 1);
+    REQUIRE(set.empty());
+    REQUIRE(set.getMask() == 0);
+}
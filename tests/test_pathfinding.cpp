@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+#include "world/Pathfinder.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+// 10x10 unit tiles on level 0 with a cliff (vertex column 5 raised) walling off tiles
+// x = 4..5 for z = 0..7; the only way across is through the top two rows
+Entity addWalledTerrain(EntityManager& em) {
+    Entity entity = em.createEntity("Terrain");
+    em.addComponent<TransformComponent>(entity);
+    auto& terrain = em.addComponent<TerrainComponent>(entity);
+    terrain.tilesX = 10;
+    terrain.tilesZ = 10;
+    terrain.tileSize = 1.0f;
+    terrain.heightStep = 1.0f;
+    terrain.resolution = Vec2i(11, 11);
+    terrain.heightLevels.assign(11 * 11, 0);
+    for (i32 z = 0; z <= 7; ++z) {
+        terrain.heightLevels[z * 11 + 5] = 1;
+    }
+    return entity;
+}
+
+bool onWalkableGround(const NavGrid& grid, const Vec3& position) {
+    i32 x = 0, z = 0;
+    return grid.worldToCell(position, x, z) && grid.isWalkable(x, z);
+}
+
+} // namespace
+
+TEST_CASE("NavGrid - Cliffs and static colliders block tiles", "[pathfinding]") {
+    EntityManager em;
+    addWalledTerrain(em);
+
+    NavGrid grid(0.0f);
+    grid.build(em.getRegistry());
+    REQUIRE(grid.getWidth() == 10);
+    REQUIRE(grid.getWalkableCount() == 100 - 16);
+    REQUIRE_FALSE(grid.isWalkable(4, 3));
+    REQUIRE(grid.isWalkable(4, 8));
+    REQUIRE_FALSE(grid.hasLineOfSight(1, 1, 8, 1));
+    REQUIRE(grid.hasLineOfSight(1, 9, 8, 9));
+
+    Entity rock = em.createEntity("Rock");
+    em.addComponent<TransformComponent>(rock).position = Vec3(8.5f, 0.0f, 2.5f);
+    auto& collision = em.addComponent<CollisionComponent>(rock, CollisionShape::Sphere);
+    collision.isStatic = true;
+    grid.build(em.getRegistry());
+    REQUIRE_FALSE(grid.isWalkable(8, 2));
+    REQUIRE(grid.isWalkable(8, 1));
+    REQUIRE(grid.getWalkableCount() == 100 - 17);
+}
+
+TEST_CASE("Pathfinder - Queued searches route around cliffs within the budget", "[pathfinding]") {
+    EntityManager em;
+    addWalledTerrain(em);
+    NavGrid grid(0.0f);
+    grid.build(em.getRegistry());
+
+    Pathfinder pathfinder;
+    pathfinder.setSearchBudget(4);
+    Entity hero = em.createEntity("Hero");
+    const Vec3 start(1.5f, 0.0f, 1.5f);
+    const Vec3 goal(8.25f, 0.0f, 1.75f);
+
+    // In plain sight: answered at once with the goal itself
+    Vector<Vec3> waypoints;
+    REQUIRE(pathfinder.request(grid, hero, start, Vec3(3.5f, 0.0f, 6.5f), waypoints));
+    REQUIRE(waypoints.size() == 1);
+
+    REQUIRE_FALSE(pathfinder.request(grid, hero, start, goal, waypoints));
+    REQUIRE(pathfinder.getPendingCount() == 1);
+
+    Vector<PathResult> results;
+    i32 ticks = 0;
+    while (results.empty() && ticks < 100) {
+        pathfinder.update(grid, results);
+        ++ticks;
+    }
+    REQUIRE(ticks > 1);
+    REQUIRE(results.size() == 1);
+    REQUIRE(pathfinder.getPendingCount() == 0);
+
+    const PathResult& result = results.front();
+    REQUIRE(result.agent == hero);
+    REQUIRE(result.reachedGoal);
+    REQUIRE(result.waypoints.back() == goal);
+    // Smoothed down to the two corners of the gap plus the goal
+    REQUIRE(result.waypoints.size() <= 4);
+    bool crossedGap = false;
+    for (const Vec3& point : result.waypoints) {
+        REQUIRE(onWalkableGround(grid, point));
+        crossedGap = crossedGap || point.z >= 8.0f;
+    }
+    REQUIRE(crossedGap);
+}
+
+TEST_CASE("Pathfinder - Cached paths are reused until the grid changes", "[pathfinding]") {
+    EntityManager em;
+    addWalledTerrain(em);
+    NavGrid grid(0.0f);
+    grid.build(em.getRegistry());
+
+    Pathfinder pathfinder;
+    Entity first = em.createEntity("First");
+    Entity second = em.createEntity("Second");
+    const Vec3 goal(8.5f, 0.0f, 1.5f);
+
+    Vector<Vec3> waypoints;
+    REQUIRE_FALSE(pathfinder.request(grid, first, Vec3(1.5f, 0.0f, 1.5f), goal, waypoints));
+    Vector<PathResult> results;
+    pathfinder.update(grid, results);
+    REQUIRE(results.size() == 1);
+    REQUIRE(pathfinder.getCacheSize() == 1);
+
+    // Same cells, slightly different position: straight from the cache
+    REQUIRE(pathfinder.request(grid, second, Vec3(1.25f, 0.0f, 1.75f), goal, waypoints));
+    REQUIRE(pathfinder.getCacheHits() == 1);
+    REQUIRE(waypoints.size() == results.front().waypoints.size());
+
+    // Rebuilt grid: the cached route may be stale
+    grid.build(em.getRegistry());
+    REQUIRE_FALSE(pathfinder.request(grid, second, Vec3(1.25f, 0.0f, 1.75f), goal, waypoints));
+    REQUIRE(pathfinder.getCacheSize() == 0);
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Prefab makeCreepPrefab(const String& name, f32 health) {
+    CreepComponent creep(1, CreepLane::Middle);
+    creep.maxHealth = health;
+    creep.currentHealth = health;
+
+    MeshComponent mesh("CreepMesh");
+    mesh.vertices = { Vec3(0.0f), Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f) };
+    mesh.indices = { 0, 1, 2 };
+
+    MaterialComponent material("CreepMaterial");
+    material.baseColor = Vec3(0.2f, 0.8f, 0.2f);
+
+    Prefab prefab(name);
+    prefab.withEntityName("Creep")
+          .with(creep)
+          .with(TransformComponent())
+          .with(mesh)
+          .withMaterial(material);
+    return prefab;
+}
+
+} // namespace
+
+TEST_CASE("PrefabLibrary - Bulk instantiate copies components and shares the material", "[prefabs]") {
+    EntityManager em;
+    PrefabLibrary& prefabs = em.getPrefabs();
+    const PrefabId id = prefabs.add(makeCreepPrefab("Creep_Melee", 550.0f));
+    REQUIRE(prefabs.isValid(id));
+
+    Entity creeps[4];
+    REQUIRE(prefabs.instantiate(id, creeps, 4));
+
+    Entity material = INVALID_ENTITY;
+    for (Entity creep : creeps) {
+        REQUIRE(em.isValid(creep));
+        REQUIRE(em.getComponent<NameComponent>(creep).name == "Creep");
+        REQUIRE(em.getComponent<CreepComponent>(creep).currentHealth == 550.0f);
+        REQUIRE(em.hasComponent<TransformComponent>(creep));
+
+        const auto& mesh = em.getComponent<MeshComponent>(creep);
+        REQUIRE(mesh.vertices.size() == 3);
+        if (material == INVALID_ENTITY) {
+            material = mesh.materialEntity;
+        }
+        REQUIRE(mesh.materialEntity == material);
+    }
+    REQUIRE(em.getComponent<MaterialComponent>(material).baseColor.y == 0.8f);
+
+    // Instances are independent copies
+    em.getComponent<CreepComponent>(creeps[0]).currentHealth = 1.0f;
+    REQUIRE(em.getComponent<CreepComponent>(creeps[1]).currentHealth == 550.0f);
+
+    // The material survives a world clear by being recreated
+    em.clear();
+    Entity creep = prefabs.instantiate(id);
+    REQUIRE(em.hasComponent<MaterialComponent>(em.getComponent<MeshComponent>(creep).materialEntity));
+}
+
+TEST_CASE("PrefabLibrary - Names, re-registration and deferred spawns", "[prefabs]") {
+    EntityManager em;
+    PrefabLibrary& prefabs = em.getPrefabs();
+    const PrefabId first = prefabs.add(makeCreepPrefab("Creep_Melee", 550.0f));
+    const PrefabId second = prefabs.add(makeCreepPrefab("Creep_Ranged", 300.0f));
+    REQUIRE(first != second);
+    REQUIRE(prefabs.find("Creep_Ranged") == second);
+    REQUIRE(prefabs.find("Missing") == INVALID_PREFAB);
+
+    // Same name replaces the prefab under its old id
+    REQUIRE(prefabs.add(makeCreepPrefab("Creep_Melee", 700.0f)) == first);
+    REQUIRE(prefabs.size() == 2);
+    REQUIRE(em.getComponent<CreepComponent>(prefabs.instantiate(first)).maxHealth == 700.0f);
+
+    // Unknown prefabs create nothing
+    REQUIRE(prefabs.instantiate(INVALID_PREFAB) == INVALID_ENTITY);
+    Entity none[2];
+    REQUIRE_FALSE(prefabs.instantiate(INVALID_PREFAB, none, 2));
+
+    // applyTo fills an entity created elsewhere (command buffer)
+    Entity deferred = em.createEntity("Projectile");
+    REQUIRE(prefabs.applyTo(second, deferred));
+    REQUIRE(em.getComponent<CreepComponent>(deferred).maxHealth == 300.0f);
+    REQUIRE(em.getComponent<NameComponent>(deferred).name == "Projectile");
+
+    // Reserve grows the storages ahead of time
+    prefabs.reserve(second, 256);
+    REQUIRE(em.getRegistry().storage<CreepComponent>().capacity() >= 256);
+}
@@ -0,0 +1,100 @@
+#include <catch2/catch_test_macros.hpp>
+#include "core/Profiler.h"
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace WorldEditor;
+
+namespace {
+
+nlohmann::json readTrace(const String& path) {
+    std::ifstream in(path);
+    return nlohmann::json::parse(in);
+}
+
+size_t countZones(const nlohmann::json& trace, const String& name) {
+    size_t count = 0;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "X" && event["name"] == name) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("Profiler - Zones from several threads export as Chrome trace", "[profiler]") {
+    const String path = (std::filesystem::temp_directory_path() / "profiler_test_trace.json").string();
+    const char* zoneName = Profiler::intern("ProfilerTest::zone");
+
+    // ProfileScope directly, so the test does not depend on WORLD_EDITOR_PROFILING
+    auto work = [zoneName]() {
+        for (i32 i = 0; i < 10; ++i) {
+            ProfileScope scope(zoneName);
+        }
+    };
+    std::thread worker([&work]() {
+        Profiler::setThreadName("ProfilerTest worker");
+        work();
+    });
+    work();
+    worker.join();
+
+    REQUIRE(Profiler::writeChromeTrace(path));
+    auto trace = readTrace(path);
+    REQUIRE(countZones(trace, "ProfilerTest::zone") >= 20);
+
+    bool namedThread = false;
+    for (const auto& event : trace["traceEvents"]) {
+        if (event["ph"] == "M" && event["args"]["name"] == "ProfilerTest worker") {
+            namedThread = true;
+        }
+        if (event["ph"] == "X") {
+            REQUIRE(event["dur"].get<f64>() >= 0.0);
+        }
+    }
+    REQUIRE(namedThread);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Profiler - Disabled profiler records nothing", "[profiler]") {
+    const String path = (std::filesystem::temp_directory_path() / "profiler_test_disabled.json").string();
+
+    Profiler::setEnabled(false);
+    {
+        ProfileScope scope("ProfilerTest::disabled");
+    }
+    Profiler::setEnabled(true);
+
+    REQUIRE(Profiler::writeChromeTrace(path));
+    REQUIRE(countZones(readTrace(path), "ProfilerTest::disabled") == 0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Profiler - Slow ticks and requests dump once", "[profiler]") {
+    const auto directory = std::filesystem::temp_directory_path() / "profiler_test_slow";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    Profiler::setSlowTickDump(30.0, directory.string(), 60.0);
+    Profiler::endTick(1, 10.0);     // Within budget
+    Profiler::endTick(2, 45.0);     // Slow: dumps
+    Profiler::endTick(3, 50.0);     // Slow, but inside the cooldown
+    Profiler::setSlowTickDump(0.0, String());
+
+    const String requested = (directory / "requested.json").string();
+    Profiler::requestDump(requested);
+    Profiler::endTick(4, 10.0);
+
+    size_t files = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        (void)entry;
+        files++;
+    }
+    REQUIRE(files == 2);
+    REQUIRE(std::filesystem::exists(requested));
+    std::filesystem::remove_all(directory);
+}
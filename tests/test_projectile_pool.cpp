@@ -0,0 +1,114 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+#include "world/ProjectileSystem.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity addUnit(EntityManager& em, const Vec3& position) {
+    Entity entity = em.createEntity("Unit");
+    em.addComponent<TransformComponent>(entity).position = position;
+    return entity;
+}
+
+ProjectileSpawn makeSpawn(Entity attacker, Entity target, const Vec3& position) {
+    ProjectileSpawn spawn;
+    spawn.attacker = attacker;
+    spawn.target = target;
+    spawn.position = position;
+    spawn.speed = 10.0f;
+    spawn.damage = 25.0f;
+    return spawn;
+}
+
+} // namespace
+
+TEST_CASE("ProjectilePool - Projectiles home in and hit as damage events", "[projectiles]") {
+    EntityManager em;
+    ProjectilePool& pool = em.getProjectiles();
+    Entity attacker = addUnit(em, Vec3(0.0f));
+    Entity target = addUnit(em, Vec3(20.0f, 0.0f, 0.0f));
+
+    pool.spawn(makeSpawn(attacker, target, Vec3(0.0f)));
+    REQUIRE(pool.size() == 1);
+
+    // 10 units per second: half a second covers 5 units
+    REQUIRE(pool.update(0.5f) == 0);
+    REQUIRE(pool.getPosition(0).x == 5.0f);
+
+    // The target moved sideways; the projectile follows it
+    em.getComponent<TransformComponent>(target).position = Vec3(5.0f, 0.0f, 10.0f);
+    REQUIRE(pool.update(0.5f) == 0);
+    REQUIRE(pool.getPosition(0).z == 5.0f);
+
+    // Within hit radius after this step
+    REQUIRE(pool.update(0.45f) == 1);
+    REQUIRE(pool.empty());
+    REQUIRE(em.getCombatEvents().size() == 1);
+}
+
+TEST_CASE("ProjectilePool - Lost targets and expired projectiles are dropped without damage", "[projectiles]") {
+    EntityManager em;
+    ProjectilePool& pool = em.getProjectiles();
+    Entity attacker = addUnit(em, Vec3(0.0f));
+    Entity doomed = addUnit(em, Vec3(100.0f, 0.0f, 0.0f));
+    Entity farAway = addUnit(em, Vec3(1000.0f, 0.0f, 0.0f));
+
+    pool.spawn(makeSpawn(attacker, doomed, Vec3(0.0f)));
+    ProjectileSpawn slow = makeSpawn(attacker, farAway, Vec3(0.0f));
+    slow.maxLife = 1.0f;
+    pool.spawn(slow);
+    pool.spawn(makeSpawn(attacker, farAway, Vec3(0.0f)));
+
+    em.destroyEntity(doomed);
+    pool.update(0.1f);
+    REQUIRE(pool.size() == 2);
+
+    pool.update(1.0f);
+    REQUIRE(pool.size() == 1);
+    REQUIRE(pool.getTarget(0) == farAway);
+    REQUIRE(em.getCombatEvents().empty());
+}
+
+TEST_CASE("ProjectilePool - Render entities only exist with visuals enabled", "[projectiles]") {
+    EntityManager em;
+    ProjectilePool& pool = em.getProjectiles();
+    Entity attacker = addUnit(em, Vec3(0.0f));
+    Entity target = addUnit(em, Vec3(100.0f, 0.0f, 0.0f));
+    const PrefabId visual = em.getPrefabs().add(Prefab("Bolt").with(TransformComponent()));
+
+    ProjectileSpawn spawn = makeSpawn(attacker, target, Vec3(0.0f));
+    spawn.visual = visual;
+    pool.spawn(spawn);
+
+    // Headless (server) world: no entities for projectiles
+    const size_t entities = em.getEntityCount();
+    pool.update(0.1f);
+    REQUIRE(pool.getVisual(0) == INVALID_ENTITY);
+    REQUIRE(em.getEntityCount() == entities);
+
+    pool.setVisualsEnabled(true);
+    pool.update(0.1f);
+    Entity bolt = pool.getVisual(0);
+    REQUIRE(em.isValid(bolt));
+    REQUIRE(em.getComponent<TransformComponent>(bolt).position.x == pool.getPosition(0).x);
+
+    // The render entity goes away with its projectile
+    em.destroyEntity(target);
+    pool.update(0.1f);
+    REQUIRE(pool.empty());
+    REQUIRE_FALSE(em.isValid(bolt));
+}
+
+TEST_CASE("ProjectileSystem - Fires from above the attacker", "[projectiles]") {
+    EntityManager em;
+    ProjectileSystem projectiles(em);
+    Entity attacker = addUnit(em, Vec3(0.0f));
+    Entity target = addUnit(em, Vec3(50.0f, 0.0f, 0.0f));
+
+    REQUIRE(projectiles.createProjectile(attacker, target, 10.0f));
+    REQUIRE_FALSE(projectiles.createProjectile(attacker, INVALID_ENTITY, 10.0f));
+    REQUIRE(em.getProjectiles().size() == 1);
+    REQUIRE(em.getProjectiles().getPosition(0).y == 1.0f);
+}
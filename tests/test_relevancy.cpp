@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+#include "world/HeroSystem.h"
+#include "server/Relevancy.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+// Flat 40x10 unit tiles
+void addFlatTerrain(EntityManager& em) {
+    Entity entity = em.createEntity("Terrain");
+    em.addComponent<TransformComponent>(entity);
+    auto& terrain = em.addComponent<TerrainComponent>(entity);
+    terrain.tilesX = 40;
+    terrain.tilesZ = 10;
+    terrain.tileSize = 1.0f;
+    terrain.heightStep = 1.0f;
+    terrain.resolution = Vec2i(41, 11);
+    terrain.heightLevels.assign(41 * 11, 0);
+}
+
+VisionSettings shortVision() {
+    VisionSettings settings;
+    settings.heroRadius = 4.0f;
+    settings.creepRadius = 3.0f;
+    settings.towerRadius = 3.0f;
+    return settings;
+}
+
+RelevancySettings shortInterest() {
+    RelevancySettings settings;
+    settings.heroRadius = 5.0f;
+    settings.cameraRadius = 3.0f;
+    settings.hysteresis = 2.0f;
+    return settings;
+}
+
+Entity addHero(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Hero");
+    em.addComponent<TransformComponent>(entity).position = position;
+    em.addComponent<HeroComponent>(entity, "Hero", teamId);
+    return entity;
+}
+
+Entity addCreep(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Creep");
+    em.addComponent<TransformComponent>(entity).position = position;
+    em.addComponent<CreepComponent>(entity, teamId, CreepLane::Middle);
+    return entity;
+}
+
+Entity addTower(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Tower");
+    em.addComponent<TransformComponent>(entity).position = position;
+    em.addComponent<ObjectComponent>(entity, ObjectType::Tower).teamId = teamId;
+    return entity;
+}
+
+void moveTo(EntityManager& em, Entity entity, f32 x) {
+    em.getComponent<TransformComponent>(entity).position.x = x;
+}
+
+} // namespace
+
+TEST_CASE("Relevancy - Clients get what their team sees near them", "[relevancy]") {
+    EntityManager em;
+    addFlatTerrain(em);
+    em.getVisibility().setSettings(shortVision());
+    Entity hero = addHero(em, Vec3(2.5f, 0.0f, 5.5f), TEAM_RADIANT);
+    Entity nearEnemy = addCreep(em, Vec3(5.5f, 0.0f, 5.5f), TEAM_DIRE);
+    Entity farAlly = addCreep(em, Vec3(18.5f, 0.0f, 5.5f), TEAM_RADIANT);
+    Entity tower = addTower(em, Vec3(25.5f, 0.0f, 5.5f), TEAM_RADIANT);
+    Entity hiddenEnemy = addCreep(em, Vec3(31.5f, 0.0f, 5.5f), TEAM_DIRE);
+    Entity hiddenHero = addHero(em, Vec3(36.5f, 0.0f, 5.5f), TEAM_DIRE);
+    em.updateVisibility();
+
+    RelevancyFilter filter;
+    filter.setSettings(shortInterest());
+    RelevancyFilter::View view;
+    view.teamId = TEAM_RADIANT;
+    view.hasHero = true;
+    view.heroPosition = em.getComponent<TransformComponent>(hero).position;
+    filter.update(1, view, em);
+
+    REQUIRE(filter.isRelevant(1, hero));
+    REQUIRE(filter.isRelevant(1, nearEnemy));
+    // Structures at any distance; other units only nearby
+    REQUIRE(filter.isRelevant(1, tower));
+    REQUIRE_FALSE(filter.isRelevant(1, farAlly));
+    // Nothing in the fog, heroes included
+    REQUIRE_FALSE(filter.isRelevant(1, hiddenEnemy));
+    REQUIRE_FALSE(filter.isRelevant(1, hiddenHero));
+
+    // Looking at the far creep brings it in
+    view.hasCamera = true;
+    view.cameraFocus = Vec3(19.0f, 0.0f, 5.5f);
+    filter.update(1, view, em);
+    REQUIRE(filter.isRelevant(1, farAlly));
+
+    // Spectators see everything
+    filter.update(2, RelevancyFilter::View(), em);
+    REQUIRE(filter.isRelevant(2, hiddenEnemy));
+    REQUIRE(filter.isRelevant(2, hiddenHero));
+
+    filter.removeClient(2);
+    REQUIRE(filter.getRelevantCount(2) == 0);
+}
+
+TEST_CASE("Relevancy - Hysteresis holds units at the edge but not in the fog", "[relevancy]") {
+    EntityManager em;
+    addFlatTerrain(em);
+    em.getVisibility().setSettings(shortVision());
+    Entity hero = addHero(em, Vec3(2.5f, 0.0f, 5.5f), TEAM_RADIANT);
+    Entity ally = addCreep(em, Vec3(6.5f, 0.0f, 5.5f), TEAM_RADIANT);
+    Entity enemy = addCreep(em, Vec3(5.5f, 0.0f, 5.5f), TEAM_DIRE);
+    em.updateVisibility();
+
+    RelevancyFilter filter;
+    filter.setSettings(shortInterest());
+    RelevancyFilter::View view;
+    view.teamId = TEAM_RADIANT;
+    view.hasHero = true;
+    view.heroPosition = em.getComponent<TransformComponent>(hero).position;
+    filter.update(1, view, em);
+    REQUIRE(filter.isRelevant(1, ally));
+    REQUIRE(filter.isRelevant(1, enemy));
+
+    // Past the radius but inside the hysteresis band: kept, though a new client would not get it
+    moveTo(em, ally, 9.0f);
+    em.updateVisibility();
+    filter.update(1, view, em);
+    filter.update(2, view, em);
+    REQUIRE(filter.isRelevant(1, ally));
+    REQUIRE_FALSE(filter.isRelevant(2, ally));
+
+    moveTo(em, ally, 10.0f);
+    em.updateVisibility();
+    filter.update(1, view, em);
+    REQUIRE_FALSE(filter.isRelevant(1, ally));
+
+    // Leaving vision drops a unit at once, even well inside the radius band
+    moveTo(em, enemy, 7.5f);
+    em.getComponent<TransformComponent>(enemy).position.z = 9.5f;
+    moveTo(em, ally, 33.0f);
+    em.updateVisibility();
+    filter.update(1, view, em);
+    REQUIRE_FALSE(em.getVisibility().isVisibleTo(TEAM_RADIANT, enemy));
+    REQUIRE_FALSE(filter.isRelevant(1, enemy));
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include "common/ReplicationScheduler.h"
+#include "common/SnapshotDelta.h"
+#include <algorithm>
+
+using namespace WorldEditor;
+
+namespace {
+
+EntitySnapshot makeEntity(NetworkId id, u8 entityType, f32 x) {
+    EntitySnapshot entity;
+    entity.networkId = id;
+    entity.entityType = entityType;
+    entity.position = Vec3(x, 0.0f, 1000.0f);
+    entity.health = entity.maxHealth = 500.0f;
+    entity.teamId = TEAM_DIRE;
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("ReplicationScheduler - Important entities go first", "[replication]") {
+    WorldSnapshot snapshot;
+    snapshot.entities.push_back(makeEntity(1, 3, 1200.0f));     // Tower next to us
+    snapshot.entities.push_back(makeEntity(2, 2, 9000.0f));     // Far creep
+    snapshot.entities.push_back(makeEntity(3, 2, 1100.0f));     // Near creep
+    snapshot.entities.push_back(makeEntity(4, 1, 1300.0f));     // Enemy hero
+    snapshot.entities.push_back(makeEntity(5, 1, 1000.0f));     // Our hero
+    snapshot.entities.back().ownerClientId = 7;
+
+    ReplicationScheduler scheduler;
+    const Vector<u32>& order = scheduler.schedule(snapshot, 7);
+    REQUIRE(order.size() == 5);
+    REQUIRE(order[0] == 4);
+    REQUIRE(order[1] == 3);
+    REQUIRE(order[2] == 2);
+    REQUIRE(order[3] == 0);
+    REQUIRE(order[4] == 1);
+
+    // A creep in a fight overtakes the enemy hero once it has waited a little
+    scheduler.finish({});
+    snapshot.entities[2].health = 300.0f;
+    scheduler.schedule(snapshot, 7);
+    scheduler.finish({3});
+    snapshot.entities[2].health = 200.0f;
+    scheduler.schedule(snapshot, 7);
+    scheduler.finish({3});
+    snapshot.entities[2].health = 100.0f;
+    scheduler.schedule(snapshot, 7);
+    REQUIRE(scheduler.getAccumulated(3) > scheduler.getAccumulated(4));
+    REQUIRE(scheduler.getAccumulated(5) > scheduler.getAccumulated(3));
+
+    // Entities that leave the snapshot are forgotten
+    snapshot.entities.pop_back();
+    scheduler.schedule(snapshot, 7);
+    REQUIRE(scheduler.getAccumulated(5) == 0.0f);
+}
+
+TEST_CASE("ReplicationScheduler - A tight budget slows updates down without starving any", "[replication]") {
+    WorldSnapshot world;
+    for (u32 i = 0; i < 60; ++i) {
+        world.entities.push_back(makeEntity(i + 1, 2, 1000.0f + static_cast<f32>(i) * 200.0f));
+    }
+    world.entities[0].entityType = 1;
+    world.entities[0].ownerClientId = 7;
+
+    ReplicationScheduler scheduler;
+    Vector<NetworkId> deferred;
+    Map<NetworkId, u32> updates;
+    WorldSnapshot baseline;
+    bool hasBaseline = false;
+    u8 buffer[256];
+
+    for (TickNumber tick = 1; tick <= 60; ++tick) {
+        // Everything moves every tick
+        world.tick = tick;
+        for (auto& entity : world.entities) {
+            entity.position.z += 10.0f;
+        }
+
+        WorldSnapshot sent;
+        const Vector<u32>& order = scheduler.schedule(world, 7);
+        const size_t size = SnapshotDeltaCodec::encode(world, hasBaseline ? &baseline : nullptr,
+                                                       buffer, sizeof(buffer), sent, &order, &deferred);
+        REQUIRE(size > 0);
+        REQUIRE(size <= sizeof(buffer));
+        REQUIRE_FALSE(deferred.empty());
+        scheduler.finish(deferred);
+
+        for (const auto& entity : world.entities) {
+            if (std::find(deferred.begin(), deferred.end(), entity.networkId) == deferred.end()) {
+                ++updates[entity.networkId];
+            }
+        }
+        baseline = std::move(sent);
+        hasBaseline = true;
+    }
+
+    // Our hero every tick, nearby creeps more often than distant ones, nobody never
+    REQUIRE(updates[1] == 60);
+    REQUIRE(updates[2] > updates[60]);
+    for (u32 id = 1; id <= 60; ++id) {
+        REQUIRE(updates[id] > 0);
+    }
+}
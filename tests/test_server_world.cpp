@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include "server/ServerWorld.h"
+#include "world/CreepSystem.h"
+#include "world/HeroSystem.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity addObject(ServerWorld& world, ObjectType type, const Vec3& position, i32 teamId) {
+    EntityManager& em = world.getEntityManager();
+    Entity entity = em.createEntity("Object");
+    em.addComponent<TransformComponent>(entity).position = position;
+    // Like map loading: the type is filled in after the component is emplaced
+    auto& obj = em.addComponent<ObjectComponent>(entity);
+    obj.type = type;
+    obj.teamId = teamId;
+    return entity;
+}
+
+size_t countType(const WorldSnapshot& snapshot, u8 entityType) {
+    size_t count = 0;
+    for (const auto& entity : snapshot.entities) {
+        count += entity.entityType == entityType ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST_CASE("ServerWorld - Creeps and towers are replicated", "[replication]") {
+    ServerWorld world;
+    EntityManager& em = world.getEntityManager();
+    Entity spawn = addObject(world, ObjectType::CreepSpawn, Vec3(0.0f), TEAM_RADIANT);
+    Entity tower = addObject(world, ObjectType::Tower, Vec3(500.0f, 0.0f, 0.0f), TEAM_DIRE);
+
+    CreepSystem creeps(em);
+    REQUIRE(creeps.spawnCreeps(spawn, CreepType::Melee, TEAM_RADIANT, CreepLane::Middle, 4) == 4);
+    world.startGame();
+
+    WorldSnapshot snapshot = world.createSnapshot();
+    REQUIRE(countType(snapshot, 2) == 4);
+    REQUIRE(countType(snapshot, 3) == 1);
+    // Spawn points stay server-side
+    REQUIRE(world.getNetworkId(spawn) == INVALID_NETWORK_ID);
+    REQUIRE(world.getEntityByNetworkId(world.getNetworkId(tower)) == tower);
+
+    // Destroys that bypass ServerWorld release the id too
+    Entity dead = INVALID_ENTITY;
+    auto view = em.getRegistry().view<CreepComponent>();
+    for (auto entity : view) {
+        dead = entity;
+        break;
+    }
+    const NetworkId deadId = world.getNetworkId(dead);
+    REQUIRE(deadId != INVALID_NETWORK_ID);
+    em.getCommandBuffer().destroy(dead);
+    em.flushCommands();
+
+    REQUIRE(world.getEntityByNetworkId(deadId) == INVALID_ENTITY);
+    snapshot = world.createSnapshot();
+    REQUIRE(countType(snapshot, 2) == 3);
+    for (const auto& entity : snapshot.entities) {
+        REQUIRE(entity.networkId != deadId);
+    }
+}
+
+TEST_CASE("ServerWorld - A repeated move order is dropped only while it is being carried out", "[input]") {
+    ServerWorld world;
+    EntityManager& em = world.getEntityManager();
+    world.addSystem(std::make_unique<HeroSystem>(em));
+    Entity hero = world.createEntity("Hero");
+    em.addComponent<TransformComponent>(hero);
+    em.addComponent<HeroComponent>(hero, "Hero", TEAM_RADIANT).isPlayerControlled = true;
+    world.setClientHero(1, hero);
+    world.setGameActive(true);
+
+    const Vec3 goal(3.0f, 0.0f, 0.0f);
+    auto& heroComp = em.getComponent<HeroComponent>(hero);
+    world.processInput(1, PlayerInput::createMoveCommand(1, goal));
+    REQUIRE(heroComp.hasMoveOrder);
+
+    // An attack-move to the same goal is a different order
+    PlayerInput attackMove = PlayerInput::createMoveCommand(2, goal);
+    attackMove.commandType = InputCommandType::AttackMove;
+    world.processInput(1, attackMove);
+    REQUIRE(heroComp.moveOrderAttackMove);
+
+    for (i32 tick = 0; tick < 600 && heroComp.state == HeroState::Moving; ++tick) {
+        world.update(1.0f / 30.0f);
+    }
+    REQUIRE(heroComp.state == HeroState::Idle);
+    REQUIRE_FALSE(heroComp.hasMoveOrder);
+
+    // Pushed off the spot, the same click moves it back
+    em.getComponent<TransformComponent>(hero).position = Vec3(0.0f);
+    world.processInput(1, attackMove);
+    REQUIRE(heroComp.state == HeroState::Moving);
+}
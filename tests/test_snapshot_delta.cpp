@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include "common/SnapshotDelta.h"
+#include "network/NetworkServer.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+WorldSnapshot makeWorld(TickNumber tick, u32 entityCount) {
+    WorldSnapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.serverTime = static_cast<f32>(tick) / 30.0f;
+    snapshot.gameTime = snapshot.serverTime;
+    for (u32 i = 0; i < entityCount; ++i) {
+        EntitySnapshot entity;
+        entity.networkId = i + 1;
+        entity.tick = tick;
+        entity.position = Vec3(static_cast<f32>(i) * 100.0f, 0.0f, 0.0f);
+        entity.health = entity.maxHealth = 500.0f;
+        entity.teamId = (i % 2) ? TEAM_DIRE : TEAM_RADIANT;
+        entity.entityType = 2;
+        snapshot.entities.push_back(entity);
+    }
+    return snapshot;
+}
+
+bool sameEntities(const WorldSnapshot& a, const WorldSnapshot& b) {
+    if (a.entities.size() != b.entities.size()) {
+        return false;
+    }
+    // Compared as they go over the wire
+    for (EntitySnapshot entity : a.entities) {
+        const EntitySnapshot* found = b.findEntity(entity.networkId);
+        if (!found) {
+            return false;
+        }
+        EntitySnapshot other = *found;
+        EntitySnapshotCodec::quantize(entity);
+        EntitySnapshotCodec::quantize(other);
+        if (EntitySnapshotCodec::changedFields(entity, other) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("SnapshotDelta - Deltas rebuild the world from the acknowledged baseline", "[snapshots]") {
+    u8 buffer[4096];
+    WorldSnapshot sent;
+    WorldSnapshot received;
+
+    const WorldSnapshot first = makeWorld(1, 50);
+    const size_t fullSize = SnapshotDeltaCodec::encode(first, nullptr, buffer, sizeof(buffer), sent);
+    REQUIRE(fullSize > 0);
+    REQUIRE(SnapshotDeltaCodec::decode(buffer, fullSize, nullptr, received));
+    REQUIRE(sameEntities(received, first));
+
+    // One unit moves, one takes damage, one dies, one spawns
+    WorldSnapshot second = makeWorld(2, 50);
+    second.entities[3].position.x += 10.0f;
+    second.entities[4].health = 320.0f;
+    second.entities.erase(second.entities.begin() + 7);
+    EntitySnapshot spawned;
+    spawned.networkId = 99;
+    spawned.position = Vec3(5.0f);
+    second.entities.push_back(spawned);
+
+    WorldSnapshot sentSecond;
+    const size_t deltaSize = SnapshotDeltaCodec::encode(second, &sent, buffer, sizeof(buffer), sentSecond);
+    REQUIRE(deltaSize * 10 < fullSize);
+    REQUIRE(sameEntities(sentSecond, second));
+
+    WorldSnapshot rebuilt;
+    REQUIRE(SnapshotDeltaCodec::decode(buffer, deltaSize, &received, rebuilt));
+    REQUIRE(rebuilt.tick == 2);
+    REQUIRE(sameEntities(rebuilt, second));
+    REQUIRE(rebuilt.findEntity(8) == nullptr);
+    REQUIRE(rebuilt.findEntity(99) != nullptr);
+
+    // The delta is useless without its baseline
+    REQUIRE_FALSE(SnapshotDeltaCodec::decode(buffer, deltaSize, nullptr, rebuilt));
+    REQUIRE_FALSE(SnapshotDeltaCodec::decode(buffer, deltaSize, &second, rebuilt));
+}
+
+TEST_CASE("SnapshotDelta - Records that do not fit stay at their baseline", "[snapshots]") {
+    const WorldSnapshot world = makeWorld(5, 100);
+    u8 buffer[1024];
+    WorldSnapshot sent;
+    const size_t size = SnapshotDeltaCodec::encode(world, nullptr, buffer, sizeof(buffer), sent);
+    REQUIRE(size <= sizeof(buffer));
+    REQUIRE(sent.entities.size() < world.entities.size());
+
+    WorldSnapshot received;
+    REQUIRE(SnapshotDeltaCodec::decode(buffer, size, nullptr, received));
+    REQUIRE(sameEntities(received, sent));
+
+    // Later deltas against what was actually sent fill in the rest
+    WorldSnapshot next = world;
+    next.tick = 6;
+    WorldSnapshot sentNext;
+    const size_t nextSize = SnapshotDeltaCodec::encode(next, &sent, buffer, sizeof(buffer), sentNext);
+    WorldSnapshot rebuilt;
+    REQUIRE(SnapshotDeltaCodec::decode(buffer, nextSize, &received, rebuilt));
+    REQUIRE(sameEntities(rebuilt, sentNext));
+    REQUIRE(sentNext.entities.size() > sent.entities.size());
+
+    SnapshotHistory history(4);
+    history.add(sent);
+    history.add(sentNext);
+    REQUIRE(history.find(5) != nullptr);
+    REQUIRE(history.find(6)->entities.size() == sentNext.entities.size());
+    REQUIRE(history.find(9) == nullptr);
+
+    // Storing swaps the snapshot in and hands back what the slot held
+    WorldSnapshot decoded = makeWorld(9, 3);
+    const WorldSnapshot& stored = history.store(decoded);
+    REQUIRE(&stored == history.find(9));
+    REQUIRE(stored.entities.size() == 3);
+    REQUIRE(decoded.tick == 5);
+}
+
+TEST_CASE("SnapshotDelta - Acks only move the baseline to snapshots that were sent", "[snapshots]") {
+    Network::ConnectedClient client;
+    for (TickNumber tick = 10; tick <= 12; ++tick) {
+        client.sentSnapshots.add(makeWorld(tick, 2));
+        client.lastSentSnapshot = tick;
+    }
+
+    REQUIRE(client.acknowledgeSnapshot(11));
+    REQUIRE(client.lastAckedSnapshot == 11);
+
+    // Never sent: ignored, and the real acks that follow still count
+    REQUIRE_FALSE(client.acknowledgeSnapshot(1000000));
+    REQUIRE(client.lastAckedSnapshot == 11);
+    REQUIRE_FALSE(client.acknowledgeSnapshot(10));
+    REQUIRE(client.acknowledgeSnapshot(12));
+    REQUIRE(client.lastAckedSnapshot == 12);
+    REQUIRE(client.sentSnapshots.find(client.lastAckedSnapshot) != nullptr);
+}
@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+#include "common/SnapshotDelta.h"
+#include "common/SnapshotFragments.h"
+#include <algorithm>
+#include <random>
+
+using namespace WorldEditor;
+
+namespace {
+
+WorldSnapshot makeWorld(TickNumber tick, u32 entityCount) {
+    WorldSnapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.gameTime = static_cast<f32>(tick) / 30.0f;
+    for (u32 i = 0; i < entityCount; ++i) {
+        EntitySnapshot entity;
+        entity.networkId = i + 1;
+        entity.position = Vec3(static_cast<f32>(i) * 37.0f, 0.0f, static_cast<f32>(tick));
+        entity.health = entity.maxHealth = 550.0f;
+        entity.stateFlags = i * 2654435761u;
+        entity.teamId = (i % 2) ? TEAM_DIRE : TEAM_RADIANT;
+        snapshot.entities.push_back(entity);
+    }
+    return snapshot;
+}
+
+// One datagram payload per fragment
+Vector<Vector<u8>> fragment(const u8* data, size_t size, TickNumber tick) {
+    Vector<Vector<u8>> fragments;
+    const u32 count = SnapshotFragmenter::getFragmentCount(size);
+    for (u32 i = 0; i < count; ++i) {
+        Vector<u8> packet(SnapshotFragmenter::HEADER_SIZE + NetworkConfig::SNAPSHOT_FRAGMENT_SIZE);
+        const size_t written = SnapshotFragmenter::writeFragment(data, size, tick, i, packet.data(), packet.size());
+        REQUIRE(written > 0);
+        packet.resize(written);
+        fragments.push_back(std::move(packet));
+    }
+    return fragments;
+}
+
+} // namespace
+
+TEST_CASE("SnapshotFragments - Large snapshots reassemble from shuffled fragments", "[snapshots]") {
+    const WorldSnapshot world = makeWorld(10, 400);
+    Vector<u8> encoded(SnapshotFragmenter::MAX_SNAPSHOT_SIZE);
+    WorldSnapshot sent;
+    const size_t size = SnapshotDeltaCodec::encode(world, nullptr, encoded.data(), encoded.size(), sent);
+    REQUIRE(sent.entities.size() == world.entities.size());
+    REQUIRE(size > NetworkConfig::SNAPSHOT_FRAGMENT_SIZE * 2);
+
+    Vector<Vector<u8>> fragments = fragment(encoded.data(), size, world.tick);
+    REQUIRE(fragments.size() == SnapshotFragmenter::getFragmentCount(size));
+    // Reordered, with one duplicate
+    fragments.push_back(fragments[1]);
+    std::shuffle(fragments.begin(), fragments.end(), std::mt19937(3));
+
+    SnapshotReassembler reassembler;
+    const u8* data = nullptr;
+    size_t dataSize = 0;
+    u32 completed = 0;
+    for (const auto& packet : fragments) {
+        if (reassembler.add(packet.data(), packet.size(), data, dataSize)) {
+            ++completed;
+            REQUIRE(dataSize == size);
+            REQUIRE(std::equal(data, data + dataSize, encoded.data()));
+        }
+    }
+    REQUIRE(completed == 1);
+
+    WorldSnapshot received;
+    REQUIRE(SnapshotDeltaCodec::decode(data, dataSize, nullptr, received));
+    REQUIRE(received.entities.size() == 400);
+    REQUIRE(received.findEntity(400)->stateFlags == world.entities[399].stateFlags);
+
+    // Small snapshots are read in place
+    const Vector<Vector<u8>> single = fragment(encoded.data(), 100, 11);
+    REQUIRE(single.size() == 1);
+    REQUIRE(reassembler.add(single[0].data(), single[0].size(), data, dataSize));
+    REQUIRE(data == single[0].data() + SnapshotFragmenter::HEADER_SIZE);
+    REQUIRE(dataSize == 100);
+}
+
+TEST_CASE("SnapshotFragments - A lost fragment drops only its snapshot", "[snapshots]") {
+    Vector<u8> encoded(5000);
+    for (size_t i = 0; i < encoded.size(); ++i) {
+        encoded[i] = static_cast<u8>(i * 7);
+    }
+    const Vector<Vector<u8>> first = fragment(encoded.data(), encoded.size(), 20);
+    const Vector<Vector<u8>> second = fragment(encoded.data(), encoded.size(), 21);
+    REQUIRE(first.size() == 5);
+
+    SnapshotReassembler reassembler;
+    const u8* data = nullptr;
+    size_t dataSize = 0;
+
+    // Tick 20 loses fragment 2
+    for (size_t i = 0; i < first.size(); ++i) {
+        if (i != 2) {
+            REQUIRE_FALSE(reassembler.add(first[i].data(), first[i].size(), data, dataSize));
+        }
+    }
+
+    // Tick 21 abandons it and completes on its own
+    bool complete = false;
+    for (const auto& packet : second) {
+        complete = reassembler.add(packet.data(), packet.size(), data, dataSize);
+    }
+    REQUIRE(complete);
+    REQUIRE(dataSize == encoded.size());
+    REQUIRE(reassembler.getDroppedCount() == 1);
+
+    // The missing fragment turning up late changes nothing
+    REQUIRE_FALSE(reassembler.add(first[2].data(), first[2].size(), data, dataSize));
+    REQUIRE_FALSE(reassembler.add(second[0].data(), second[0].size(), data, dataSize));
+
+    // Malformed headers are ignored
+    Vector<u8> bad = second[0];
+    bad[5] = 0;    // Zero fragments
+    REQUIRE_FALSE(reassembler.add(bad.data(), bad.size(), data, dataSize));
+    REQUIRE_FALSE(reassembler.add(bad.data(), 3, data, dataSize));
+}
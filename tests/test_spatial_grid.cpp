@@ -0,0 +1,190 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "world/EntityManager.h"
+#include "world/SpatialGrid.h"
+#include "world/CreepSystem.h"
+#include "world/TowerSystem.h"
+#include <algorithm>
+#include <random>
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity makeCreep(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Creep");
+    em.addComponent<TransformComponent>(entity).position = position;
+    auto& creep = em.addComponent<CreepComponent>(entity);
+    creep.teamId = teamId;
+    creep.state = CreepState::Moving;
+    creep.laneDirection = Vec3(teamId == 1 ? 1.0f : -1.0f, 0.0f, 0.0f);
+    return entity;
+}
+
+Entity makeTower(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Tower");
+    em.addComponent<TransformComponent>(entity).position = position;
+    auto& obj = em.addComponent<ObjectComponent>(entity, ObjectType::Tower);
+    obj.teamId = teamId;
+    return entity;
+}
+
+// Random lane-like spread of creeps for both teams
+void populate(EntityManager& em, i32 unitCount, u32 seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<f32> along(0.0f, 400.0f);
+    std::uniform_real_distribution<f32> across(-20.0f, 20.0f);
+    for (i32 i = 0; i < unitCount; ++i) {
+        makeCreep(em, Vec3(along(rng), 0.0f, across(rng)), (i % 2) + 1);
+    }
+    for (i32 i = 0; i < 6; ++i) {
+        makeTower(em, Vec3(i * 80.0f, 0.0f, 30.0f), (i % 2) + 1);
+    }
+}
+
+// Reference implementation the grid replaced: full view scan
+Entity bruteForceNearestEnemyCreep(EntityManager& em, const Vec3& position, i32 teamId, f32 radius) {
+    Entity nearest = INVALID_ENTITY;
+    f32 nearestDist = radius;
+    auto view = em.getRegistry().view<CreepComponent, TransformComponent>();
+    for (auto entity : view) {
+        const auto& creep = view.get<CreepComponent>(entity);
+        if (creep.teamId == teamId || creep.state == CreepState::Dead) {
+            continue;
+        }
+        f32 dist = glm::length(view.get<TransformComponent>(entity).position - position);
+        if (dist < nearestDist || (dist == nearestDist && nearest != INVALID_ENTITY && entity < nearest)) {
+            nearest = entity;
+            nearestDist = dist;
+        }
+    }
+    return nearest;
+}
+
+} // namespace
+
+TEST_CASE("SpatialGrid - Radius queries match brute force", "[spatial]") {
+    EntityManager em;
+    populate(em, 300, 42);
+    em.rebuildSpatialGrid();
+
+    const auto& grid = em.getSpatialGrid();
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<f32> along(0.0f, 400.0f);
+
+    for (i32 i = 0; i < 50; ++i) {
+        Vec3 center(along(rng), 0.0f, 0.0f);
+        const f32 radius = 25.0f;
+
+        Vector<SpatialHit> hits;
+        grid.queryRadius(center, radius, SpatialFilter::enemiesOf(1, SpatialType::Creep), hits);
+
+        Vector<Entity> expected;
+        auto view = em.getRegistry().view<CreepComponent, TransformComponent>();
+        for (auto entity : view) {
+            if (view.get<CreepComponent>(entity).teamId == 1) continue;
+            if (glm::length(view.get<TransformComponent>(entity).position - center) <= radius) {
+                expected.push_back(entity);
+            }
+        }
+
+        Vector<Entity> actual;
+        for (const auto& hit : hits) {
+            actual.push_back(hit.entity);
+        }
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        REQUIRE(actual == expected);
+
+        REQUIRE(grid.findNearest(center, radius, SpatialFilter::enemiesOf(1, SpatialType::Creep)) ==
+                bruteForceNearestEnemyCreep(em, center, 1, radius));
+    }
+}
+
+TEST_CASE("SpatialGrid - Filters and k-nearest", "[spatial]") {
+    EntityManager em;
+    Entity ally = makeCreep(em, Vec3(1.0f, 0.0f, 0.0f), 1);
+    Entity nearCreep = makeCreep(em, Vec3(2.0f, 0.0f, 0.0f), 2);
+    Entity midCreep = makeCreep(em, Vec3(5.0f, 0.0f, 0.0f), 2);
+    Entity farCreep = makeCreep(em, Vec3(9.0f, 0.0f, 0.0f), 2);
+    Entity tower = makeTower(em, Vec3(3.0f, 0.0f, 0.0f), 2);
+    em.rebuildSpatialGrid();
+
+    const auto& grid = em.getSpatialGrid();
+    Vector<SpatialHit> hits;
+
+    SECTION("Team and type filters") {
+        grid.queryRadius(Vec3(0.0f), 20.0f, SpatialFilter::enemiesOf(1, SpatialType::Creep), hits);
+        REQUIRE(hits.size() == 3);
+        REQUIRE(std::none_of(hits.begin(), hits.end(), [&](const SpatialHit& h) { return h.entity == ally; }));
+
+        grid.queryRadius(Vec3(0.0f), 20.0f, SpatialFilter::enemiesOf(1, SpatialType::Tower), hits);
+        REQUIRE(hits.size() == 1);
+        REQUIRE(hits[0].entity == tower);
+    }
+
+    SECTION("K nearest are sorted and bounded") {
+        grid.queryKNearest(Vec3(0.0f), 20.0f, 2, SpatialFilter::enemiesOf(1, SpatialType::Creep), hits);
+        REQUIRE(hits.size() == 2);
+        REQUIRE(hits[0].entity == nearCreep);
+        REQUIRE(hits[1].entity == midCreep);
+        (void)farCreep;
+    }
+
+    SECTION("Live positions and destroyed entities") {
+        em.getComponent<TransformComponent>(nearCreep).position = Vec3(6.0f, 0.0f, 0.0f);
+        em.destroyEntity(midCreep);
+        REQUIRE(grid.findNearest(Vec3(0.0f), 20.0f, SpatialFilter::enemiesOf(1, SpatialType::Creep)) == nearCreep);
+
+        grid.queryRadius(Vec3(0.0f), 20.0f, SpatialFilter::enemiesOf(1, SpatialType::Creep), hits);
+        REQUIRE(hits.size() == 2);
+    }
+}
+
+// Hidden from the default run: simulation_tests "[benchmark]"
+TEST_CASE("SpatialGrid - Target search scaling", "[.][benchmark][spatial]") {
+    for (i32 unitCount : {50, 200, 1000}) {
+        EntityManager em;
+        populate(em, unitCount, 1234);
+
+        Vector<std::pair<Vec3, i32>> seekers;
+        auto view = em.getRegistry().view<CreepComponent, TransformComponent>();
+        for (auto entity : view) {
+            seekers.push_back({view.get<TransformComponent>(entity).position, view.get<CreepComponent>(entity).teamId});
+        }
+
+        BENCHMARK("brute force nearest enemy, " + std::to_string(unitCount) + " units") {
+            u32 found = 0;
+            for (const auto& [position, teamId] : seekers) {
+                found += bruteForceNearestEnemyCreep(em, position, teamId, 15.0f) != INVALID_ENTITY;
+            }
+            return found;
+        };
+
+        BENCHMARK("grid rebuild + nearest enemy, " + std::to_string(unitCount) + " units") {
+            em.rebuildSpatialGrid();
+            const auto& grid = em.getSpatialGrid();
+            u32 found = 0;
+            for (const auto& [position, teamId] : seekers) {
+                found += grid.findNearest(position, 15.0f, SpatialFilter::enemiesOf(teamId, SpatialType::Creep)) != INVALID_ENTITY;
+            }
+            return found;
+        };
+    }
+}
+
+TEST_CASE("SpatialGrid - Creep and tower tick time", "[.][benchmark][spatial]") {
+    for (i32 unitCount : {50, 200, 1000}) {
+        EntityManager em;
+        populate(em, unitCount, 99);
+        CreepSystem creeps(em);
+        TowerSystem towers(em);
+
+        BENCHMARK("creep + tower tick, " + std::to_string(unitCount) + " units") {
+            em.rebuildSpatialGrid();
+            creeps.update(1.0f / 30.0f);
+            towers.update(1.0f / 30.0f);
+            return em.getEntityCount();
+        };
+    }
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/SystemScheduler.h"
+#include <functional>
+#include <mutex>
+
+using namespace WorldEditor;
+
+namespace {
+
+struct CompA {};
+struct CompB {};
+struct CompC {};
+
+// Records update order into a shared log
+class TestSystem : public System {
+public:
+    using Declare = std::function<void(SystemAccess&)>;
+
+    TestSystem(String name, Vector<String>& log, std::mutex& mutex, Declare declare)
+        : name_(std::move(name)), log_(log), mutex_(mutex), declare_(std::move(declare)) {}
+
+    void update(f32) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        log_.push_back(name_);
+    }
+    String getName() const override { return name_; }
+    void declareAccess(SystemAccess& access) const override { declare_(access); }
+
+private:
+    String name_;
+    Vector<String>& log_;
+    std::mutex& mutex_;
+    Declare declare_;
+};
+
+} // namespace
+
+TEST_CASE("SystemScheduler - Ordering", "[scheduler]") {
+    Vector<String> log;
+    std::mutex mutex;
+    SystemScheduler scheduler;
+
+    auto add = [&](const String& name, TestSystem::Declare declare) {
+        scheduler.add(std::make_unique<TestSystem>(name, log, mutex, std::move(declare)));
+    };
+
+    SECTION("Conflicting systems keep registration order") {
+        add("Writer", [](SystemAccess& a) { a.write<CompA>(); });
+        add("Reader", [](SystemAccess& a) { a.read<CompA>(); });
+        add("Other", [](SystemAccess& a) { a.write<CompB>(); });
+
+        REQUIRE(scheduler.getExecutionOrder() == Vector<String>{"Writer", "Other", "Reader"});
+        REQUIRE(scheduler.getStages().size() == 2);
+    }
+
+    SECTION("Explicit constraints override registration order") {
+        add("Projectiles", [](SystemAccess& a) { a.changesStructure().after("Towers"); });
+        add("Towers", [](SystemAccess& a) { a.changesStructure().after("Creeps"); });
+        add("Creeps", [](SystemAccess& a) { a.changesStructure(); });
+
+        REQUIRE(scheduler.getExecutionOrder() == Vector<String>{"Creeps", "Towers", "Projectiles"});
+    }
+
+    SECTION("Cyclic constraints are ignored, not fatal") {
+        add("A", [](SystemAccess& a) { a.after("B"); });
+        add("B", [](SystemAccess& a) { a.after("A"); });
+
+        REQUIRE(scheduler.getExecutionOrder().size() == 2);
+    }
+
+    SECTION("Undeclared systems are serialized") {
+        add("First", [](SystemAccess& a) { a.changesStructure(); });
+        add("Second", [](SystemAccess& a) { a.read<CompC>(); });
+
+        REQUIRE(scheduler.getStages().size() == 2);
+    }
+
+    SECTION("Replacing a system keeps its slot") {
+        add("A", [](SystemAccess& a) { a.write<CompA>(); });
+        add("B", [](SystemAccess& a) { a.write<CompA>(); });
+        add("A", [](SystemAccess& a) { a.write<CompA>(); });
+
+        REQUIRE(scheduler.size() == 2);
+        REQUIRE(scheduler.getExecutionOrder() == Vector<String>{"A", "B"});
+    }
+}
+
+TEST_CASE("SystemScheduler - Parallel mode runs every system once per stage", "[scheduler]") {
+    Vector<String> log;
+    std::mutex mutex;
+    JobSystemConfig config;
+    config.workerCount = 2;
+    JobSystem jobs(config);
+    SystemScheduler scheduler;
+    scheduler.setJobSystem(&jobs);
+    scheduler.setExecutionMode(SystemScheduler::ExecutionMode::Parallel);
+
+    scheduler.add(std::make_unique<TestSystem>("A", log, mutex, [](SystemAccess& a) { a.write<CompA>(); }));
+    scheduler.add(std::make_unique<TestSystem>("B", log, mutex, [](SystemAccess& a) { a.write<CompB>(); }));
+    scheduler.add(std::make_unique<TestSystem>("C", log, mutex, [](SystemAccess& a) { a.read<CompA, CompB>(); }));
+
+    REQUIRE(scheduler.getStages().size() == 2);
+
+    for (i32 tick = 0; tick < 10; ++tick) {
+        log.clear();
+        scheduler.update(1.0f / 30.0f);
+        REQUIRE(log.size() == 3);
+        // A and B may run in either order, C always after both
+        REQUIRE(log.back() == "C");
+    }
+}
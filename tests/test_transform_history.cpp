@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "world/EntityManager.h"
+#include "world/HeroSystem.h"
+#include "world/TransformHistory.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+Entity addCreep(EntityManager& em, const Vec3& position) {
+    Entity entity = em.createEntity("Creep");
+    em.addComponent<TransformComponent>(entity).position = position;
+    em.addComponent<CreepComponent>(entity, 1, CreepLane::Middle);
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("TransformHistory - Rewinds to interpolated past positions", "[lagcomp]") {
+    EntityManager em;
+    Entity creep = addCreep(em, Vec3(0.0f));
+    TransformHistory history(4);
+
+    // Walks one unit per 0.1s
+    for (i32 tick = 0; tick < 6; ++tick) {
+        em.getComponent<TransformComponent>(creep).position = Vec3(static_cast<f32>(tick), 0.0f, 0.0f);
+        history.record(em.getRegistry(), 0.1f * static_cast<f32>(tick));
+    }
+
+    // Only the last four frames are kept
+    REQUIRE(history.getRecordedFrames() == 4);
+    REQUIRE(history.getOldestTime() == Catch::Approx(0.2f));
+    REQUIRE(history.getNewestTime() == Catch::Approx(0.5f));
+    REQUIRE(history.clampTime(0.0f) == Catch::Approx(0.2f));
+
+    Vec3 position;
+    REQUIRE(history.getPosition(creep, 0.35f, position));
+    REQUIRE(position.x == Catch::Approx(3.5f));
+    REQUIRE(history.getPosition(creep, 1.0f, position));
+    REQUIRE(position.x == Catch::Approx(5.0f));
+    REQUIRE(history.getPosition(creep, 0.0f, position));
+    REQUIRE(position.x == Catch::Approx(2.0f));
+}
+
+TEST_CASE("TransformHistory - Dead units drop out and slots are reused", "[lagcomp]") {
+    EntityManager em;
+    Entity first = addCreep(em, Vec3(1.0f, 0.0f, 0.0f));
+    TransformHistory history(4);
+    history.record(em.getRegistry(), 0.0f);
+
+    // A unit spawned later has no history before it appeared
+    Entity second = addCreep(em, Vec3(2.0f, 0.0f, 0.0f));
+    history.record(em.getRegistry(), 0.1f);
+    REQUIRE(history.getTrackedCount() == 2);
+    Vec3 position;
+    REQUIRE(history.getPosition(second, 0.0f, position));
+    REQUIRE(position.x == Catch::Approx(2.0f));
+
+    em.getComponent<CreepComponent>(first).state = CreepState::Dead;
+    history.record(em.getRegistry(), 0.2f);
+    REQUIRE(history.getTrackedCount() == 1);
+    REQUIRE_FALSE(history.getPosition(first, 0.1f, position));
+
+    Entity third = addCreep(em, Vec3(3.0f, 0.0f, 0.0f));
+    history.record(em.getRegistry(), 0.3f);
+    REQUIRE(history.getTrackedCount() == 2);
+    REQUIRE(history.getPosition(third, 0.0f, position));
+    REQUIRE(position.x == Catch::Approx(3.0f));
+    REQUIRE(history.getPosition(second, 0.25f, position));
+    REQUIRE(position.x == Catch::Approx(2.0f));
+
+    // Structures are not tracked
+    Entity tower = em.createEntity("Tower");
+    em.addComponent<TransformComponent>(tower);
+    em.addComponent<ObjectComponent>(tower, ObjectType::Tower);
+    history.record(em.getRegistry(), 0.4f);
+    REQUIRE_FALSE(history.getPosition(tower, 0.4f, position));
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include "world/EntityManager.h"
+#include "world/HeroSystem.h"
+
+using namespace WorldEditor;
+
+namespace {
+
+// 10x10 unit tiles; tiles x >= 5 are high ground (level 1)
+void addPlateauTerrain(EntityManager& em) {
+    Entity entity = em.createEntity("Terrain");
+    em.addComponent<TransformComponent>(entity);
+    auto& terrain = em.addComponent<TerrainComponent>(entity);
+    terrain.tilesX = 10;
+    terrain.tilesZ = 10;
+    terrain.tileSize = 1.0f;
+    terrain.heightStep = 1.0f;
+    terrain.resolution = Vec2i(11, 11);
+    terrain.heightLevels.assign(11 * 11, 0);
+    for (i32 z = 0; z <= 10; ++z) {
+        for (i32 x = 6; x <= 10; ++x) {
+            terrain.heightLevels[z * 11 + x] = 1;
+        }
+    }
+}
+
+VisionSettings shortVision() {
+    VisionSettings settings;
+    settings.heroRadius = 4.0f;
+    settings.creepRadius = 6.0f;
+    settings.towerRadius = 3.0f;
+    return settings;
+}
+
+Entity addHero(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Hero");
+    em.addComponent<TransformComponent>(entity).position = position;
+    em.addComponent<HeroComponent>(entity, "Hero", teamId);
+    return entity;
+}
+
+Entity addCreep(EntityManager& em, const Vec3& position, i32 teamId) {
+    Entity entity = em.createEntity("Creep");
+    em.addComponent<TransformComponent>(entity).position = position;
+    em.addComponent<CreepComponent>(entity, teamId, CreepLane::Middle);
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE("VisibilityGrid - High ground hides units from below", "[visibility]") {
+    EntityManager em;
+    addPlateauTerrain(em);
+    em.getVisibility().setSettings(shortVision());
+    Entity hero = addHero(em, Vec3(2.5f, 0.0f, 5.5f), 1);
+    Entity creep = addCreep(em, Vec3(7.5f, 1.0f, 5.5f), 2);
+
+    REQUIRE(em.updateVisibility() == 2);
+    const VisibilityGrid& visibility = em.getVisibility();
+
+    // The creep looks down on the hero; the hero cannot look up
+    REQUIRE(visibility.isVisibleTo(2, hero));
+    REQUIRE_FALSE(visibility.isVisibleTo(1, creep));
+    REQUIRE(visibility.isVisibleTo(1, hero));
+    REQUIRE(visibility.isTileVisible(1, 4, 5));
+    REQUIRE_FALSE(visibility.isTileVisible(1, 5, 5));
+
+    // Spectators see everything
+    REQUIRE(visibility.isVisibleTo(0, creep));
+
+    // Up the ramp, the hero sees the plateau
+    em.getComponent<TransformComponent>(hero).position = Vec3(5.5f, 1.0f, 5.5f);
+    em.updateVisibility();
+    REQUIRE(visibility.isVisibleTo(1, creep));
+}
+
+TEST_CASE("VisibilityGrid - Only viewers that changed tile are restamped", "[visibility]") {
+    EntityManager em;
+    addPlateauTerrain(em);
+    em.getVisibility().setSettings(shortVision());
+    Entity hero = addHero(em, Vec3(1.5f, 0.0f, 1.5f), 1);
+    Entity creep = addCreep(em, Vec3(1.5f, 0.0f, 8.5f), 1);
+    REQUIRE(em.updateVisibility() == 2);
+
+    // Moving inside a tile changes nothing
+    em.getComponent<TransformComponent>(hero).position = Vec3(1.9f, 0.0f, 1.1f);
+    REQUIRE(em.updateVisibility() == 0);
+
+    // Into the next tile: one unstamp, one stamp
+    em.getComponent<TransformComponent>(hero).position = Vec3(2.5f, 0.0f, 1.5f);
+    REQUIRE(em.updateVisibility() == 2);
+    const VisibilityGrid& visibility = em.getVisibility();
+    REQUIRE(visibility.isTileVisible(1, 2, 5));
+    REQUIRE(visibility.isTileVisible(1, 1, 8));
+
+    // Dead and destroyed viewers stop revealing
+    em.getComponent<CreepComponent>(creep).state = CreepState::Dead;
+    REQUIRE(em.updateVisibility() == 1);
+    REQUIRE_FALSE(visibility.isTileVisible(1, 1, 8));
+
+    em.destroyEntity(hero);
+    REQUIRE(em.updateVisibility() == 1);
+    REQUIRE(visibility.getViewerCount() == 0);
+    REQUIRE_FALSE(visibility.isTileVisible(1, 2, 1));
+}